@@ -0,0 +1,267 @@
+/* AppendReservations.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for appending the solutions
+		to the Tasks file without its' lock: every writer reserves its' bytes' range with
+		a fetch-and-add on the shared end of the output & writes it positionally, while
+		the file is extended ahead of the reservations in large increments
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "AppendReservations.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const BOOL  WRITE_ACCESS_GRANTED = TRUE;
+static const BOOL  STATUS_FILE_WRITING_FAILED = (BOOL)0;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function opens a Handle to the Tasks file, shared for reading & writing (the file's size is read or cut through it).
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the Tasks list file path"></param>
+/// <returns>A Handle to the Tasks file if successful, or INVALID_HANDLE_VALUE if failed</returns>
+static HANDLE openTasksFileForReservations(char* p_filePath);
+/// <summary>
+///  Description - This function reserves the next range of the output (atomic fetch-and-add, no lock) & makes sure the file was extended
+///		beyond the range's end before the range is written - extending it, under the Tasks file's write lock, if it wasn't.
+/// </summary>
+/// <param name="appendReservations* p_reservations - A pointer to the append reservations"></param>
+/// <param name="lock* p_tasksFileLock - A pointer to the Tasks file's lock"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's writing Handle of the Tasks list file"></param>
+/// <param name="DWORDLONG numberOfBytes - The range's # of bytes"></param>
+/// <param name="PDWORDLONG p_offset - A pointer to the variable that will be updated with the range's first byte's offset"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL reserveOutputRange(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, DWORDLONG numberOfBytes, PDWORDLONG p_offset);
+/// <summary>
+///  Description - This function writes bytes at the given offset of the file (WriteFile with an OVERLAPPED offset - the Handle's file pointer isn't
+///		relied upon, though on a synchronous Handle the write still moves it).
+/// </summary>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's writing Handle of the Tasks list file"></param>
+/// <param name="DWORDLONG offset - The offset of the first byte to write"></param>
+/// <param name="LPTSTR p_bytes - A pointer to the bytes to write"></param>
+/// <param name="DWORD numberOfBytes - The # of bytes to write"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL writeReservedRange(HANDLE* p_h_tasksListFile, DWORDLONG offset, LPTSTR p_bytes, DWORD numberOfBytes);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+appendReservations* buildAppendReservations(char* p_filePath, DWORDLONG extensionSize)
+{
+	appendReservations* p_reservations = NULL;
+	HANDLE h_tasksFile = INVALID_HANDLE_VALUE;
+	LARGE_INTEGER fileSize;
+	//Input integrity validation
+	if ((NULL == p_filePath) || (0 == extensionSize)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the reservations
+	if (NULL == (p_reservations = (appendReservations*)calloc(sizeof(appendReservations), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the append reservations.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	p_reservations->extensionSize = extensionSize;
+
+	//The output begins at the Tasks file's current end
+	if (INVALID_HANDLE_VALUE == (h_tasksFile = openTasksFileForReservations(p_filePath))) {
+		free(p_reservations);
+		return NULL;
+	}
+	if (FALSE == GetFileSizeEx(h_tasksFile, &fileSize)) {
+		printf("Error: Failed to read the size of the Tasks file '%s', with code: %d.\n", p_filePath, GetLastError());
+		CloseHandle(h_tasksFile);
+		free(p_reservations);
+		return NULL;
+	}
+	CloseHandle(h_tasksFile);
+	p_reservations->initialSize = (DWORDLONG)fileSize.QuadPart;
+	p_reservations->endOfOutput = fileSize.QuadPart;
+	p_reservations->extendedSize = fileSize.QuadPart;
+	return p_reservations;
+}
+
+BOOL appendReservedBytes(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, LPTSTR p_bytes, DWORD numberOfBytes)
+{
+	DWORDLONG offset = 0;
+	//Input integrity validation
+	if ((NULL == p_reservations) || (NULL == p_tasksFileLock) || (NULL == p_h_tasksListFile) || (NULL == p_bytes)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if ((STATUS_CODE_SUCCESS != reserveOutputRange(p_reservations, p_tasksFileLock, p_h_tasksListFile, numberOfBytes, &offset)) ||
+		(STATUS_CODE_SUCCESS != writeReservedRange(p_h_tasksListFile, offset, p_bytes, numberOfBytes))) return STATUS_CODE_FAILURE;
+	InterlockedIncrement(&(p_reservations->numberOfPositionalWrites));
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL appendReservedSolution(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, factorizedString* p_solution, DWORDLONG numberOfOccurrences)
+{
+	DWORDLONG offset = 0, occurrence = 0;
+	//Input integrity validation
+	if ((NULL == p_reservations) || (NULL == p_tasksFileLock) || (NULL == p_h_tasksListFile) || (NULL == p_solution) || (0 == numberOfOccurrences)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//A single range for all the occurrences - every occurrence is written at its' own place within it
+	if (STATUS_CODE_SUCCESS != reserveOutputRange(p_reservations, p_tasksFileLock, p_h_tasksListFile, (DWORDLONG)p_solution->stringSize * numberOfOccurrences, &offset))
+		return STATUS_CODE_FAILURE;
+	for (occurrence = 0; occurrence < numberOfOccurrences; occurrence++) {
+		if (STATUS_CODE_SUCCESS != writeReservedRange(p_h_tasksListFile, offset + occurrence * p_solution->stringSize, p_solution->p_numberPrimeFactorsString, p_solution->stringSize))
+			return STATUS_CODE_FAILURE;
+		InterlockedIncrement(&(p_reservations->numberOfPositionalWrites));
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL trimReservedOutput(appendReservations* p_reservations, char* p_filePath)
+{
+	HANDLE h_tasksFile = INVALID_HANDLE_VALUE;
+	LARGE_INTEGER endOfOutput;
+	//Input integrity validation
+	if ((NULL == p_reservations) || (NULL == p_filePath)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Nothing beyond the output (the file was never extended)
+	if (p_reservations->extendedSize == p_reservations->endOfOutput) return STATUS_CODE_SUCCESS;
+
+	//The file ends at the last reserved byte
+	if (INVALID_HANDLE_VALUE == (h_tasksFile = openTasksFileForReservations(p_filePath))) return STATUS_CODE_FAILURE;
+	endOfOutput.QuadPart = p_reservations->endOfOutput;
+	if ((FALSE == SetFilePointerEx(h_tasksFile, endOfOutput, NULL, FILE_BEGIN)) || (FALSE == SetEndOfFile(h_tasksFile))) {
+		printf("Error: Failed to cut the Tasks file '%s' at the end of the solutions (byte %lld), with code: %d.\n", p_filePath, endOfOutput.QuadPart, GetLastError());
+		CloseHandle(h_tasksFile);
+		return STATUS_CODE_FAILURE;
+	}
+	CloseHandle(h_tasksFile);
+	p_reservations->extendedSize = p_reservations->endOfOutput;
+	return STATUS_CODE_SUCCESS;
+}
+
+void printAppendReservationsStatistics(appendReservations* p_reservations)
+{
+	//Input integrity validation
+	if (NULL == p_reservations) return;
+
+	printf("Reserved appends: %ld reservations, %ld positional writes, %lld bytes appended, %ld file extensions (by at least %llu bytes, under the Tasks file lock)\n\n",
+		(long)p_reservations->numberOfReservations, (long)p_reservations->numberOfPositionalWrites, p_reservations->endOfOutput - (LONGLONG)p_reservations->initialSize,
+		(long)p_reservations->numberOfExtensions, p_reservations->extensionSize);
+}
+
+void destroyAppendReservations(appendReservations** p_p_reservations)
+{
+	//Input integrity validation
+	if ((NULL == p_p_reservations) || (NULL == *p_p_reservations)) return;
+
+	free(*p_p_reservations);
+	*p_p_reservations = NULL;
+}
+
+
+
+//......................................Static functions..........................................
+
+static HANDLE openTasksFileForReservations(char* p_filePath)
+{
+	HANDLE h_tasksFile = INVALID_HANDLE_VALUE;
+	//Assert
+	assert(NULL != p_filePath);
+
+	h_tasksFile = CreateFile(
+		p_filePath,							// Const null - terminated string describing the file's path
+		GENERIC_READ | GENERIC_WRITE,		// The size is read (before solving) or cut (after solving)
+		FILE_SHARE_READ | FILE_SHARE_WRITE,	// Share Mode: the threads' Handles may still be open
+		NULL,								// No Security Attributes
+		OPEN_EXISTING,						// The Tasks file must exist
+		FILE_ATTRIBUTE_NORMAL,				// No special attributes
+		NULL								// No Template
+	);
+	if (INVALID_HANDLE_VALUE == h_tasksFile)
+		printf("Error: Failed to create a Handle to the Tasks file '%s' for the append reservations, with code: %d.\n", p_filePath, GetLastError());
+	return h_tasksFile;
+}
+
+static BOOL reserveOutputRange(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, DWORDLONG numberOfBytes, PDWORDLONG p_offset)
+{
+	DWORDLONG endOfRange = 0;
+	LARGE_INTEGER extendedSize;
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Asserts
+	assert(NULL != p_reservations);
+	assert(NULL != p_offset);
+
+	//Reserving the range - no other writer may reserve any of its' bytes
+	*p_offset = (DWORDLONG)InterlockedExchangeAdd64(&(p_reservations->endOfOutput), (LONGLONG)numberOfBytes);
+	endOfRange = *p_offset + numberOfBytes;
+	InterlockedIncrement(&(p_reservations->numberOfReservations));
+
+	//The file was already extended beyond the range (the extended size only grows, & it grows only once the file was extended)
+	if ((LONGLONG)endOfRange <= p_reservations->extendedSize) return STATUS_CODE_SUCCESS;
+
+	//Extending the file by a whole increment (at least up to the range's end), unless another writer extended it meanwhile
+	if (WRITE_ACCESS_GRANTED != write_lock(p_tasksFileLock)) {
+		printf("Tasks file writing access failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	//------------------locked
+	if ((LONGLONG)endOfRange > p_reservations->extendedSize) {
+		extendedSize.QuadPart = p_reservations->extendedSize + (LONGLONG)p_reservations->extensionSize;
+		if (extendedSize.QuadPart < (LONGLONG)endOfRange) extendedSize.QuadPart = (LONGLONG)endOfRange;
+		if ((FALSE == SetFilePointerEx(*p_h_tasksListFile, extendedSize, NULL, FILE_BEGIN)) || (FALSE == SetEndOfFile(*p_h_tasksListFile))) {
+			printf("Error: Failed to extend the Tasks file to %lld bytes, with code: %d.\n", extendedSize.QuadPart, GetLastError());
+			retVal = STATUS_CODE_FAILURE;
+		}
+		else {
+			InterlockedExchange64(&(p_reservations->extendedSize), extendedSize.QuadPart);
+			InterlockedIncrement(&(p_reservations->numberOfExtensions));
+		}
+	}
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != write_release(p_tasksFileLock)) {
+		printf("Tasks file writing lock release failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	return retVal;
+}
+
+static BOOL writeReservedRange(HANDLE* p_h_tasksListFile, DWORDLONG offset, LPTSTR p_bytes, DWORD numberOfBytes)
+{
+	OVERLAPPED writePosition;
+	DWORD numberOfBytesWritten = 0;
+	//Asserts
+	assert(NULL != p_h_tasksListFile);
+	assert(NULL != p_bytes);
+
+	//Writing at the range's offset - concurrently with the other writers' ranges
+	memset(&writePosition, 0, sizeof(OVERLAPPED));
+	writePosition.Offset = (DWORD)(offset & MAXDWORD);
+	writePosition.OffsetHigh = (DWORD)(offset >> 32);
+	if ((STATUS_FILE_WRITING_FAILED == WriteFile(*p_h_tasksListFile, p_bytes, numberOfBytes, &numberOfBytesWritten, &writePosition)) ||
+		(numberOfBytesWritten != numberOfBytes)) {
+		printf("Error: Failed to write %lu bytes at offset %llu of the Tasks file, with code: %d.\n", (unsigned long)numberOfBytes, offset, GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/* AppendReservations.h
+--------------------------------------------------------------
+	Module Description - header module for AppendReservations.c
+--------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __APPEND_RESERVATIONS_H__
+#define __APPEND_RESERVATIONS_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "Lock.h"
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the append reservations of the Tasks file: the end of the output & the extended size both begin
+///		at the file's current size.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the Tasks list file path"></param>
+/// <param name="DWORDLONG extensionSize - The least # of bytes the file is extended by at a time (at least 1)"></param>
+/// <returns>A pointer to a dynamically allocated 'appendReservations' struct if successful, or NULL if failed</returns>
+appendReservations* buildAppendReservations(char* p_filePath, DWORDLONG extensionSize);
+/// <summary>
+///	 Description - This function appends bytes to the Tasks file without the file's lock: it reserves their range with a fetch-and-add on
+///		the end of the output, and writes them positionally (WriteFile with an OVERLAPPED offset) concurrently with the other writers. A range
+///		beyond the file's extended size extends the file first, under the Tasks file's write lock.
+/// </summary>
+/// <param name="appendReservations* p_reservations - A pointer to the append reservations"></param>
+/// <param name="lock* p_tasksFileLock - A pointer to the Tasks file's lock (taken only to extend the file)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's writing Handle of the Tasks list file"></param>
+/// <param name="LPTSTR p_bytes - A pointer to the bytes to append"></param>
+/// <param name="DWORD numberOfBytes - The # of bytes to append"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL appendReservedBytes(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, LPTSTR p_bytes, DWORD numberOfBytes);
+/// <summary>
+///	 Description - This function appends a task's solution once per occurrence of the task without the file's lock: a single range is
+///		reserved for all the occurrences, & every occurrence is written positionally at its' place within the range.
+/// </summary>
+/// <param name="appendReservations* p_reservations - A pointer to the append reservations"></param>
+/// <param name="lock* p_tasksFileLock - A pointer to the Tasks file's lock (taken only to extend the file)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's writing Handle of the Tasks list file"></param>
+/// <param name="factorizedString* p_solution - A pointer to the task's solution"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The number of times the solution should be written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL appendReservedSolution(appendReservations* p_reservations, lock* p_tasksFileLock, HANDLE* p_h_tasksListFile, factorizedString* p_solution, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function cuts the Tasks file's extension beyond the end of the output. It must be called once no thread writes anymore.
+/// </summary>
+/// <param name="appendReservations* p_reservations - A pointer to the append reservations"></param>
+/// <param name="char* p_filePath - A pointer to the Tasks list file path"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL trimReservedOutput(appendReservations* p_reservations, char* p_filePath);
+/// <summary>
+///	 Description - This function prints the append reservations' statistics - the reservations, the positional writes & the file's extensions.
+/// </summary>
+/// <param name="appendReservations* p_reservations - A pointer to the append reservations (NULL - nothing is printed)"></param>
+void printAppendReservationsStatistics(appendReservations* p_reservations);
+/// <summary>
+///	 Description - This function frees the append reservations & sets its' pointer to NULL.
+/// </summary>
+/// <param name="appendReservations** p_p_reservations - A pointer to a pointer to an 'appendReservations' struct"></param>
+void destroyAppendReservations(appendReservations** p_p_reservations);
+
+
+#endif //__APPEND_RESERVATIONS_H__
@@ -0,0 +1,438 @@
+/* PlatformBenchmark.c
+------------------------------------------------------------------------------------------
+	Module Description - This module is a stand-alone benchmark of the primitives the
+		solver is built on, meant to compare the Windows & Linux platform layers: the
+		Readers\Writers locks (uncontended & contended), Mutexes, Events & threads'
+		creation, the appending writes & the tasks' reads (seek+read vs. positional
+		read) and a mapped view's scan. Every measurement is printed in nano-seconds
+		per operation. On Linux, the native POSIX counterparts are measured as well.
+
+		Usage: PlatformBenchmark <scratch file path> [number of iterations]
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "../Lock.h"
+#include "../MappedFile.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const int STATUS_CODE_FAILURE = -1;
+static const int STATUS_CODE_SUCCESS = 0;
+
+static const DWORD SCRATCH_FILE_PATH_ARGUMENT = 1;
+static const DWORD ITERATIONS_ARGUMENT = 2;
+static const DWORD DEFAULT_NUMBER_OF_ITERATIONS = 200000;
+
+static const DWORD NUMBER_OF_CONTENDING_THREADS = 4;
+static const DWORD MAXIMAL_NUMBER_OF_CONTENDING_THREADS = 64;
+static const DWORD THREAD_CREATION_ITERATIONS_DIVISOR = 100;	//Threads' creation is ~100 times slower than a lock's acquisition
+static const DWORD IO_ITERATIONS_DIVISOR = 10;
+
+static const DWORD RECORD_SIZE = 64;							//About a solution line's length
+static const DWORDLONG RANDOM_MULTIPLIER = 6364136223846793005ULL;
+static const DWORDLONG RANDOM_INCREMENT = 1442695040888963407ULL;
+
+static const double NANOSECONDS_PER_SECOND = 1000000000.0;
+
+
+
+
+// Structures ----------------------------------------------------------------------------
+	//contenderParameters structure is a contending thread's share of the contended locks' measurement
+typedef struct _contenderParameters {
+	lock* p_lock;						// The lock all the contending threads acquire
+	DWORD numberOfAcquisitions;			// # of writing acquisitions the thread makes
+	volatile DWORDLONG* p_sharedCounter;// The resource the lock guards - incremented inside every acquisition
+}contenderParameters;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function reads the performance counter, in nano-seconds.
+/// </summary>
+/// <returns>The performance counter's time</returns>
+static double readNanoseconds(void);
+/// <summary>
+///  Description - This function prints a measurement's line: its' name & the nano-seconds per operation.
+/// </summary>
+/// <param name="const char* p_name - The measurement's name"></param>
+/// <param name="double elapsedNanoseconds - The measurement's total time"></param>
+/// <param name="DWORD numberOfOperations - The measurement's # of operations"></param>
+static void printMeasurement(const char* p_name, double elapsedNanoseconds, DWORD numberOfOperations);
+/// <summary>
+///  Description - This function measures a lock's uncontended reading & writing acquisitions (an acquisition & its' release per operation).
+/// </summary>
+/// <param name="DWORD numberOfIterations - # of operations"></param>
+/// <returns>TRUE if succeeded, FALSE otherwise</returns>
+static BOOL benchmarkUncontendedLock(DWORD numberOfIterations);
+/// <summary>
+///  Description - This function measures a lock's writing acquisitions by several threads at once, with & without spinning before parking.
+/// </summary>
+/// <param name="DWORD numberOfIterations - # of operations (split between the threads)"></param>
+/// <returns>TRUE if succeeded, FALSE otherwise</returns>
+static BOOL benchmarkContendedLock(DWORD numberOfIterations);
+/// <summary>
+///  Description - This function is a contending thread's routine: it makes its' share of writing acquisitions of the shared lock.
+/// </summary>
+/// <param name="LPVOID p_parameters - A pointer to the thread's contenderParameters struct"></param>
+/// <returns>0 if succeeded, 1 otherwise</returns>
+static DWORD WINAPI contendForLock(LPVOID p_parameters);
+/// <summary>
+///  Description - This function measures the Synchronous objects: a Mutex's wait & release, an Event's set & wait, and a thread's creation,
+///		termination wait & Handle's closing.
+/// </summary>
+/// <param name="DWORD numberOfIterations - # of operations"></param>
+/// <returns>TRUE if succeeded, FALSE otherwise</returns>
+static BOOL benchmarkSynchronousObjects(DWORD numberOfIterations);
+/// <summary>
+///  Description - This function is the measured threads' (empty) routine.
+/// </summary>
+/// <param name="LPVOID p_parameters - Unused"></param>
+/// <returns>0</returns>
+static DWORD WINAPI returnImmediately(LPVOID p_parameters);
+/// <summary>
+///  Description - This function measures the file I/O: appending a record at the end of the file (the solutions' write), reading a record
+///		at a random offset by moving the file pointer & reading vs. by a single positional read, and scanning a mapped view of the file.
+/// </summary>
+/// <param name="char* p_scratchFilePath - The scratch file's path (created & deleted)"></param>
+/// <param name="DWORD numberOfIterations - # of operations"></param>
+/// <returns>TRUE if succeeded, FALSE otherwise</returns>
+static BOOL benchmarkFileIo(char* p_scratchFilePath, DWORD numberOfIterations);
+#ifdef __linux__
+/// <summary>
+///  Description - This function measures the native POSIX counterparts: a pthread Readers\Writers lock's & mutex's uncontended acquisitions,
+///		and appending (O_APPEND write) & positional reading (pread) of records.
+/// </summary>
+/// <param name="char* p_scratchFilePath - The scratch file's path (created & deleted)"></param>
+/// <param name="DWORD numberOfIterations - # of operations"></param>
+/// <returns>TRUE if succeeded, FALSE otherwise</returns>
+static BOOL benchmarkNativeBaselines(char* p_scratchFilePath, DWORD numberOfIterations);
+#endif
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+	DWORDLONG numberOfIterations = DEFAULT_NUMBER_OF_ITERATIONS;
+	//Input integrity validation
+	if ((SCRATCH_FILE_PATH_ARGUMENT + 1 > (DWORD)argc) || (ITERATIONS_ARGUMENT + 1 < (DWORD)argc)) {
+		printf("Usage: %s <scratch file path> [number of iterations]\n", argv[0]);
+		return STATUS_CODE_FAILURE;
+	}
+	if ((ITERATIONS_ARGUMENT < (DWORD)argc) && ((1 != sscanf_s(argv[ITERATIONS_ARGUMENT], "%llu", &numberOfIterations)) ||
+		(IO_ITERATIONS_DIVISOR * THREAD_CREATION_ITERATIONS_DIVISOR > numberOfIterations) || (MAXDWORD < numberOfIterations))) {
+		printf("Error: The number of iterations must be at least %llu\n", (DWORDLONG)IO_ITERATIONS_DIVISOR * THREAD_CREATION_ITERATIONS_DIVISOR);
+		return STATUS_CODE_FAILURE;
+	}
+
+	printf("%-52s %12s\n", "Operation", "ns/op");
+	if ((FALSE == benchmarkUncontendedLock((DWORD)numberOfIterations)) ||
+		(FALSE == benchmarkContendedLock((DWORD)numberOfIterations)) ||
+		(FALSE == benchmarkSynchronousObjects((DWORD)numberOfIterations)) ||
+		(FALSE == benchmarkFileIo(argv[SCRATCH_FILE_PATH_ARGUMENT], (DWORD)numberOfIterations / IO_ITERATIONS_DIVISOR))) return STATUS_CODE_FAILURE;
+#ifdef __linux__
+	if (FALSE == benchmarkNativeBaselines(argv[SCRATCH_FILE_PATH_ARGUMENT], (DWORD)numberOfIterations)) return STATUS_CODE_FAILURE;
+#endif
+	return STATUS_CODE_SUCCESS;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static double readNanoseconds(void)
+{
+	static double nanosecondsPerTick = 0;
+	LARGE_INTEGER counter, frequency;
+	if (0 == nanosecondsPerTick) {
+		QueryPerformanceFrequency(&frequency);
+		nanosecondsPerTick = NANOSECONDS_PER_SECOND / (double)frequency.QuadPart;
+	}
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * nanosecondsPerTick;
+}
+
+static void printMeasurement(const char* p_name, double elapsedNanoseconds, DWORD numberOfOperations)
+{
+	printf("%-52s %12.1f\n", p_name, elapsedNanoseconds / numberOfOperations);
+}
+
+static BOOL benchmarkUncontendedLock(DWORD numberOfIterations)
+{
+	lock* p_lock = NULL;
+	DWORD iteration = 0;
+	double start = 0;
+	if (NULL == (p_lock = InitializeLock("Benchmark"))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__); return FALSE;
+	}
+
+	start = readNanoseconds();
+	for (iteration = 0; iteration < numberOfIterations; iteration++) {
+		read_lock(p_lock);
+		read_release(p_lock);
+	}
+	printMeasurement("Lock: uncontended read_lock + read_release", readNanoseconds() - start, numberOfIterations);
+
+	start = readNanoseconds();
+	for (iteration = 0; iteration < numberOfIterations; iteration++) {
+		write_lock(p_lock);
+		write_release(p_lock);
+	}
+	printMeasurement("Lock: uncontended write_lock + write_release", readNanoseconds() - start, numberOfIterations);
+
+	return DestroyLock(&p_lock);
+}
+
+static BOOL benchmarkContendedLock(DWORD numberOfIterations)
+{
+	lock* p_lock = NULL;
+	HANDLE p_threadHandles[MAXIMAL_NUMBER_OF_CONTENDING_THREADS];
+	contenderParameters parameters;
+	volatile DWORDLONG sharedCounter = 0;
+	DWORD threadIndex = 0, spinningMode = 0, exitCode = 0;
+	BOOL succeeded = TRUE;
+	double start = 0;
+
+	for (spinningMode = 0; (spinningMode < 2) && (TRUE == succeeded); spinningMode++) {
+		if (NULL == (p_lock = InitializeLock("Benchmark"))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__); return FALSE;
+		}
+		p_lock->spinningDisabled = (1 == spinningMode);
+		parameters.p_lock = p_lock;
+		parameters.numberOfAcquisitions = numberOfIterations / NUMBER_OF_CONTENDING_THREADS;
+		parameters.p_sharedCounter = &sharedCounter;
+		sharedCounter = 0;
+
+		//All the threads contend for the same lock, each incrementing the shared counter inside its' acquisitions
+		start = readNanoseconds();
+		for (threadIndex = 0; threadIndex < NUMBER_OF_CONTENDING_THREADS; threadIndex++) {
+			if (NULL == (p_threadHandles[threadIndex] = CreateThread(NULL, 0, contendForLock, &parameters, 0, NULL))) {
+				printf("Error: Failed to create a contending thread, with code: %d.\n", GetLastError());
+				printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+				break;
+			}
+		}
+		if ((threadIndex < NUMBER_OF_CONTENDING_THREADS) ||
+			(WAIT_OBJECT_0 != WaitForMultipleObjects(NUMBER_OF_CONTENDING_THREADS, p_threadHandles, TRUE, INFINITE))) succeeded = FALSE;
+		else printMeasurement((0 == spinningMode) ? "Lock: 4 contending writers (spin, then park)" : "Lock: 4 contending writers (park right away)",
+			readNanoseconds() - start, parameters.numberOfAcquisitions * NUMBER_OF_CONTENDING_THREADS);
+
+		//The lock must have kept the increments exclusive
+		while (0 < threadIndex--) {
+			if ((FALSE == GetExitCodeThread(p_threadHandles[threadIndex], &exitCode)) || (0 != exitCode)) succeeded = FALSE;
+			CloseHandle(p_threadHandles[threadIndex]);
+		}
+		if ((TRUE == succeeded) && (sharedCounter != (DWORDLONG)parameters.numberOfAcquisitions * NUMBER_OF_CONTENDING_THREADS)) {
+			printf("Error: The contended lock lost %llu increments\n", (DWORDLONG)parameters.numberOfAcquisitions * NUMBER_OF_CONTENDING_THREADS - sharedCounter);
+			succeeded = FALSE;
+		}
+		DestroyLock(&p_lock);
+	}
+	return succeeded;
+}
+
+static DWORD WINAPI contendForLock(LPVOID p_parameters)
+{
+	contenderParameters* p_contender = (contenderParameters*)p_parameters;
+	DWORD acquisition = 0;
+
+	for (acquisition = 0; acquisition < p_contender->numberOfAcquisitions; acquisition++) {
+		if (FALSE == write_lock(p_contender->p_lock)) return 1;
+		(*(p_contender->p_sharedCounter))++;
+		if (FALSE == write_release(p_contender->p_lock)) return 1;
+	}
+	return 0;
+}
+
+static BOOL benchmarkSynchronousObjects(DWORD numberOfIterations)
+{
+	HANDLE h_mutex = NULL, h_event = NULL, h_thread = NULL;
+	DWORD iteration = 0, numberOfThreads = numberOfIterations / THREAD_CREATION_ITERATIONS_DIVISOR;
+	BOOL succeeded = TRUE;
+	double start = 0;
+
+	//Mutex
+	if (NULL == (h_mutex = CreateMutex(NULL, FALSE, NULL))) {
+		printf("Error: Failed to create a Mutex, with code: %d.\n", GetLastError()); return FALSE;
+	}
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfIterations) && (TRUE == succeeded); iteration++) {
+		succeeded = (WAIT_OBJECT_0 == WaitForSingleObject(h_mutex, INFINITE)) && (FALSE != ReleaseMutex(h_mutex));
+	}
+	if (TRUE == succeeded) printMeasurement("Mutex: WaitForSingleObject + ReleaseMutex", readNanoseconds() - start, numberOfIterations);
+	CloseHandle(h_mutex);
+
+	//Auto-reset Event
+	if ((TRUE == succeeded) && (NULL == (h_event = CreateEvent(NULL, FALSE, FALSE, NULL)))) {
+		printf("Error: Failed to create an Event, with code: %d.\n", GetLastError()); return FALSE;
+	}
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfIterations) && (TRUE == succeeded); iteration++) {
+		succeeded = (FALSE != SetEvent(h_event)) && (WAIT_OBJECT_0 == WaitForSingleObject(h_event, INFINITE));
+	}
+	if (TRUE == succeeded) printMeasurement("Event: SetEvent + WaitForSingleObject", readNanoseconds() - start, numberOfIterations);
+	if (NULL != h_event) CloseHandle(h_event);
+
+	//Threads
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfThreads) && (TRUE == succeeded); iteration++) {
+		if (NULL == (h_thread = CreateThread(NULL, 0, returnImmediately, NULL, 0, NULL))) {
+			printf("Error: Failed to create a thread, with code: %d.\n", GetLastError()); return FALSE;
+		}
+		succeeded = (WAIT_OBJECT_0 == WaitForSingleObject(h_thread, INFINITE));
+		CloseHandle(h_thread);
+	}
+	if (TRUE == succeeded) printMeasurement("Thread: CreateThread + wait + CloseHandle", readNanoseconds() - start, numberOfThreads);
+
+	if (FALSE == succeeded) printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+	return succeeded;
+}
+
+static DWORD WINAPI returnImmediately(LPVOID p_parameters)
+{
+	return 0;
+}
+
+static BOOL benchmarkFileIo(char* p_scratchFilePath, DWORD numberOfIterations)
+{
+	HANDLE h_file = NULL;
+	mappedFile* p_mappedFile = NULL;
+	OVERLAPPED overlapped;
+	LARGE_INTEGER distance;
+	char p_record[RECORD_SIZE];
+	DWORDLONG randomState = RANDOM_INCREMENT, offset = 0, checksum = 0, byteIndex = 0;
+	DWORD iteration = 0, numberOfBytes = 0;
+	BOOL succeeded = TRUE;
+	double start = 0;
+
+	memset(p_record, 'x', RECORD_SIZE);
+	p_record[RECORD_SIZE - 1] = '\n';
+	h_file = CreateFile(p_scratchFilePath, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == h_file) {
+		printf("Error: Failed to create the scratch file, with code: %d.\n", GetLastError()); return FALSE;
+	}
+
+	//Appending - the file pointer is moved to the end before every write, as the solutions are written
+	start = readNanoseconds();
+	distance.QuadPart = 0;
+	for (iteration = 0; (iteration < numberOfIterations) && (TRUE == succeeded); iteration++) {
+		succeeded = (FALSE != SetFilePointerEx(h_file, distance, NULL, FILE_END)) &&
+			(FALSE != WriteFile(h_file, p_record, RECORD_SIZE, &numberOfBytes, NULL)) && (RECORD_SIZE == numberOfBytes);
+	}
+	if (TRUE == succeeded) printMeasurement("File: seek to end + WriteFile (64 bytes)", readNanoseconds() - start, numberOfIterations);
+
+	//Reading at random offsets - moving the file pointer & reading vs. a single positional read
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfIterations) && (TRUE == succeeded); iteration++) {
+		randomState = randomState * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+		distance.QuadPart = (LONGLONG)((randomState >> 33) % numberOfIterations) * RECORD_SIZE;
+		succeeded = (FALSE != SetFilePointerEx(h_file, distance, NULL, FILE_BEGIN)) &&
+			(FALSE != ReadFile(h_file, p_record, RECORD_SIZE, &numberOfBytes, NULL)) && (RECORD_SIZE == numberOfBytes);
+	}
+	if (TRUE == succeeded) printMeasurement("File: seek + ReadFile (64 bytes, random)", readNanoseconds() - start, numberOfIterations);
+
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfIterations) && (TRUE == succeeded); iteration++) {
+		randomState = randomState * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+		offset = ((randomState >> 33) % numberOfIterations) * RECORD_SIZE;
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)offset;
+		overlapped.OffsetHigh = (DWORD)(offset >> 32);
+		succeeded = (FALSE != ReadFile(h_file, p_record, RECORD_SIZE, &numberOfBytes, &overlapped)) && (RECORD_SIZE == numberOfBytes);
+	}
+	if (TRUE == succeeded) printMeasurement("File: positional ReadFile (64 bytes, random)", readNanoseconds() - start, numberOfIterations);
+	CloseHandle(h_file);
+
+	//Scanning a mapped view - per byte
+	if (TRUE == succeeded) {
+		if (NULL == (p_mappedFile = mapFileForReading(p_scratchFilePath, 0))) succeeded = FALSE;
+		else {
+			start = readNanoseconds();
+			for (byteIndex = 0; byteIndex < p_mappedFile->numberOfBytes; byteIndex++) checksum += (BYTE)p_mappedFile->p_view[byteIndex];
+			printf("%-52s %12.3f\n", "Mapped view: sequential scan (per byte)", (readNanoseconds() - start) / (double)p_mappedFile->numberOfBytes);
+			succeeded = (checksum == (DWORDLONG)numberOfIterations * (('x' * (RECORD_SIZE - 1)) + '\n'));
+			unmapFile(&p_mappedFile);
+		}
+	}
+
+	DeleteFile(p_scratchFilePath);
+	if (FALSE == succeeded) printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+	return succeeded;
+}
+
+#ifdef __linux__
+static BOOL benchmarkNativeBaselines(char* p_scratchFilePath, DWORD numberOfIterations)
+{
+	pthread_rwlock_t readersWritersLock = PTHREAD_RWLOCK_INITIALIZER;
+	pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+	char p_record[RECORD_SIZE];
+	DWORDLONG randomState = RANDOM_INCREMENT;
+	DWORD iteration = 0, numberOfRecords = numberOfIterations / IO_ITERATIONS_DIVISOR;
+	int fileDescriptor = -1;
+	BOOL succeeded = TRUE;
+	double start = 0;
+
+	start = readNanoseconds();
+	for (iteration = 0; iteration < numberOfIterations; iteration++) {
+		pthread_rwlock_rdlock(&readersWritersLock);
+		pthread_rwlock_unlock(&readersWritersLock);
+	}
+	printMeasurement("Native: pthread_rwlock_rdlock + unlock", readNanoseconds() - start, numberOfIterations);
+
+	start = readNanoseconds();
+	for (iteration = 0; iteration < numberOfIterations; iteration++) {
+		pthread_rwlock_wrlock(&readersWritersLock);
+		pthread_rwlock_unlock(&readersWritersLock);
+	}
+	printMeasurement("Native: pthread_rwlock_wrlock + unlock", readNanoseconds() - start, numberOfIterations);
+
+	start = readNanoseconds();
+	for (iteration = 0; iteration < numberOfIterations; iteration++) {
+		pthread_mutex_lock(&mutex);
+		pthread_mutex_unlock(&mutex);
+	}
+	printMeasurement("Native: pthread_mutex_lock + unlock", readNanoseconds() - start, numberOfIterations);
+
+	//Appending through O_APPEND (the kernel moves to the end) & positional reads
+	memset(p_record, 'x', RECORD_SIZE);
+	if (-1 == (fileDescriptor = open(p_scratchFilePath, O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0644))) {
+		printf("Error: Failed to create the scratch file\n"); return FALSE;
+	}
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfRecords) && (TRUE == succeeded); iteration++) {
+		succeeded = (RECORD_SIZE == write(fileDescriptor, p_record, RECORD_SIZE));
+	}
+	if (TRUE == succeeded) printMeasurement("Native: O_APPEND write (64 bytes)", readNanoseconds() - start, numberOfRecords);
+
+	start = readNanoseconds();
+	for (iteration = 0; (iteration < numberOfRecords) && (TRUE == succeeded); iteration++) {
+		randomState = randomState * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+		succeeded = (RECORD_SIZE == pread(fileDescriptor, p_record, RECORD_SIZE, (off_t)(((randomState >> 33) % numberOfRecords) * RECORD_SIZE)));
+	}
+	if (TRUE == succeeded) printMeasurement("Native: pread (64 bytes, random)", readNanoseconds() - start, numberOfRecords);
+
+	close(fileDescriptor);
+	unlink(p_scratchFilePath);
+	if (FALSE == succeeded) printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+	return succeeded;
+}
+#endif
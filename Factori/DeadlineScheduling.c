@@ -0,0 +1,387 @@
+/* DeadlineScheduling.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for deadline-aware
+		scheduling: the tasks are dispatched earliest deadline first (by their latest
+		start time, accounting for their estimated cost), a task that can no longer
+		meet its' deadline is demoted or skipped, & the deadlines' misses & slack
+		are reported once solving ends
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "DeadlineScheduling.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORD     CALIBRATION_PRIME = 999999937;		//The largest prime below 10^9 - the most expensive task for trial division
+static const DWORD     CALIBRATION_ROUNDS = 32;
+static const DWORDLONG MICROSECONDS_PER_MILLISECOND = 1000;
+static const DWORDLONG PICOSECONDS_PER_MICROSECOND = 1000000;
+static const LONGLONG  MICROSECONDS_PER_SECOND = 1000000;
+static const DWORD     DEADLINE_REPORT_MAXIMAL_TASKS = 20;	//The most missed or skipped tasks listed in the report
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function reads every position's deadline from the second column of the Tasks Priorities list file's lines (mapped).
+///		As when the Queue is built, if the file has fewer lines than tasks, the last line's deadline is repeated.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct (with its' deadlines allocated)"></param>
+/// <param name="char* p_tasksPrioritiesListFilePath - A pointer to the Tasks Priorities list file's path"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL readDeadlinesFromPrioritiesFile(deadlineSchedule* p_deadlineSchedule, char* p_tasksPrioritiesListFilePath);
+/// <summary>
+///  Description - This function measures the cost of a single trial division, by timing the factorization of the most expensive task.
+/// </summary>
+/// <returns>The cost of a single trial division in pico-seconds (at least 1), or 0 if the calibration failed</returns>
+static DWORDLONG calibratePicosecondsPerDivision();
+/// <summary>
+///  Description - This function estimates the number of trial divisions factorizing a task takes at most (half the floor square root).
+/// </summary>
+/// <param name="DWORDLONG value - The task's value"></param>
+/// <returns>The estimated number of trial divisions</returns>
+static DWORDLONG estimateNumberOfDivisions(DWORDLONG value);
+/// <summary>
+///  Description - This function measures the time elapsed since solving began.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct"></param>
+/// <returns>The elapsed time in micro-seconds</returns>
+static LONGLONG elapsedMicroseconds(deadlineSchedule* p_deadlineSchedule);
+/// <summary>
+///  Description - qsort comparison function - orders 'prioritizedTask' structs by value (the latest start time), and identical values by position.
+/// </summary>
+/// <param name="const void* p_first - A pointer to the first 'prioritizedTask' struct"></param>
+/// <param name="const void* p_second - A pointer to the second 'prioritizedTask' struct"></param>
+/// <returns>A negative integer if the first precedes the second, a positive integer if it follows it, 0 if they are equal</returns>
+static int compareTasksByLatestStartTime(const void* p_first, const void* p_second);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+BOOL buildDeadlineSchedule(threadPackage* p_params, char* p_tasksPrioritiesListFilePath, BOOL skipPastDeadlineTasks)
+{
+	deadlineSchedule* p_deadlineSchedule = NULL;
+	prioritizedTask* p_tasks = NULL;
+	PDWORDLONG p_values = NULL;
+	DWORDLONG position = 0, numberOfDeadlines = 0;
+	//Input integrity validation
+	if ((NULL == p_params) || ((NULL == p_params->p_tasksContainer) && (NULL == p_tasksPrioritiesListFilePath))) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Fetching all the tasks' values in priority order (before the schedule exists) - the positions cursor (and its' counters) is rewound to dispatch the schedule
+	if (NULL == (p_values = fetchAllTasksInPriorityOrder(p_params))) return STATUS_CODE_FAILURE;
+	p_params->nextTaskPosition = 0;
+	memset((void*)p_params->chunkSizesHistogram, 0, sizeof(p_params->chunkSizesHistogram));
+
+	//Memory allocation for the schedule
+	if (NULL == (p_params->p_deadlineSchedule = p_deadlineSchedule = (deadlineSchedule*)calloc(sizeof(deadlineSchedule), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the deadline schedule.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_values);
+		return STATUS_CODE_FAILURE;
+	}
+	p_deadlineSchedule->p_values = p_values;
+	p_deadlineSchedule->numberOfTasks = p_params->numberOfTasks;
+	p_deadlineSchedule->skipPastDeadlineTasks = skipPastDeadlineTasks;
+
+	//Memory allocation for the per-position columns
+	if ((NULL == (p_deadlineSchedule->p_order = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)p_deadlineSchedule->numberOfTasks + 1))) ||
+		(NULL == (p_deadlineSchedule->p_deadlines = (LPDWORD)calloc(sizeof(DWORD), (size_t)p_deadlineSchedule->numberOfTasks + 1))) ||
+		(NULL == (p_deadlineSchedule->p_estimatedCosts = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)p_deadlineSchedule->numberOfTasks + 1))) ||
+		(NULL == (p_deadlineSchedule->p_finishTimes = (volatile LONGLONG*)calloc(sizeof(LONGLONG), (size_t)p_deadlineSchedule->numberOfTasks + 1))) ||
+		(NULL == (p_deadlineSchedule->p_demotedPositions = (volatile DWORDLONG*)calloc(sizeof(DWORDLONG), (size_t)p_deadlineSchedule->numberOfTasks + 1))) ||
+		(NULL == (p_tasks = (prioritizedTask*)calloc(sizeof(prioritizedTask), (size_t)p_deadlineSchedule->numberOfTasks + 1)))) {
+		printf("Error: Failed to allocate memory for the deadline schedule's columns.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Reading the deadlines - from the container's deadlines column, or from the Tasks Priorities file's second column
+	if (NULL != p_params->p_tasksContainer) {
+		for (position = 0; position < p_deadlineSchedule->numberOfTasks; position++) {
+			if (STATUS_CODE_SUCCESS != fetchContainerDeadlineByPriority(p_params->p_tasksContainer, position, p_deadlineSchedule->p_deadlines + position)) {
+				free(p_tasks);
+				return STATUS_CODE_FAILURE;
+			}
+		}
+	}
+	else if (STATUS_CODE_SUCCESS != readDeadlinesFromPrioritiesFile(p_deadlineSchedule, p_tasksPrioritiesListFilePath)) {
+		free(p_tasks);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Estimating the tasks' costs by the calibrated cost of a trial division
+	if (0 == (p_deadlineSchedule->picosecondsPerDivision = calibratePicosecondsPerDivision())) {
+		free(p_tasks);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Ordering by the latest start time (tasks without deadlines last, in priority order)
+	for (position = 0; position < p_deadlineSchedule->numberOfTasks; position++) {
+		p_deadlineSchedule->p_estimatedCosts[position] = estimateNumberOfDivisions(p_deadlineSchedule->p_values[position]) * p_deadlineSchedule->picosecondsPerDivision / PICOSECONDS_PER_MICROSECOND;
+		p_deadlineSchedule->p_finishTimes[position] = DEADLINE_NOT_FINISHED;
+		p_tasks[position].position = position;
+		if (TASK_DEADLINE_NONE == p_deadlineSchedule->p_deadlines[position]) {
+			p_tasks[position].value = ULLONG_MAX;
+			continue;
+		}
+		numberOfDeadlines++;
+		p_tasks[position].value = (DWORDLONG)p_deadlineSchedule->p_deadlines[position] * MICROSECONDS_PER_MILLISECOND;
+		p_tasks[position].value = (p_tasks[position].value > p_deadlineSchedule->p_estimatedCosts[position]) ? p_tasks[position].value - p_deadlineSchedule->p_estimatedCosts[position] : 0;
+	}
+	qsort(p_tasks, (size_t)p_deadlineSchedule->numberOfTasks, sizeof(prioritizedTask), compareTasksByLatestStartTime);
+	for (position = 0; position < p_deadlineSchedule->numberOfTasks; position++) p_deadlineSchedule->p_order[position] = p_tasks[position].position;
+	free(p_tasks);
+
+	printf("Deadline schedule built: %llu of %llu tasks have deadlines, a trial division is estimated at %llu ps.\n",
+		numberOfDeadlines, p_deadlineSchedule->numberOfTasks, p_deadlineSchedule->picosecondsPerDivision);
+	return STATUS_CODE_SUCCESS;
+}
+
+void startDeadlineClock(deadlineSchedule* p_deadlineSchedule)
+{
+	//Input integrity validation
+	if (NULL == p_deadlineSchedule) return;
+
+	QueryPerformanceFrequency(&(p_deadlineSchedule->counterFrequency));
+	QueryPerformanceCounter(&(p_deadlineSchedule->startCounter));
+}
+
+BOOL admitScheduledPosition(deadlineSchedule* p_deadlineSchedule, DWORDLONG dispatchIndex, PDWORDLONG p_position)
+{
+	DWORDLONG position = 0;
+	LONGLONG demotedIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_deadlineSchedule) || (dispatchIndex >= p_deadlineSchedule->numberOfTasks) || (NULL == p_position)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+	position = p_deadlineSchedule->p_order[dispatchIndex];
+
+	//A task without a deadline, or one that may still meet it, is admitted
+	if ((TASK_DEADLINE_NONE == p_deadlineSchedule->p_deadlines[position]) ||
+		(elapsedMicroseconds(p_deadlineSchedule) + (LONGLONG)p_deadlineSchedule->p_estimatedCosts[position] <=
+		(LONGLONG)p_deadlineSchedule->p_deadlines[position] * (LONGLONG)MICROSECONDS_PER_MILLISECOND)) {
+		*p_position = position;
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//Past its' deadline - skipped, or appended to the demoted tasks (the entry is reserved first, then written)
+	if (TRUE == p_deadlineSchedule->skipPastDeadlineTasks) InterlockedIncrement(&(p_deadlineSchedule->numberOfSkippedTasks));
+	else {
+		demotedIndex = InterlockedIncrement64(&(p_deadlineSchedule->numberOfDemotedPositions)) - 1;
+		p_deadlineSchedule->p_demotedPositions[demotedIndex] = position + 1;
+	}
+	return DEADLINE_SCHEDULE_DEFERRED;
+}
+
+BOOL takeDemotedPosition(deadlineSchedule* p_deadlineSchedule, PDWORDLONG p_position)
+{
+	LONGLONG claimedIndex = 0;
+	DWORDLONG entry = 0;
+	//Input integrity validation
+	if ((NULL == p_deadlineSchedule) || (NULL == p_position)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Claiming the next demoted entry, never past the reserved entries - a claim never goes to waste
+	do {
+		claimedIndex = InterlockedCompareExchange64(&(p_deadlineSchedule->nextDemotedPosition), 0, 0); //Atomic 64-bit read (also on 32-bit builds)
+		if (claimedIndex >= InterlockedCompareExchange64(&(p_deadlineSchedule->numberOfDemotedPositions), 0, 0)) return DEADLINE_SCHEDULE_EXHAUSTED;
+	} while (claimedIndex != InterlockedCompareExchange64(&(p_deadlineSchedule->nextDemotedPosition), claimedIndex + 1, claimedIndex));
+
+	//The entry may be reserved but not written yet - its' writer is about to write it
+	while (0 == (entry = p_deadlineSchedule->p_demotedPositions[claimedIndex])) YieldProcessor();
+	*p_position = entry - 1;
+	return STATUS_CODE_SUCCESS;
+}
+
+void recordDeadlineFinish(deadlineSchedule* p_deadlineSchedule, DWORDLONG position)
+{
+	//Input integrity validation
+	if ((NULL == p_deadlineSchedule) || (position >= p_deadlineSchedule->numberOfTasks)) return;
+
+	p_deadlineSchedule->p_finishTimes[position] = elapsedMicroseconds(p_deadlineSchedule);
+}
+
+void printDeadlineReport(deadlineSchedule* p_deadlineSchedule)
+{
+	DWORDLONG position = 0, numberOfMet = 0, numberOfMissed = 0, numberOfSkipped = 0, numberOfListed = 0;
+	LONGLONG slack = 0, minimalSlack = LLONG_MAX, totalSlack = 0, deadline = 0;
+	//Input integrity validation
+	if (NULL == p_deadlineSchedule) return;
+
+	printf("Deadlines (earliest latest start time first, past-deadline tasks %s):\n", (TRUE == p_deadlineSchedule->skipPastDeadlineTasks) ? "skipped" : "demoted");
+	for (position = 0; position < p_deadlineSchedule->numberOfTasks; position++) {
+		if (TASK_DEADLINE_NONE == p_deadlineSchedule->p_deadlines[position]) continue;
+		deadline = (LONGLONG)p_deadlineSchedule->p_deadlines[position] * (LONGLONG)MICROSECONDS_PER_MILLISECOND;
+
+		//A task that wasn't written was skipped
+		if (DEADLINE_NOT_FINISHED == p_deadlineSchedule->p_finishTimes[position]) {
+			numberOfSkipped++;
+			if (DEADLINE_REPORT_MAXIMAL_TASKS > numberOfListed++)
+				printf("\tTask %llu (priority %llu): deadline %lu ms - skipped\n", p_deadlineSchedule->p_values[position], position, (unsigned long)p_deadlineSchedule->p_deadlines[position]);
+			continue;
+		}
+
+		//Slack - the time left between the finish & the deadline (negative - missed)
+		slack = deadline - p_deadlineSchedule->p_finishTimes[position];
+		totalSlack += slack;
+		if (slack < minimalSlack) minimalSlack = slack;
+		if (0 <= slack) {
+			numberOfMet++;
+			continue;
+		}
+		numberOfMissed++;
+		if (DEADLINE_REPORT_MAXIMAL_TASKS > numberOfListed++)
+			printf("\tTask %llu (priority %llu): deadline %lu ms, finished at %.3f ms - %.3f ms late\n", p_deadlineSchedule->p_values[position], position,
+				(unsigned long)p_deadlineSchedule->p_deadlines[position], (double)p_deadlineSchedule->p_finishTimes[position] / MICROSECONDS_PER_MILLISECOND, (double)-slack / MICROSECONDS_PER_MILLISECOND);
+	}
+	if (DEADLINE_REPORT_MAXIMAL_TASKS < numberOfListed) printf("\t... and %llu more\n", numberOfListed - DEADLINE_REPORT_MAXIMAL_TASKS);
+
+	printf("%llu deadlines met, %llu missed, %llu skipped, %lld demoted", numberOfMet, numberOfMissed, numberOfSkipped, p_deadlineSchedule->numberOfDemotedPositions);
+	if (0 < numberOfMet + numberOfMissed)
+		printf(" - slack: minimal %.3f ms, average %.3f ms", (double)minimalSlack / MICROSECONDS_PER_MILLISECOND,
+			(double)totalSlack / (LONGLONG)(numberOfMet + numberOfMissed) / MICROSECONDS_PER_MILLISECOND);
+	printf("\n\n");
+}
+
+void destroyDeadlineSchedule(deadlineSchedule** p_p_deadlineSchedule)
+{
+	//Input integrity validation
+	if ((NULL == p_p_deadlineSchedule) || (NULL == *p_p_deadlineSchedule)) return;
+
+	//Free the columns & the struct (a failed build leaves some of them NULL)
+	free((*p_p_deadlineSchedule)->p_order);
+	free((*p_p_deadlineSchedule)->p_deadlines);
+	free((*p_p_deadlineSchedule)->p_estimatedCosts);
+	free((*p_p_deadlineSchedule)->p_values);
+	free((void*)(*p_p_deadlineSchedule)->p_finishTimes);
+	free((void*)(*p_p_deadlineSchedule)->p_demotedPositions);
+	free(*p_p_deadlineSchedule);
+	*p_p_deadlineSchedule = NULL;
+}
+
+LONGLONG counterTicksToMicroseconds(LONGLONG ticks, LONGLONG frequency)
+{
+	//Assert
+	assert(0 < frequency);
+
+	//Whole seconds first - multiplying all the ticks by 10^6 overflows after ~2.5 hours of a 1 GHz counter
+	return (ticks / frequency) * MICROSECONDS_PER_SECOND + (ticks % frequency) * MICROSECONDS_PER_SECOND / frequency;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static BOOL readDeadlinesFromPrioritiesFile(deadlineSchedule* p_deadlineSchedule, char* p_tasksPrioritiesListFilePath)
+{
+	mappedFile* p_mappedPrioritiesFile = NULL;
+	DWORDLONG position = 0, lineOffset = 0, nextLineOffset = 0, taskOffset = 0, deadline = TASK_DEADLINE_NONE;
+	//Asserts
+	assert(NULL != p_deadlineSchedule);
+	assert(NULL != p_tasksPrioritiesListFilePath);
+
+	//Mapping the entire Tasks Priorities list file
+	if (NULL == (p_mappedPrioritiesFile = mapFileForReading(p_tasksPrioritiesListFilePath, 0))) return STATUS_CODE_FAILURE;
+
+	//Parsing the lines' second column, unless the file's lines ran out (the last line's deadline is repeated)
+	for (position = 0; position < p_deadlineSchedule->numberOfTasks; position++) {
+		if (lineOffset < p_mappedPrioritiesFile->numberOfBytes) {
+			if (FALSE == parseLineColumnFromMappedFile(p_mappedPrioritiesFile, lineOffset, 1, &deadline)) deadline = TASK_DEADLINE_NONE;
+			else if (TASK_DEADLINE_NONE <= deadline) {
+				printf("Error: The deadline %llu at line %llu of the Tasks Priorities list file exceeds the supported deadlines' range.\n", deadline, position);
+				unmapFile(&p_mappedPrioritiesFile);
+				return STATUS_CODE_FAILURE;
+			}
+			parseNumberFromMappedFile(p_mappedPrioritiesFile, lineOffset, &taskOffset, &nextLineOffset);
+			lineOffset = nextLineOffset;
+		}
+		p_deadlineSchedule->p_deadlines[position] = (DWORD)deadline;
+	}
+
+	//The Tasks Priorities list file has no need anymore
+	unmapFile(&p_mappedPrioritiesFile);
+	return STATUS_CODE_SUCCESS;
+}
+
+static DWORDLONG calibratePicosecondsPerDivision()
+{
+	LARGE_INTEGER frequency, before, after;
+	factorizedString* p_solution = NULL;
+	DWORD round = 0;
+	DWORDLONG elapsedMicroseconds = 0, picoseconds = 0;
+
+	//Timing the factorization of the calibration prime (the whole of its' trial divisions)
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&before);
+	for (round = 0; round < CALIBRATION_ROUNDS; round++) {
+		if (NULL == (p_solution = receivePrimeFactorizedListString(CALIBRATION_PRIME))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			return 0;
+		}
+		freeTheString(p_solution);
+	}
+	QueryPerformanceCounter(&after);
+
+	//Pico-seconds per division (rounded up to 1)
+	elapsedMicroseconds = (DWORDLONG)counterTicksToMicroseconds(after.QuadPart - before.QuadPart, frequency.QuadPart);
+	picoseconds = elapsedMicroseconds * PICOSECONDS_PER_MICROSECOND / (CALIBRATION_ROUNDS * estimateNumberOfDivisions(CALIBRATION_PRIME));
+	return (0 < picoseconds) ? picoseconds : 1;
+}
+
+static DWORDLONG estimateNumberOfDivisions(DWORDLONG value)
+{
+	DWORDLONG low = 0, high = 0, middle = 0;
+
+	//Floor square root by binary search (values are at most 32-bit, so the square of the middle never overflows)
+	high = (value < MAXDWORD) ? value : MAXDWORD;
+	while (low < high) {
+		middle = low + (high - low + 1) / 2;
+		if (middle * middle <= value) low = middle;
+		else high = middle - 1;
+	}
+
+	//Only odd divisors are tried
+	return low / 2 + 1;
+}
+
+static LONGLONG elapsedMicroseconds(deadlineSchedule* p_deadlineSchedule)
+{
+	LARGE_INTEGER now;
+	//Assert
+	assert(NULL != p_deadlineSchedule);
+
+	QueryPerformanceCounter(&now);
+	return counterTicksToMicroseconds(now.QuadPart - p_deadlineSchedule->startCounter.QuadPart, p_deadlineSchedule->counterFrequency.QuadPart);
+}
+
+static int compareTasksByLatestStartTime(const void* p_first, const void* p_second)
+{
+	const prioritizedTask* p_firstTask = (const prioritizedTask*)p_first;
+	const prioritizedTask* p_secondTask = (const prioritizedTask*)p_second;
+
+	if (p_firstTask->value != p_secondTask->value) return (p_firstTask->value < p_secondTask->value) ? -1 : 1;
+	if (p_firstTask->position == p_secondTask->position) return 0;
+	return (p_firstTask->position < p_secondTask->position) ? -1 : 1;
+}
@@ -0,0 +1,92 @@
+/* DeadlineScheduling.h
+--------------------------------------------------------------
+	Module Description - header module for DeadlineScheduling.c
+--------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __DEADLINE_SCHEDULING_H__
+#define __DEADLINE_SCHEDULING_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MemoryHandling.h"
+#include "MappedFile.h"
+#include "TasksContainer.h"
+#include "TasksSolverThread.h"
+#include "ReceivePrimeFactorizedListString.h"
+
+
+// Constants ---------------------------------------------------
+#define DEADLINE_SCHEDULE_DEFERRED 2		// admitScheduledPosition(.)'s outcome when the task can no longer meet its' deadline (it was demoted or skipped)
+#define DEADLINE_SCHEDULE_EXHAUSTED 3		// takeDemotedPosition(.)'s outcome when no demoted task is left to claim
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the earliest deadline first schedule: it fetches the values of all the tasks to solve (the cursor is
+///		rewound afterwards), reads every position's deadline (the second column of the Tasks Priorities file's lines, or the container's
+///		deadlines column), estimates every task's cost by a calibrated cost of a trial division & sorts the positions by their latest
+///		start time (deadline - estimated cost). The tasks without deadlines follow, in priority order.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <param name="char* p_tasksPrioritiesListFilePath - A pointer to the Tasks Priorities list file's path (unused with a tasks container)"></param>
+/// <param name="BOOL skipPastDeadlineTasks - TRUE for skipping the tasks that can no longer meet their deadlines, FALSE for demoting them"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL buildDeadlineSchedule(threadPackage* p_params, char* p_tasksPrioritiesListFilePath, BOOL skipPastDeadlineTasks);
+/// <summary>
+///	 Description - This function marks the moment solving begins - the deadlines are measured from it.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct"></param>
+void startDeadlineClock(deadlineSchedule* p_deadlineSchedule);
+/// <summary>
+///	 Description - This function translates a claimed dispatch index to its' position & admits the task, unless it can no longer meet its'
+///		deadline (the elapsed time & its' estimated cost pass the deadline) - such a task is appended to the demoted tasks, or skipped.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct"></param>
+/// <param name="DWORDLONG dispatchIndex - The index claimed from the shared cursor"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the admitted task's position"></param>
+/// <returns>Admitted (TRUE), DEADLINE_SCHEDULE_DEFERRED or Failure (FALSE)</returns>
+BOOL admitScheduledPosition(deadlineSchedule* p_deadlineSchedule, DWORDLONG dispatchIndex, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function claims the next demoted task (compare-and-swap, never past the demoted tasks appended so far). The thread
+///		that demotes a task always claims demoted tasks before it finishes, so no demoted task is left behind.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the demoted task's position"></param>
+/// <returns>Claimed (TRUE), DEADLINE_SCHEDULE_EXHAUSTED or Failure (FALSE)</returns>
+BOOL takeDemotedPosition(deadlineSchedule* p_deadlineSchedule, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function records the time a task's solution was written.
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct"></param>
+/// <param name="DWORDLONG position - The solved task's position"></param>
+void recordDeadlineFinish(deadlineSchedule* p_deadlineSchedule, DWORDLONG position);
+/// <summary>
+///	 Description - This function prints the deadlines' report: how many tasks met, missed or were skipped past their deadlines, the minimal
+///		& average slack (deadline - finish time), & every missed or skipped task (up to a limit).
+/// </summary>
+/// <param name="deadlineSchedule* p_deadlineSchedule - A pointer to a deadlineSchedule struct (after all the threads finished)"></param>
+void printDeadlineReport(deadlineSchedule* p_deadlineSchedule);
+/// <summary>
+///	 Description - This function frees a deadline schedule & sets its' pointer to NULL.
+/// </summary>
+/// <param name="deadlineSchedule** p_p_deadlineSchedule - A pointer to a pointer to a 'deadlineSchedule' struct"></param>
+void destroyDeadlineSchedule(deadlineSchedule** p_p_deadlineSchedule);
+/// <summary>
+///	 Description - This function converts a performance counter's ticks to micro-seconds, without overflowing on long runs.
+/// </summary>
+/// <param name="LONGLONG ticks - The # of counted ticks"></param>
+/// <param name="LONGLONG frequency - The counter's frequency (ticks per second, as QueryPerformanceFrequency(.) returns)"></param>
+/// <returns>The # of micro-seconds</returns>
+LONGLONG counterTicksToMicroseconds(LONGLONG ticks, LONGLONG frequency);
+
+
+#endif //__DEADLINE_SCHEDULING_H__
@@ -0,0 +1,158 @@
+/* DeferredWrites.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling the deferred
+		writes: every worker keeps its' solutions in a private backlog, which it writes
+		to the Tasks file whenever the file's lock is vacant, instead of waiting for the
+		lock after every task
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <Windows.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "DeferredWrites.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+deferredWrites* buildDeferredWrites(DWORD flushThreshold)
+{
+	deferredWrites* p_deferredWrites = NULL;
+	//Input integrity validation
+	if (0 == flushThreshold) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the policy (zeroed statistics)
+	if (NULL == (p_deferredWrites = (deferredWrites*)calloc(sizeof(deferredWrites), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the deferred writes.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	p_deferredWrites->flushThreshold = flushThreshold;
+	return p_deferredWrites;
+}
+
+deferredWritesBacklog* createDeferredWritesBacklog(deferredWrites* p_deferredWrites)
+{
+	deferredWritesBacklog* p_backlog = NULL;
+	//Input integrity validation
+	if (NULL == p_deferredWrites) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the backlog & its' entries (a full backlog is written before another solution is deferred)
+	if ((NULL == (p_backlog = (deferredWritesBacklog*)calloc(sizeof(deferredWritesBacklog), SINGLE_OBJECT))) ||
+		(NULL == (p_backlog->p_entries = (deferredWrite*)calloc(sizeof(deferredWrite), p_deferredWrites->flushThreshold)))) {
+		printf("Error: Failed to allocate memory for a deferred writes' backlog.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		destroyDeferredWritesBacklog(&p_backlog);
+		return NULL;
+	}
+	p_backlog->flushThreshold = p_deferredWrites->flushThreshold;
+	return p_backlog;
+}
+
+BOOL deferSolvedTask(deferredWritesBacklog* p_backlog, factorizedString* p_solution, DWORDLONG numberOfOccurrences, DWORDLONG position)
+{
+	deferredWrite* p_entry = NULL;
+	//Input integrity validation
+	if ((NULL == p_backlog) || (NULL == p_solution)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+	if (p_backlog->numberOfEntries >= p_backlog->flushThreshold) {
+		printf("Error: Thread no. %lu deferred a solution to a full backlog.\n", (unsigned long)GetCurrentThreadId());
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Appending the solution - the worker's own backlog (no lock)
+	p_entry = p_backlog->p_entries + p_backlog->numberOfEntries++;
+	p_entry->p_solution = p_solution;
+	p_entry->numberOfOccurrences = numberOfOccurrences;
+	p_entry->position = position;
+	return STATUS_CODE_SUCCESS;
+}
+
+void recordDeferredWritesFlush(deferredWrites* p_deferredWrites, DWORD numberOfSolutions, BOOL forced)
+{
+	LONG maximalFlushSize = 0;
+	//Input integrity validation
+	if ((NULL == p_deferredWrites) || (0 == numberOfSolutions)) return;
+
+	InterlockedIncrement((TRUE == forced) ? &(p_deferredWrites->numberOfForcedFlushes) : &(p_deferredWrites->numberOfOpportunisticFlushes));
+	InterlockedExchangeAdd64(&(p_deferredWrites->numberOfFlushedSolutions), (LONGLONG)numberOfSolutions);
+	//Raising the largest flush (retrying if another worker raised it meanwhile)
+	while ((maximalFlushSize = p_deferredWrites->maximalFlushSize) < (LONG)numberOfSolutions)
+		if (maximalFlushSize == InterlockedCompareExchange(&(p_deferredWrites->maximalFlushSize), (LONG)numberOfSolutions, maximalFlushSize)) break;
+}
+
+void recordDeferredWritesSkip(deferredWrites* p_deferredWrites)
+{
+	//Input integrity validation
+	if (NULL == p_deferredWrites) return;
+
+	InterlockedIncrement(&(p_deferredWrites->numberOfSkippedFlushes));
+}
+
+void clearDeferredWritesBacklog(deferredWritesBacklog* p_backlog)
+{
+	DWORD entryIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_backlog) || (NULL == p_backlog->p_entries)) return;
+
+	for (entryIndex = 0; entryIndex < p_backlog->numberOfEntries; entryIndex++) {
+		freeTheString(p_backlog->p_entries[entryIndex].p_solution);
+		p_backlog->p_entries[entryIndex].p_solution = NULL;
+	}
+	p_backlog->numberOfEntries = 0;
+}
+
+void printDeferredWritesStatistics(deferredWrites* p_deferredWrites)
+{
+	LONG numberOfFlushes = 0;
+	//Input integrity validation
+	if (NULL == p_deferredWrites) return;
+
+	numberOfFlushes = p_deferredWrites->numberOfOpportunisticFlushes + p_deferredWrites->numberOfForcedFlushes;
+	printf("Deferred writes: threshold of %lu solutions, %ld flushes while the lock was vacant, %ld forced flushes, %ld flushes skipped (lock busy)\n",
+		(unsigned long)p_deferredWrites->flushThreshold, (long)p_deferredWrites->numberOfOpportunisticFlushes, (long)p_deferredWrites->numberOfForcedFlushes,
+		(long)p_deferredWrites->numberOfSkippedFlushes);
+	if (0 < numberOfFlushes)
+		printf("\t%lld solutions written, %.2f per flush on average, at most %ld in a single flush\n",
+			p_deferredWrites->numberOfFlushedSolutions, (double)p_deferredWrites->numberOfFlushedSolutions / numberOfFlushes, (long)p_deferredWrites->maximalFlushSize);
+	printf("\n");
+}
+
+void destroyDeferredWritesBacklog(deferredWritesBacklog** p_p_backlog)
+{
+	//Input integrity validation
+	if ((NULL == p_p_backlog) || (NULL == *p_p_backlog)) return;
+
+	//Free the solutions that were never written (the worker failed), the entries & the backlog
+	clearDeferredWritesBacklog(*p_p_backlog);
+	free((*p_p_backlog)->p_entries);
+	free(*p_p_backlog);
+	*p_p_backlog = NULL;
+}
+
+void destroyDeferredWrites(deferredWrites** p_p_deferredWrites)
+{
+	//Input integrity validation
+	if ((NULL == p_p_deferredWrites) || (NULL == *p_p_deferredWrites)) return;
+
+	free(*p_p_deferredWrites);
+	*p_p_deferredWrites = NULL;
+}
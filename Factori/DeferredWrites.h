@@ -0,0 +1,79 @@
+/* DeferredWrites.h
+----------------------------------------------------------
+	Module Description - header module for DeferredWrites.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __DEFERRED_WRITES_H__
+#define __DEFERRED_WRITES_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MemoryHandling.h"
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the deferred writes' policy, with zeroed statistics.
+/// </summary>
+/// <param name="DWORD flushThreshold - The # of solutions a worker may hold before it must wait for the Tasks file's lock (at least 1)"></param>
+/// <returns>A pointer to a dynamically allocated 'deferredWrites' struct if successful, or NULL if failed</returns>
+deferredWrites* buildDeferredWrites(DWORD flushThreshold);
+/// <summary>
+///	 Description - This function creates an empty backlog for a worker, with room for the policy's threshold of solutions.
+/// </summary>
+/// <param name="deferredWrites* p_deferredWrites - A pointer to the deferred writes' policy"></param>
+/// <returns>A pointer to a dynamically allocated 'deferredWritesBacklog' struct if successful, or NULL if failed</returns>
+deferredWritesBacklog* createDeferredWritesBacklog(deferredWrites* p_deferredWrites);
+/// <summary>
+///	 Description - This function appends a solved task's solution to the worker's backlog (the backlog owns the solution from now on).
+/// </summary>
+/// <param name="deferredWritesBacklog* p_backlog - A pointer to the worker's backlog (not full)"></param>
+/// <param name="factorizedString* p_solution - A pointer to the task's solution"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the solution is written"></param>
+/// <param name="DWORDLONG position - The solved task's position (dispatch order)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) if the backlog is full</returns>
+BOOL deferSolvedTask(deferredWritesBacklog* p_backlog, factorizedString* p_solution, DWORDLONG numberOfOccurrences, DWORDLONG position);
+/// <summary>
+///	 Description - This function records a written backlog in the policy's statistics (atomic increments).
+/// </summary>
+/// <param name="deferredWrites* p_deferredWrites - A pointer to the deferred writes' policy"></param>
+/// <param name="DWORD numberOfSolutions - The # of solutions written"></param>
+/// <param name="BOOL forced - The worker waited for the lock (TRUE) or found it vacant (FALSE)"></param>
+void recordDeferredWritesFlush(deferredWrites* p_deferredWrites, DWORD numberOfSolutions, BOOL forced);
+/// <summary>
+///	 Description - This function records a flush the worker gave up on, since the lock was busy & the backlog wasn't full.
+/// </summary>
+/// <param name="deferredWrites* p_deferredWrites - A pointer to the deferred writes' policy"></param>
+void recordDeferredWritesSkip(deferredWrites* p_deferredWrites);
+/// <summary>
+///	 Description - This function frees the solutions in the worker's backlog & empties it.
+/// </summary>
+/// <param name="deferredWritesBacklog* p_backlog - A pointer to the worker's backlog"></param>
+void clearDeferredWritesBacklog(deferredWritesBacklog* p_backlog);
+/// <summary>
+///	 Description - This function prints the deferred writes' statistics - the flushes by kind, the skipped ones & the flushes' sizes.
+/// </summary>
+/// <param name="deferredWrites* p_deferredWrites - A pointer to the deferred writes' policy (NULL - nothing is printed)"></param>
+void printDeferredWritesStatistics(deferredWrites* p_deferredWrites);
+/// <summary>
+///	 Description - This function frees a worker's backlog with any solutions left in it & sets its' pointer to NULL.
+/// </summary>
+/// <param name="deferredWritesBacklog** p_p_backlog - A pointer to a pointer to a 'deferredWritesBacklog' struct"></param>
+void destroyDeferredWritesBacklog(deferredWritesBacklog** p_p_backlog);
+/// <summary>
+///	 Description - This function frees the deferred writes' policy & sets its' pointer to NULL.
+/// </summary>
+/// <param name="deferredWrites** p_p_deferredWrites - A pointer to a pointer to a 'deferredWrites' struct"></param>
+void destroyDeferredWrites(deferredWrites** p_p_deferredWrites);
+
+
+#endif //__DEFERRED_WRITES_H__
@@ -0,0 +1,330 @@
+/* EliasFanoIndex.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for building & querying an
+		Elias-Fano index - a compressed representation of a monotone sequence of values
+		(e.g. the initial byte positions of a file's lines), which supports both select
+		(position -> value) & rank (value -> position) in a few memory accesses.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "EliasFanoIndex.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORD BITS_PER_WORD = 64;
+static const DWORDLONG SAMPLING_RATE = 256;		//A position sample is kept for every 256 set bits (and every 256 cleared bits)
+
+static const DWORDLONG SELECT_OUT_OF_BOUNDS = ULLONG_MAX;
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function counts the set bits within a 64-bit word (SWAR population count - portable to x86 as well)
+/// </summary>
+/// <param name="DWORDLONG word - A 64-bit word"></param>
+/// <returns>The number of set bits in the word</returns>
+static DWORD countSetBits(DWORDLONG word);
+/// <summary>
+///  Description - This function returns the bit position (0-63) of the 'rank'-th (0-based) set bit within a 64-bit word.
+///		The word must contain more than 'rank' set bits.
+/// </summary>
+/// <param name="DWORDLONG word - A 64-bit word"></param>
+/// <param name="DWORD rank - The (0-based) rank of the desired set bit"></param>
+/// <returns>The position of the set bit within the word</returns>
+static DWORD selectSetBitInWord(DWORDLONG word, DWORD rank);
+/// <summary>
+///  Description - This function locates the position of the 'rank'-th (0-based) set bit, or cleared bit, within the high bits bit-vector.
+///		The search begins at the closest sample & continues word by word using population counts.
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to a finalized 'eliasFanoIndex' struct"></param>
+/// <param name="DWORDLONG rank - The (0-based) rank of the desired bit"></param>
+/// <param name="BOOL searchSetBits - TRUE for searching set bits, FALSE for searching cleared bits"></param>
+/// <returns>The position of the desired bit within the high bits bit-vector</returns>
+static DWORDLONG selectInHighBits(eliasFanoIndex* p_index, DWORDLONG rank, BOOL searchSetBits);
+/// <summary>
+///  Description - This function reads the low bits of the value at position 'position' from the packed low bits array.
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to an 'eliasFanoIndex' struct"></param>
+/// <param name="DWORDLONG position - The (0-based) position of the value"></param>
+/// <returns>The low bits of the value</returns>
+static DWORDLONG readLowBits(eliasFanoIndex* p_index, DWORDLONG position);
+
+
+
+// Functions definitions ------------------------------------------------------------------
+eliasFanoIndex* InitializeEliasFanoIndex(DWORDLONG numberOfValues, DWORDLONG universe)
+{
+	eliasFanoIndex* p_index = NULL;
+	DWORDLONG lowBitsWords = 0, highBitsWords = 0, ratio = 0;
+	//Input integrity validation
+	if ((0 == numberOfValues) || (0 == universe)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Index struct dynamic memory allocation
+	if (NULL == (p_index = (eliasFanoIndex*)calloc(sizeof(eliasFanoIndex), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for an Elias-Fano index struct.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	p_index->numberOfValues = numberOfValues;
+	p_index->universe = universe;
+
+	//Choosing the number of low bits as floor(log2(universe/#values)) - this keeps the high bits bit-vector at most 2*#values+1 bits long
+	ratio = universe / numberOfValues;
+	while (ratio > 1) {
+		p_index->lowBitsWidth++;
+		ratio >>= 1;
+	}
+
+	//Allocating the packed low bits array (an additional word so reading a value that crosses a word's boundary is always safe)
+	lowBitsWords = (numberOfValues * p_index->lowBitsWidth + BITS_PER_WORD - 1) / BITS_PER_WORD + 1;
+	if (NULL == (p_index->p_lowBits = (DWORDLONG*)calloc(sizeof(DWORDLONG), (size_t)lowBitsWords))) {
+		printf("Error: Failed to allocate memory for an Elias-Fano index low bits array (%llu words).\n", lowBitsWords);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		DestroyEliasFanoIndex(&p_index);
+		return NULL;
+	}
+
+	//Allocating the high bits bit-vector - a set bit per value & a cleared bit per high bits bucket
+	p_index->highBitsLength = numberOfValues + (universe >> p_index->lowBitsWidth) + 1;
+	highBitsWords = (p_index->highBitsLength + BITS_PER_WORD - 1) / BITS_PER_WORD + 1;
+	if (NULL == (p_index->p_highBits = (DWORDLONG*)calloc(sizeof(DWORDLONG), (size_t)highBitsWords))) {
+		printf("Error: Failed to allocate memory for an Elias-Fano index high bits bit-vector (%llu words).\n", highBitsWords);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		DestroyEliasFanoIndex(&p_index);
+		return NULL;
+	}
+
+	//Memory allocation for the index has been successful
+	return p_index;
+}
+
+
+
+BOOL AppendToEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG value)
+{
+	DWORDLONG lowBits = 0, lowBitsPosition = 0, highBitPosition = 0;
+	DWORD bitOffset = 0;
+	//Input integrity validation
+	if (NULL == p_index) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	//Validating the index isn't full, the value is within the universe & monotonicity is kept
+	if ((p_index->numberOfAppendedValues == p_index->numberOfValues) || (value >= p_index->universe) ||
+		((0 < p_index->numberOfAppendedValues) && (value < p_index->lastAppendedValue))) {
+		printf("Error: Value %llu can't be appended to the Elias-Fano index (#%llu out of %llu).\n", value, p_index->numberOfAppendedValues, p_index->numberOfValues);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Writing the low bits (might cross a word's boundary)
+	if (0 < p_index->lowBitsWidth) {
+		lowBits = value & ((1ULL << p_index->lowBitsWidth) - 1);
+		lowBitsPosition = p_index->numberOfAppendedValues * p_index->lowBitsWidth;
+		bitOffset = (DWORD)(lowBitsPosition % BITS_PER_WORD);
+		*(p_index->p_lowBits + lowBitsPosition / BITS_PER_WORD) |= lowBits << bitOffset;
+		if (bitOffset + p_index->lowBitsWidth > BITS_PER_WORD)
+			*(p_index->p_lowBits + lowBitsPosition / BITS_PER_WORD + 1) |= lowBits >> (BITS_PER_WORD - bitOffset);
+	}
+
+	//Setting the value's bit in the high bits bit-vector: (high bits) cleared bits precede it, and (#values so far) set bits
+	highBitPosition = (value >> p_index->lowBitsWidth) + p_index->numberOfAppendedValues;
+	*(p_index->p_highBits + highBitPosition / BITS_PER_WORD) |= 1ULL << (highBitPosition % BITS_PER_WORD);
+
+	//Updating the construction progress
+	p_index->lastAppendedValue = value;
+	p_index->numberOfAppendedValues++;
+	return STATUS_CODE_SUCCESS;
+}
+
+
+
+BOOL FinalizeEliasFanoIndex(eliasFanoIndex* p_index)
+{
+	DWORDLONG bitPosition = 0, setBitsSeen = 0, clearedBitsSeen = 0, numberOfClearedBits = 0;
+	//Input integrity validation
+	if ((NULL == p_index) || (p_index->numberOfAppendedValues != p_index->numberOfValues)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	//Allocating the samples arrays
+	numberOfClearedBits = p_index->highBitsLength - p_index->numberOfValues;
+	if (NULL == (p_index->p_setBitsSamples = (DWORDLONG*)calloc(sizeof(DWORDLONG), (size_t)(p_index->numberOfValues / SAMPLING_RATE + 1)))) {
+		printf("Error: Failed to allocate memory for an Elias-Fano index select samples.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	if (NULL == (p_index->p_clearedBitsSamples = (DWORDLONG*)calloc(sizeof(DWORDLONG), (size_t)(numberOfClearedBits / SAMPLING_RATE + 1)))) {
+		printf("Error: Failed to allocate memory for an Elias-Fano index rank samples.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Sampling the position of every SAMPLING_RATE-th set bit & cleared bit
+	for (bitPosition = 0; bitPosition < p_index->highBitsLength; bitPosition++) {
+		if (*(p_index->p_highBits + bitPosition / BITS_PER_WORD) & (1ULL << (bitPosition % BITS_PER_WORD))) {
+			if (0 == setBitsSeen % SAMPLING_RATE) *(p_index->p_setBitsSamples + setBitsSeen / SAMPLING_RATE) = bitPosition;
+			setBitsSeen++;
+		}
+		else {
+			if (0 == clearedBitsSeen % SAMPLING_RATE) *(p_index->p_clearedBitsSamples + clearedBitsSeen / SAMPLING_RATE) = bitPosition;
+			clearedBitsSeen++;
+		}
+	}
+
+	//The index is ready for select & rank queries
+	return STATUS_CODE_SUCCESS;
+}
+
+
+
+DWORDLONG SelectFromEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG position)
+{
+	DWORDLONG highBitPosition = 0;
+	//Input integrity validation
+	if ((NULL == p_index) || (NULL == p_index->p_setBitsSamples) || (position >= p_index->numberOfValues)) return SELECT_OUT_OF_BOUNDS;
+
+	//The value's high bits equal the number of cleared bits preceding its' set bit
+	highBitPosition = selectInHighBits(p_index, position, TRUE);
+	return ((highBitPosition - position) << p_index->lowBitsWidth) | readLowBits(p_index, position);
+}
+
+
+
+BOOL RankInEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG value, PDWORDLONG p_position)
+{
+	DWORDLONG highBits = 0, lowBits = 0, bitPosition = 0, position = 0, currentLowBits = 0;
+	//Input integrity validation
+	if ((NULL == p_index) || (NULL == p_index->p_clearedBitsSamples) || (NULL == p_position)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return FALSE;
+	}
+	if (value >= p_index->universe) return FALSE;
+
+	//The values with the same high bits are placed in a single bucket which begins right after the (highBits-1)-th cleared bit
+	highBits = value >> p_index->lowBitsWidth;
+	lowBits = value & ((1ULL << p_index->lowBitsWidth) - 1);
+	bitPosition = (0 == highBits) ? 0 : selectInHighBits(p_index, highBits - 1, FALSE) + 1;
+	//Every bit before the bucket is either one of the (highBits) cleared bits or a value's set bit
+	position = bitPosition - highBits;
+
+	//Scanning the bucket (its' values are sorted by their low bits)
+	while ((bitPosition < p_index->highBitsLength) && (*(p_index->p_highBits + bitPosition / BITS_PER_WORD) & (1ULL << (bitPosition % BITS_PER_WORD)))) {
+		currentLowBits = readLowBits(p_index, position);
+		if (currentLowBits == lowBits) {
+			*p_position = position;
+			return TRUE;
+		}
+		if (currentLowBits > lowBits) break;
+		bitPosition++;
+		position++;
+	}
+
+	//The value isn't in the index
+	return FALSE;
+}
+
+
+
+BOOL DestroyEliasFanoIndex(eliasFanoIndex** p_p_index)
+{
+	eliasFanoIndex* p_index = NULL;
+	//Input integrity validation
+	if ((NULL == p_p_index) || (NULL == *p_p_index)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	p_index = *p_p_index;
+
+	//Freeing the index's arrays & the index struct
+	if (NULL != p_index->p_lowBits) free(p_index->p_lowBits);
+	if (NULL != p_index->p_highBits) free(p_index->p_highBits);
+	if (NULL != p_index->p_setBitsSamples) free(p_index->p_setBitsSamples);
+	if (NULL != p_index->p_clearedBitsSamples) free(p_index->p_clearedBitsSamples);
+	free(p_index);
+
+	//Placing NULL to the pointer addressing the index struct
+	*p_p_index = NULL;
+	return STATUS_CODE_SUCCESS;
+}
+
+
+
+//......................................Static functions..........................................
+static DWORD countSetBits(DWORDLONG word)
+{
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (DWORD)((word * 0x0101010101010101ULL) >> 56);
+}
+
+static DWORD selectSetBitInWord(DWORDLONG word, DWORD rank)
+{
+	DWORD bitPosition = 0;
+	//Assert
+	assert(countSetBits(word) > rank);
+	//Clearing the 'rank' lowest set bits
+	while (0 < rank--) word &= word - 1;
+	//The position of the lowest remaining set bit
+	while (0 == (word & 1ULL)) {
+		word >>= 1;
+		bitPosition++;
+	}
+	return bitPosition;
+}
+
+static DWORDLONG selectInHighBits(eliasFanoIndex* p_index, DWORDLONG rank, BOOL searchSetBits)
+{
+	DWORDLONG samplePosition = 0, wordIndex = 0, word = 0, bitsLeftToSkip = 0;
+	DWORD bitsInWord = 0;
+	//Assert
+	assert(NULL != p_index);
+
+	//Beginning from the closest sample (which is the position of the (rank - rank%SAMPLING_RATE)-th bit)
+	samplePosition = searchSetBits ? *(p_index->p_setBitsSamples + rank / SAMPLING_RATE) : *(p_index->p_clearedBitsSamples + rank / SAMPLING_RATE);
+	bitsLeftToSkip = rank % SAMPLING_RATE;
+	if (0 == bitsLeftToSkip) return samplePosition;
+
+	//Scanning the words following the sample - the bits up to (and including) the sample's bit are masked off
+	wordIndex = (samplePosition + 1) / BITS_PER_WORD;
+	word = searchSetBits ? *(p_index->p_highBits + wordIndex) : ~*(p_index->p_highBits + wordIndex);
+	word &= ~0ULL << ((samplePosition + 1) % BITS_PER_WORD);
+	while (TRUE) {
+		bitsInWord = countSetBits(word);
+		if (bitsLeftToSkip <= bitsInWord) return wordIndex * BITS_PER_WORD + selectSetBitInWord(word, (DWORD)(bitsLeftToSkip - 1));
+		bitsLeftToSkip -= bitsInWord;
+		wordIndex++;
+		word = searchSetBits ? *(p_index->p_highBits + wordIndex) : ~*(p_index->p_highBits + wordIndex);
+	}
+}
+
+static DWORDLONG readLowBits(eliasFanoIndex* p_index, DWORDLONG position)
+{
+	DWORDLONG lowBitsPosition = 0, lowBits = 0;
+	DWORD bitOffset = 0;
+	//Assert
+	assert(NULL != p_index);
+	if (0 == p_index->lowBitsWidth) return 0;
+
+	//Reading the (possibly word-crossing) low bits
+	lowBitsPosition = position * p_index->lowBitsWidth;
+	bitOffset = (DWORD)(lowBitsPosition % BITS_PER_WORD);
+	lowBits = *(p_index->p_lowBits + lowBitsPosition / BITS_PER_WORD) >> bitOffset;
+	if (bitOffset + p_index->lowBitsWidth > BITS_PER_WORD)
+		lowBits |= *(p_index->p_lowBits + lowBitsPosition / BITS_PER_WORD + 1) << (BITS_PER_WORD - bitOffset);
+	return lowBits & ((1ULL << p_index->lowBitsWidth) - 1);
+}
@@ -0,0 +1,74 @@
+/* EliasFanoIndex.h
+------------------------------------------------------------
+	Module Description - header module for EliasFanoIndex.c
+------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __ELIAS_FANO_INDEX_H__
+#define __ELIAS_FANO_INDEX_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function allocates memory (on the Heap) for an "eliasFanoIndex" struct that will hold 'numberOfValues' monotone values
+///		which are all smaller than 'universe'. The number of low bits per value is chosen to be floor(log2(universe/numberOfValues)),
+///		and the low bits array & high bits bit-vector are allocated (calloc) accordingly.
+/// </summary>
+/// <param name="DWORDLONG numberOfValues - The exact number of values that will be appended to the index"></param>
+/// <param name="DWORDLONG universe - An upper bound (exclusive) on the values that will be appended to the index"></param>
+/// <returns>A pointer to an initiated 'eliasFanoIndex' struct if successful, or NULL if failed.</returns>
+eliasFanoIndex* InitializeEliasFanoIndex(DWORDLONG numberOfValues, DWORDLONG universe);
+/// <summary>
+///  Description - This function appends the next value to the index. Values must be appended in a non-decreasing order,
+///		and must be smaller than the index's universe.
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to an 'eliasFanoIndex' struct under construction"></param>
+/// <param name="DWORDLONG value - The value to append"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. the value breaks monotonicity or the index is full</returns>
+BOOL AppendToEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG value);
+/// <summary>
+///  Description - This function completes the index construction after all the values were appended, by sampling the positions
+///		of every SAMPLING_RATE-th set bit & cleared bit of the high bits bit-vector (these samples make select & rank fast).
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to an 'eliasFanoIndex' struct whose values were all appended"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL FinalizeEliasFanoIndex(eliasFanoIndex* p_index);
+/// <summary>
+///  Description - This function implements the select operation - it returns the value at position 'position' in the index
+///		(the 'position'-th smallest value, counting from 0).
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to a finalized 'eliasFanoIndex' struct"></param>
+/// <param name="DWORDLONG position - The position (0-based) of the desired value"></param>
+/// <returns>The value at the given position, or ULLONG_MAX if the position is out of the index's bounds</returns>
+DWORDLONG SelectFromEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG position);
+/// <summary>
+///  Description - This function implements the rank operation for a value that is expected to be in the index - it locates
+///		the position of 'value' within the index (e.g. the line number of a line's initial byte position).
+/// </summary>
+/// <param name="eliasFanoIndex* p_index - A pointer to a finalized 'eliasFanoIndex' struct"></param>
+/// <param name="DWORDLONG value - The value to locate"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will hold the (0-based) position of the value"></param>
+/// <returns>A BOOL value representing the function's outcome. Found (TRUE) or Not found (FALSE)</returns>
+BOOL RankInEliasFanoIndex(eliasFanoIndex* p_index, DWORDLONG value, PDWORDLONG p_position);
+/// <summary>
+///  Description - This function destroys the index by releasing any memory allocated to the "eliasFanoIndex" struct and its' arrays.
+///		It also sets the index's pointer to point at NULL address, and returns a final status code of the operation.
+/// </summary>
+/// <param name="eliasFanoIndex** p_p_index - A pointer to a pointer that points at an eliasFanoIndex struct"></param>
+/// <returns>A BOOL value representing the function's outcome (Index mem. is released and its' pointer points at NULL). Success (TRUE) or Failure (False)</returns>
+BOOL DestroyEliasFanoIndex(eliasFanoIndex** p_p_index);
+
+
+#endif //__ELIAS_FANO_INDEX_H__
@@ -34,6 +34,28 @@ static const BOOL STATUS_CODE_SUCCESS = TRUE;
 /// <param name="int* p_argumentNumberAddress - A pointer to the number's integer variable's address"></param>
 /// <returns>A BOOL value representing the function's outcome (conversion). Success (TRUE) or Failure (FALSE)</returns>
 static BOOL fetchArgumentNumber(char* p_commandLineString, int* p_argumentNumberAddress);
+/// <summary>
+/// Description - This function fetches the positive integer value that follows an optional flag (the next commandline argument),
+/// and advances the flags' index past it.
+/// </summary>
+/// <param name="int numberOfFlags - The number of optional command line arguments"></param>
+/// <param name="char* p_flags[] - An array of the optional command line arguments (strings)"></param>
+/// <param name="int* p_flagIndex - A pointer to the index of the flag (updated to the index of its' value)"></param>
+/// <param name="int* p_flagValueAddress - A pointer to the flag's value's integer variable's address"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a missing or non-positive value</returns>
+static BOOL fetchFlagNumber(int numberOfFlags, char* p_flags[], int* p_flagIndex, int* p_flagValueAddress);
+/// <summary>
+/// Description - This function fetches the comma separated list of positive integers that follows an optional flag (the next commandline
+/// argument), and advances the flags' index past it.
+/// </summary>
+/// <param name="int numberOfFlags - The number of optional command line arguments"></param>
+/// <param name="char* p_flags[] - An array of the optional command line arguments (strings)"></param>
+/// <param name="int* p_flagIndex - A pointer to the index of the flag (updated to the index of its' value)"></param>
+/// <param name="int* p_flagValues - A pointer to the array that will be updated with the list's values"></param>
+/// <param name="int maximalNumberOfValues - The most values the array holds"></param>
+/// <param name="int* p_numberOfValuesAddress - A pointer to the variable that will be updated with the # of values in the list"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a non-positive value or too many values</returns>
+static BOOL fetchFlagNumbersList(int numberOfFlags, char* p_flags[], int* p_flagIndex, int* p_flagValues, int maximalNumberOfValues, int* p_numberOfValuesAddress);
 
 
 
@@ -93,6 +115,183 @@ BOOL fetchAndValidateCommandLineArguments(char* p_tasksListFilePath, char* p_tas
 }
 
 
+BOOL fetchOptionalCommandLineFlags(int numberOfFlags, char* p_flags[], solverOptions* p_options)
+{
+	int flagIndex = 0, boundIndex = 0;
+	//Input integrity validation
+	if ((0 > numberOfFlags) || ((0 < numberOfFlags) && (NULL == p_flags)) || (NULL == p_options)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Default solving options
+	memset(p_options, 0, sizeof(solverOptions));
+
+	//Matching every flag to a solving option
+	for (flagIndex = 0; flagIndex < numberOfFlags; flagIndex++) {
+		if (NULL == p_flags[flagIndex]) continue;
+		if (0 == strcmp(p_flags[flagIndex], "--compressed-index")) p_options->compressedLinesIndex = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--verify-checksum")) p_options->verifyContainerChecksum = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--index-cache")) p_options->useLinesIndexCache = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--lazy-subset")) p_options->lazySubset = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--dedup")) p_options->deduplicateTasks = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--work-stealing")) p_options->workStealing = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--speculate-tail")) p_options->speculateTail = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--edf")) p_options->earliestDeadlineFirst = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--no-spin")) p_options->disableSpinning = TRUE;
+		else if (0 == strcmp(p_flags[flagIndex], "--chunk-floor")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->minimalChunkSize))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--chunk-ceiling")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->maximalChunkSize))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--stall-window")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->stallWindowSeconds))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--ordered-output")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->orderedOutputWindow))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--deferred-writes")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->deferredWritesThreshold))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--output-buffer")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->outputBufferSize))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--output-flush-ms")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->outputFlushMilliseconds))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--reserve-appends")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->appendExtensionSize))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--writer-thread")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumber(numberOfFlags, p_flags, &flagIndex, &(p_options->writerRingCapacity))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--feed")) {
+			if ((flagIndex + 1 >= numberOfFlags) || (NULL == p_flags[flagIndex + 1]) || ('\0' == *p_flags[flagIndex + 1])) {
+				printf("Error: The commandline flag '%s' expects a file path.\n", p_flags[flagIndex]);
+				return STATUS_CODE_FAILURE;
+			}
+			p_options->p_tasksFeedPath = p_flags[++flagIndex];
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--profile-locks")) {
+			if ((flagIndex + 1 >= numberOfFlags) || (NULL == p_flags[flagIndex + 1]) || ('\0' == *p_flags[flagIndex + 1])) {
+				printf("Error: The commandline flag '%s' expects a file path.\n", p_flags[flagIndex]);
+				return STATUS_CODE_FAILURE;
+			}
+			p_options->p_lockProfilePath = p_flags[++flagIndex];
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--lanes")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumbersList(numberOfFlags, p_flags, &flagIndex, p_options->laneDigitsBounds, MAX_SIZE_CLASS_LANES - 1, &(p_options->numberOfLaneDigitsBounds))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--lane-shares")) {
+			if (STATUS_CODE_SUCCESS != fetchFlagNumbersList(numberOfFlags, p_flags, &flagIndex, p_options->laneShares, MAX_SIZE_CLASS_LANES, &(p_options->numberOfLaneShares))) return STATUS_CODE_FAILURE;
+		}
+		else if (0 == strcmp(p_flags[flagIndex], "--past-deadline")) {
+			if ((flagIndex + 1 >= numberOfFlags) || (NULL == p_flags[flagIndex + 1]) ||
+				((0 != strcmp(p_flags[flagIndex + 1], "demote")) && (0 != strcmp(p_flags[flagIndex + 1], "skip")))) {
+				printf("Error: The commandline flag '%s' expects 'demote' or 'skip'.\n", p_flags[flagIndex]);
+				return STATUS_CODE_FAILURE;
+			}
+			p_options->skipPastDeadlineTasks = (0 == strcmp(p_flags[++flagIndex], "skip")) ? TRUE : FALSE;
+			p_options->pastDeadlinePolicyGiven = TRUE;
+		}
+		else {
+			printf("Error: Unknown commandline flag '%s'.\n", p_flags[flagIndex]);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//The chunk sizes' range must not be empty
+	if ((0 < p_options->minimalChunkSize) && (p_options->maximalChunkSize < p_options->minimalChunkSize)) {
+		if (0 < p_options->maximalChunkSize) {
+			printf("Error: The chunk floor (%d) exceeds the chunk ceiling (%d).\n", p_options->minimalChunkSize, p_options->maximalChunkSize);
+			return STATUS_CODE_FAILURE;
+		}
+		p_options->maximalChunkSize = p_options->minimalChunkSize;
+	}
+
+	//The runtime tasks feed dispatches from its' own heap, which neither the distinct tasks nor the work stealing deques can follow
+	if ((NULL != p_options->p_tasksFeedPath) && ((TRUE == p_options->deduplicateTasks) || (TRUE == p_options->workStealing))) {
+		printf("Error: The commandline flag '--feed' can't be combined with '--dedup' or '--work-stealing'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//A thread blocked beyond the reorder window may hold (in its' own deque) the very task the window waits for. The reorder sequence counts
+	// distinct tasks, while a de-duplicated task's copies belong at their own priorities - all written at the first copy's place would break the order
+	if ((0 < p_options->orderedOutputWindow) && ((TRUE == p_options->workStealing) || (TRUE == p_options->deduplicateTasks))) {
+		printf("Error: The commandline flag '--ordered-output' can't be combined with '--work-stealing' or '--dedup'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The reorder window's drainer writes the solutions in priority order - a solution held in a backlog would stall the window
+	if ((0 < p_options->deferredWritesThreshold) && (0 < p_options->orderedOutputWindow)) {
+		printf("Error: The commandline flag '--deferred-writes' can't be combined with '--ordered-output'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The output buffers replace the solutions' writes - the reorder window's drainer & the backlogs write every solution on its' own
+	if ((0 < p_options->outputFlushMilliseconds) && (0 == p_options->outputBufferSize)) {
+		printf("Error: The commandline flag '--output-flush-ms' requires '--output-buffer'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+	if ((0 < p_options->outputBufferSize) && ((0 < p_options->orderedOutputWindow) || (0 < p_options->deferredWritesThreshold))) {
+		printf("Error: The commandline flag '--output-buffer' can't be combined with '--ordered-output' or '--deferred-writes'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Reserved appends land in the order of their reservations, with no lock to try - the reorder window & the backlogs rely on the lock
+	if ((0 < p_options->appendExtensionSize) && ((0 < p_options->orderedOutputWindow) || (0 < p_options->deferredWritesThreshold))) {
+		printf("Error: The commandline flag '--reserve-appends' can't be combined with '--ordered-output' or '--deferred-writes'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The writer thread is the Tasks file's only writer - every other output mode writes from the workers themselves
+	if ((0 < p_options->writerRingCapacity) && ((0 < p_options->orderedOutputWindow) || (0 < p_options->deferredWritesThreshold) ||
+		(0 < p_options->outputBufferSize) || (0 < p_options->appendExtensionSize))) {
+		printf("Error: The commandline flag '--writer-thread' can't be combined with '--ordered-output', '--deferred-writes', '--output-buffer' or '--reserve-appends'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The past-deadline policy applies to the deadline schedule only
+	if ((TRUE == p_options->pastDeadlinePolicyGiven) && (FALSE == p_options->earliestDeadlineFirst)) {
+		printf("Error: The commandline flag '--past-deadline' requires '--edf'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The deadline schedule dispatches the tasks' positions - demoted & skipped positions break the distinct tasks, the feed's heap & the reorder sequence
+	if ((TRUE == p_options->earliestDeadlineFirst) &&
+		((TRUE == p_options->deduplicateTasks) || (NULL != p_options->p_tasksFeedPath) || (0 < p_options->orderedOutputWindow))) {
+		printf("Error: The commandline flag '--edf' can't be combined with '--dedup', '--feed' or '--ordered-output'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The lanes' bounds must ascend, and every lane needs a share
+	for (boundIndex = 1; boundIndex < p_options->numberOfLaneDigitsBounds; boundIndex++) {
+		if (p_options->laneDigitsBounds[boundIndex] <= p_options->laneDigitsBounds[boundIndex - 1]) {
+			printf("Error: The size-class lanes' digits bounds must be strictly ascending.\n");
+			return STATUS_CODE_FAILURE;
+		}
+	}
+	if ((0 < p_options->numberOfLaneShares) && (0 == p_options->numberOfLaneDigitsBounds)) {
+		printf("Error: The commandline flag '--lane-shares' requires '--lanes'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+	if ((0 < p_options->numberOfLaneShares) && (p_options->numberOfLaneShares != p_options->numberOfLaneDigitsBounds + 1)) {
+		printf("Error: The commandline flag '--lane-shares' expects a share per lane (%d).\n", p_options->numberOfLaneDigitsBounds + 1);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The lanes replace the dispatch order - the other dispatchers (& the reorder sequence, whose waiting threads may hold the lanes' next tasks) can't follow them
+	if ((0 < p_options->numberOfLaneDigitsBounds) && ((TRUE == p_options->deduplicateTasks) || (TRUE == p_options->workStealing) ||
+		(NULL != p_options->p_tasksFeedPath) || (0 < p_options->orderedOutputWindow) || (TRUE == p_options->earliestDeadlineFirst))) {
+		printf("Error: The commandline flag '--lanes' can't be combined with '--dedup', '--work-stealing', '--feed', '--ordered-output' or '--edf'.\n");
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Retrieving the optional flags was successful...
+	return STATUS_CODE_SUCCESS;
+}
+
+
 
 //......................................Static functions..........................................
 
@@ -111,4 +310,61 @@ static BOOL fetchArgumentNumber(char* p_commandLineString, int* p_argumentNumber
 
 	//Key was retrieved successfuly and is legitimate
 	return STATUS_CODE_SUCCESS;
-}
\ No newline at end of file
+}
+
+static BOOL fetchFlagNumber(int numberOfFlags, char* p_flags[], int* p_flagIndex, int* p_flagValueAddress)
+{
+	//Asserts
+	assert(p_flags != NULL);
+	assert(p_flagIndex != NULL);
+	assert(p_flagValueAddress != NULL);
+
+	//The value is the following commandline argument
+	if ((*p_flagIndex + 1 >= numberOfFlags) || (NULL == p_flags[*p_flagIndex + 1])) {
+		printf("Error: The commandline flag '%s' expects a value.\n", p_flags[*p_flagIndex]);
+		return STATUS_CODE_FAILURE;
+	}
+	if ((STATUS_CODE_SUCCESS != fetchArgumentNumber(p_flags[*p_flagIndex + 1], p_flagValueAddress)) || (0 >= *p_flagValueAddress)) {
+		printf("Error: The commandline flag '%s' expects a positive number.\n", p_flags[*p_flagIndex]);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Skipping the flag's value
+	(*p_flagIndex)++;
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL fetchFlagNumbersList(int numberOfFlags, char* p_flags[], int* p_flagIndex, int* p_flagValues, int maximalNumberOfValues, int* p_numberOfValuesAddress)
+{
+	char* p_character = NULL;
+	//Asserts
+	assert(p_flags != NULL);
+	assert(p_flagIndex != NULL);
+	assert(p_flagValues != NULL);
+	assert(p_numberOfValuesAddress != NULL);
+
+	//The list is the following commandline argument
+	if ((*p_flagIndex + 1 >= numberOfFlags) || (NULL == p_flags[*p_flagIndex + 1])) {
+		printf("Error: The commandline flag '%s' expects a value.\n", p_flags[*p_flagIndex]);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Scanning the values one by one - every value is a positive number, followed by a comma or the list's end
+	*p_numberOfValuesAddress = 0;
+	for (p_character = p_flags[*p_flagIndex + 1]; ; p_character++) {
+		if (*p_numberOfValuesAddress >= maximalNumberOfValues) {
+			printf("Error: The commandline flag '%s' accepts at most %d values.\n", p_flags[*p_flagIndex], maximalNumberOfValues);
+			return STATUS_CODE_FAILURE;
+		}
+		if ((STATUS_CODE_SUCCESS != fetchArgumentNumber(p_character, p_flagValues + *p_numberOfValuesAddress)) || (0 >= p_flagValues[*p_numberOfValuesAddress])) {
+			printf("Error: The commandline flag '%s' expects a comma separated list of positive numbers.\n", p_flags[*p_flagIndex]);
+			return STATUS_CODE_FAILURE;
+		}
+		(*p_numberOfValuesAddress)++;
+		if (NULL == (p_character = strchr(p_character, ','))) break;
+	}
+
+	//Skipping the flag's value
+	(*p_flagIndex)++;
+	return STATUS_CODE_SUCCESS;
+}
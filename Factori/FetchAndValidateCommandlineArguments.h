@@ -39,4 +39,36 @@ BOOL fetchAndValidateCommandLineArguments(char* p_tasksListFilePath, char* p_tas
 	char* p_commandLineNumberOfTasksString, int* p_numberOfTasksAddress,
 	char* p_commandLineNumberOfThreadsString, int* p_numberOfThreadsAddress);
 
+/// <summary>
+/// Description - This function receives the optional command line flags (every argument following the mandatory ones)
+///		and updates the solving options accordingly. Options that aren't received keep their default values.
+///		Supported flags: "--compressed-index" - frame the input files into Elias-Fano compressed lines' offsets indexes.
+///						 "--verify-checksum" - validate a tasks container's checksum before solving.
+///						 "--index-cache" - reuse (or extend) the input files' frames persisted in sidecar files.
+///						 "--lazy-subset" - parse only the prioritized lines from mapped views of the input files (no framing).
+///						 "--dedup" - solve every distinct task value once & write its' solution for every occurrence.
+///						 "--chunk-floor <n>", "--chunk-ceiling <n>" - claim runs of [n_floor, n_ceiling] consecutive tasks at once (guided).
+///						 "--work-stealing" - dispatch from per-thread deques seeded by priority stripes, with stealing between threads.
+///						 "--feed <file>" - dispatch from a priority heap, fed with the file's insert\reprioritize\cancel commands while solving.
+///						 "--ordered-output <n>" - write the solutions in priority order, through a reorder window of n solutions.
+///						 "--deferred-writes <n>" - keep the solutions in a per-thread backlog, written whenever the Tasks file's lock is vacant (or the backlog holds n).
+///						 "--output-buffer <bytes>" - append every thread's solutions' lines to a buffer of this size, written in a single append once full.
+///						 "--output-flush-ms <ms>" - also write a thread's buffer once its' oldest line is buffered for this long (checked after every task).
+///						 "--reserve-appends <bytes>" - append without the Tasks file's lock, to ranges reserved by a fetch-and-add (the file is extended by this many bytes at a time).
+///						 "--writer-thread <capacity>" - push the solutions to a bounded lock-free ring of this many slots, drained by a single writer thread.
+///						 "--speculate-tail" - once no tasks remain, idle threads re-execute the oldest in-flight tasks (first solution wins).
+///						 "--edf" - dispatch by the tasks' deadlines (earliest latest start time first) & report the deadlines' misses & slack.
+///						 "--past-deadline <demote|skip>" - solve the tasks that can't meet their deadlines last (default), or skip them.
+///						 "--lanes <d1,d2,...>" - dispatch from size-class lanes (tasks of up to d1 digits, up to d2 digits, ... & the rest).
+///						 "--lane-shares <s1,s2,...>" - the # of workers reserved to every lane (1 each by default), the others borrow.
+///						 "--no-spin" - the locks' waiters park right away instead of spinning first (oversubscribed hosts).
+///						 "--profile-locks <file>" - profile the locks' contention, print it as a table & write it to a JSON file.
+///						 "--stall-window <seconds>" - fail the solving once no task was completed for this long (60 by default).
+/// </summary>
+/// <param name="int numberOfFlags - The number of optional command line arguments"></param>
+/// <param name="char* p_flags[] - An array of the optional command line arguments (strings)"></param>
+/// <param name="solverOptions* p_options - A pointer to the solving options struct that will be updated"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. an unknown flag</returns>
+BOOL fetchOptionalCommandLineFlags(int numberOfFlags, char* p_flags[], solverOptions* p_options);
+
 #endif //__FETCH_AND_VALIDATE_COMMANDLINE_ARGUMENTS_H__
@@ -34,13 +34,26 @@ static const DWORD SINGLE_OBJECT = 1;
 static const DWORD END_OF_FILE = 0;
 static const BOOL  EMPTY_FILE = 5;
 
+static const DWORD FRAMING_READ_BLOCK_SIZE = 65536;		//64KB per ReadFile instead of a single byte
+static const DWORDLONG INITIAL_LINES_CAPACITY = 1024;	//Initial # of line structs in the file's lines array
+
+	//Line value parsing states (a number may be preceded by spaces\tabs, as "%llu" allows)
+static const DWORD LINE_VALUE_LEADING_BLANKS = 0;
+static const DWORD LINE_VALUE_DIGITS = 1;
+static const DWORD LINE_VALUE_ENDED = 2;
+static const DWORD LINE_VALUE_NONE = 3;
+
 
 // Functions declerations ---------------------------------------------------------------
 /// <summary>
-///	 Description - This function allocates memory for a "file" struct in the heap, and initiates its' values (calloc)
+///	 Description - This function allocates memory for a "file" struct in the heap, and initiates its' values (calloc).
+///		The initial lines array is allocated only for a file that isn't going to be framed into an Elias-Fano index,
+///		and the initial lines' values array only if the lines' values should be kept.
 /// </summary>
+/// <param name="BOOL compressLinesOffsets - TRUE if the file will be framed into an Elias-Fano index (no lines array)"></param>
+/// <param name="BOOL keepLinesValues - TRUE if the number at every line's beginning should be parsed & kept while framing"></param>
 /// <returns>A pointer to an initiated "file" struct if successful, or NULL if failed.</returns>
-static file* fileStructMemoryAllocation();
+static file* fileStructMemoryAllocation(BOOL compressLinesOffsets, BOOL keepLinesValues);
 /// <summary>
 ///  Description - This function receives a file path (Relative\Absolute), and uses CreateFile of windows API
 ///		to open the file. It sets the file Handle to GENERIC_READ mode for reading the input file's contents, and
@@ -52,35 +65,60 @@ static file* fileStructMemoryAllocation();
 static HANDLE* openFileForInitialRead(char* p_filePath);
 /// <summary>
 ///  Description - This function, after reaching the end of the line, indicated by a newline character,
-///		updates a file struct by adding another line to its' count, and updates the current line struct with
-///		the total number of bytes in this line. It also creates a new line struct and chains it
-///		to the current line as the p_nextLine, which is actually the "new current last line" (in fact it is the last
-///		line by this point) of the file, and initiates its' byte offset poition in the file according to the last 
-///		byte offset of the current line.
+///		updates a file struct by adding another line to its' count. If the lines array is full, its' capacity
+///		is doubled (realloc) first (along with the lines' values array, if it is kept). The new line's initial byte offset is set according to the last byte offset
+///		of the current line, which is actually the "new current last line" of the file.
 /// </summary>
 /// <param name="file* p_file - A pointer to a file struct represnting the file's lines frames data"></param>
-/// <param name="line* p_currentLastLine - A pointer to a file's last known line struct which holds the data concerning the frame in bytes of the line"></param>
 /// <returns>A pointer to the new "current last line" if mem alloc is successful, or NULL if it failed.</returns>
-static line* prepareAnotherLine(file* p_file, line* p_currentLastLine);
-/// <summary>
-///  Description - This function takes place after another non-newline single character (=single byte) was read,
-///		and simply updates the line and file byte counts(byte_count += 1)
-/// </summary>
-/// <param name="file* p_file - A pointer to a file struct represnting the file's lines frames data"></param>
-/// <param name="line* p_currentLine - A pointer to a file's current examined line"></param>
-static void updateLineAndFileFrame(file* p_file, line* p_currentLine);
+static line* prepareAnotherLine(file* p_file);
 /// <summary>
 ///  Description - This function receives a pointer to a file struct and a handle to the input file 
-///		which was opened using CreateFile(). The function slowly reads a single byte at a time and updates
-///		the file struct accordingly - If it is a newline character, then a new line struct is allocated and
-///		added to the nested - list in p_file(all bytes offset fileds are updated as needed). A non - newline character will
-///		lead to the simple update of updateLineAndFileFrame(). Otherwise, the file is either empty or the EOF was reached
-///		and the function ends. Any failure to allocate dynamic memory terminates the entire program.
+///		which was opened using CreateFile(). The function reads the file in blocks of FRAMING_READ_BLOCK_SIZE bytes
+///		and scans every block for newline characters - every newline closes the current line and another line
+///		struct is appended to the lines array in p_file (all bytes offset fileds are updated as needed). 
+///		Otherwise, the file is either empty or the EOF was reached and the function ends. Any failure to allocate
+///		dynamic memory terminates the entire program.
+///		Framing resumes from the last line already in p_file (the first line for a new frame, or the last cached line when a cached
+///		frame is extended), so the file Handle must point at that line's initial byte position. If the lines' values array is kept,
+///		the number at every line's beginning is parsed along the way.
 /// </summary>
 /// <param name="file* p_file - A pointer to a file struct represnting the file's lines frames data"></param>
 /// <param name="HANDLE* p_h_inputFileHandle - A pointer to a handle of the input file"></param>
 /// <returns></returns>
 static BOOL constructFileFrame(file* p_file, HANDLE* p_h_inputFileHandle);
+/// <summary>
+///  Description - This function reads the input file in blocks of FRAMING_READ_BLOCK_SIZE bytes, and passes over it twice: the first pass
+///		counts the file's lines & bytes (which are needed in advance for the Elias-Fano index's layout), and the second pass (after
+///		rewinding the file handle) appends every line's initial byte position to the index. Finally the index is finalized (sampled).
+/// </summary>
+/// <param name="file* p_file - A pointer to a file struct represnting the file's lines frames data"></param>
+/// <param name="HANDLE* p_h_inputFileHandle - A pointer to a handle of the input file"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE), empty file (EMPTY_FILE) or Failure (FALSE)</returns>
+static BOOL constructCompressedFileFrame(file* p_file, HANDLE* p_h_inputFileHandle);
+/// <summary>
+///  Description - This function reads a single block of up to FRAMING_READ_BLOCK_SIZE bytes from the input file handle.
+/// </summary>
+/// <param name="HANDLE* p_h_inputFileHandle - A pointer to a handle of the input file"></param>
+/// <param name="LPTSTR p_readBlock - A pointer to the block buffer"></param>
+/// <param name="LPDWORD p_numberOfBytesRead - A pointer to the variable that will hold the number of bytes read (0 at the end of the file)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL readFramingBlock(HANDLE* p_h_inputFileHandle, LPTSTR p_readBlock, LPDWORD p_numberOfBytesRead);
+/// <summary>
+///  Description - This function advances the parsing of a line's value by a single character of the line.
+/// </summary>
+/// <param name="TCHAR character - The next character of the line (not the Newline character)"></param>
+/// <param name="PDWORDLONG p_lineValue - A pointer to the value accumulated so far"></param>
+/// <param name="LPDWORD p_lineValueState - A pointer to the parsing state (LINE_VALUE_LEADING_BLANKS at the line's beginning)"></param>
+static void parseLineValueCharacter(TCHAR character, PDWORDLONG p_lineValue, LPDWORD p_lineValueState);
+/// <summary>
+///  Description - This function locates the number of the line that begins at the given byte offset within a lines array (binary search).
+/// </summary>
+/// <param name="file* p_fileData - A pointer to a file struct framed as a lines array"></param>
+/// <param name="DWORDLONG initialByteOffset - The initial byte position of the desired line"></param>
+/// <param name="PDWORDLONG p_lineNumber - A pointer to the variable that will be updated with the line's number"></param>
+/// <returns>Found (TRUE) or not found (FALSE)</returns>
+static BOOL locateLineNumber(file* p_fileData, DWORDLONG initialByteOffset, PDWORDLONG p_lineNumber);
 
 
 
@@ -89,17 +127,21 @@ static BOOL constructFileFrame(file* p_file, HANDLE* p_h_inputFileHandle);
 
 
 // Functions definitions ---------------------------------------------------------------
-file* frameFileLines(char* p_inputFilePath)
+file* frameFileLines(char* p_inputFilePath, BOOL compressLinesOffsets, BOOL useLinesIndexCache)
 {
 	file* p_fileData = NULL;
 	HANDLE* p_h_inputFileHandle = NULL;
+	DWORD cacheState = LINES_INDEX_CACHE_MISSED;
+	LARGE_INTEGER resumePosition;
 	//Input integrity validation
 	if (p_inputFilePath == NULL) {
 		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
 	}
+	//The cache persists lines arrays only
+	if (compressLinesOffsets) useLinesIndexCache = FALSE;
 
 	//File struct mem. alloc.
-	if (NULL == (p_fileData = fileStructMemoryAllocation()))  return NULL;
+	if (NULL == (p_fileData = fileStructMemoryAllocation(compressLinesOffsets, useLinesIndexCache)))  return NULL;
 
 	//Opening a Handle to the input file file
 	if (NULL == (p_h_inputFileHandle = openFileForInitialRead(p_inputFilePath))) {
@@ -108,13 +150,40 @@ file* frameFileLines(char* p_inputFilePath)
 		return NULL; 
 	}
 
+	//Attempting to reuse the frame persisted in the sidecar file (completely, or as a prefix of an appended file)
+	if (useLinesIndexCache) {
+		if (STATUS_CODE_SUCCESS != loadLinesIndexCache(p_inputFilePath, *p_h_inputFileHandle, p_fileData, &cacheState)) {
+			freeTheFile(p_fileData);
+			closeHandleProcedure(p_h_inputFileHandle);
+			return NULL;
+		}
+		if (LINES_INDEX_CACHE_MATCHED == cacheState) {
+			closeHandleProcedure(p_h_inputFileHandle);
+			return p_fileData;
+		}
+	}
+
+	//Pointing the Handle at the line framing resumes from (byte 0, unless a cached frame is extended)
+	resumePosition.QuadPart = (LONGLONG)(p_fileData->p_lines ? (p_fileData->p_lines + p_fileData->numberOfLines - 1)->initialPositionByByte : 0);
+	if (FALSE == SetFilePointerEx(*p_h_inputFileHandle, resumePosition, NULL, FILE_BEGIN)) {
+		printf("Error: Failed to set the file Handle pointer position for framing, with code: %d.\n", GetLastError());
+		freeTheFile(p_fileData);
+		closeHandleProcedure(p_h_inputFileHandle);
+		return NULL;
+	}
+
 	//File(data) struct construction (number of lines, lines lengthes in bytes etc)
-	if (STATUS_CODE_SUCCESS != constructFileFrame(p_fileData, p_h_inputFileHandle)) {
+	if (STATUS_CODE_SUCCESS != (compressLinesOffsets ? constructCompressedFileFrame(p_fileData, p_h_inputFileHandle) : constructFileFrame(p_fileData, p_h_inputFileHandle))) {
 		freeTheFile(p_fileData);
 		closeHandleProcedure(p_h_inputFileHandle);
 		return NULL; 
 	}
 
+	//Persisting the (new or extended) frame for the following runs - failing to do so isn't fatal
+	if (useLinesIndexCache)
+		if (STATUS_CODE_SUCCESS != storeLinesIndexCache(p_inputFilePath, *p_h_inputFileHandle, p_fileData))
+			printf("Warning: Failed to store the lines index cache of '%s'.\n", p_inputFilePath);
+
 	//Closing the handle of the initial reading of the file & Freeing the Handle pointer memory (Heap)
 	closeHandleProcedure(p_h_inputFileHandle);
 
@@ -123,9 +192,66 @@ file* frameFileLines(char* p_inputFilePath)
 }
 
 
+BOOL fetchLineFrame(file* p_fileData, DWORDLONG lineNumber, line* p_lineFrame)
+{
+	DWORDLONG nextLineInitialPosition = 0;
+	//Input integrity validation
+	if ((NULL == p_fileData) || (NULL == p_lineFrame) || (lineNumber >= p_fileData->numberOfLines)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Lines array - the frame is stored as is
+	if (NULL != p_fileData->p_lines) {
+		*p_lineFrame = *(p_fileData->p_lines + lineNumber);
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//Elias-Fano index - the line ends where the next line begins (or at the end of the file)
+	p_lineFrame->initialPositionByByte = SelectFromEliasFanoIndex(p_fileData->p_compressedLinesOffsets, lineNumber);
+	nextLineInitialPosition = (lineNumber + 1 < p_fileData->numberOfLines) ?
+		SelectFromEliasFanoIndex(p_fileData->p_compressedLinesOffsets, lineNumber + 1) : p_fileData->numberOfBytes;
+	p_lineFrame->numberOfBytesInLine = (DWORD)(nextLineInitialPosition - p_lineFrame->initialPositionByByte);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL findLineByInitialByteOffset(file* p_fileData, DWORDLONG initialByteOffset, line* p_lineFrame)
+{
+	DWORDLONG lineNumber = 0;
+	//Input integrity validation
+	if ((NULL == p_fileData) || (NULL == p_lineFrame) || (0 == p_fileData->numberOfLines)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Elias-Fano index - rank operation (line number of the offset)
+	if (NULL == p_fileData->p_lines) {
+		if (FALSE == RankInEliasFanoIndex(p_fileData->p_compressedLinesOffsets, initialByteOffset, &lineNumber)) return STATUS_CODE_FAILURE;
+		return fetchLineFrame(p_fileData, lineNumber, p_lineFrame);
+	}
+
+	//Lines array - binary search
+	if (FALSE == locateLineNumber(p_fileData, initialByteOffset, &lineNumber)) return STATUS_CODE_FAILURE;
+	*p_lineFrame = *(p_fileData->p_lines + lineNumber);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL fetchLineValueByInitialByteOffset(file* p_fileData, DWORDLONG initialByteOffset, PDWORDLONG p_lineValue)
+{
+	DWORDLONG lineNumber = 0;
+	//Input integrity validation
+	if ((NULL == p_fileData) || (NULL == p_fileData->p_linesValues) || (NULL == p_lineValue)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Locating the line & validating a number is written at its' beginning
+	if (FALSE == locateLineNumber(p_fileData, initialByteOffset, &lineNumber)) return STATUS_CODE_FAILURE;
+	if (NO_LINE_VALUE == (*p_lineValue = *(p_fileData->p_linesValues + lineNumber))) return STATUS_CODE_FAILURE;
+	return STATUS_CODE_SUCCESS;
+}
+
+
 //......................................Static functions..........................................
 
-static file* fileStructMemoryAllocation()
+static file* fileStructMemoryAllocation(BOOL compressLinesOffsets, BOOL keepLinesValues)
 {
 	file* p_fileFrame = NULL;
 	//File struct dynamic memory allocation
@@ -135,18 +261,32 @@ static file* fileStructMemoryAllocation()
 		return NULL;
 	}
 
-	//Initial line struct dynamic memory allocation
-	if (NULL == (p_fileFrame->p_firstLineInFile = (line*)calloc(sizeof(line), SINGLE_OBJECT))) {
+	//Setting the file (frame) struct number of lines (the first line begins at byte 0)
+	p_fileFrame->numberOfLines = 1;
+	//A compressed frame holds no lines array (the Elias-Fano index is allocated once the file's size & #lines are known)
+	if (compressLinesOffsets) return p_fileFrame;
+
+	//Initial lines array dynamic memory allocation
+	if (NULL == (p_fileFrame->p_lines = (line*)calloc(sizeof(line), (size_t)INITIAL_LINES_CAPACITY))) {
 		printf("Error: Failed to allocate memory for a line struct.\n");
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
 		free(p_fileFrame);
 		return NULL;
 	}
 
-	//Setting the id of the first line & the file (frame) struct number of lines
-	p_fileFrame->numberOfLines = 1;
+	//Initial lines' values array dynamic memory allocation (only if the values are kept)
+	if ((keepLinesValues) && (NULL == (p_fileFrame->p_linesValues = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)INITIAL_LINES_CAPACITY)))) {
+		printf("Error: Failed to allocate memory for the lines' values array.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_fileFrame->p_lines);
+		free(p_fileFrame);
+		return NULL;
+	}
+
+	//Setting the lines array capacity
+	p_fileFrame->linesCapacity = INITIAL_LINES_CAPACITY;
 
-	//Memory allocation for the file (frame) struct & the first line struct has been successful
+	//Memory allocation for the file (frame) struct & the lines array has been successful
 	return p_fileFrame;
 }
 
@@ -171,7 +311,7 @@ static HANDLE* openFileForInitialRead(char* p_filePath)
 		PREVENT_SHARING,		// Share Mode:In the initial run, only the main thread will access the file
 		NULL,					// No Security Attributes
 		OPEN_EXISTING,			// The file is an existing file. If it doesn't exist we shouldn't open anything
-		FILE_ATTRIBUTE_NORMAL,  // General reading in files 
+		FILE_FLAG_SEQUENTIAL_SCAN,  // The file is read once from start to end
 		NULL					// No Template
 	);
 	//File Handle creation validation
@@ -188,48 +328,61 @@ static HANDLE* openFileForInitialRead(char* p_filePath)
 
 
 
-static line* prepareAnotherLine(file* p_fileData, line* p_currentLastLine)
+static line* prepareAnotherLine(file* p_fileData)
 {
+	line* p_grownLines = NULL, * p_currentLastLine = NULL;
+	PDWORDLONG p_grownLinesValues = NULL;
 	assert(p_fileData != NULL);
-	assert(p_currentLastLine != NULL);
-	//Memory allocation for the new line
-	if (NULL == (p_currentLastLine->p_nextLine = (line*)calloc(sizeof(line), SINGLE_OBJECT))) {
-		printf("Error: Failed to allocate memory for a line struct.\n");
-		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
-		return NULL;
+	//Doubling the lines array (& the lines' values, if kept) if there is no room for another line. Both doubled arrays are allocated
+	// before either replaces its' old array, so a failure leaves the frame's arrays & capacity as they were
+	if (p_fileData->numberOfLines == p_fileData->linesCapacity) {
+		if ((NULL == (p_grownLines = (line*)malloc((size_t)(sizeof(line) * p_fileData->linesCapacity * 2)))) ||
+			((NULL != p_fileData->p_linesValues) &&
+			 (NULL == (p_grownLinesValues = (PDWORDLONG)malloc((size_t)(sizeof(DWORDLONG) * p_fileData->linesCapacity * 2)))))) {
+			printf("Error: Failed to allocate memory for %llu line structs & their values.\n", p_fileData->linesCapacity * 2);
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			free(p_grownLines);
+			return NULL;
+		}
+		memcpy(p_grownLines, p_fileData->p_lines, (size_t)(sizeof(line) * p_fileData->numberOfLines));
+		free(p_fileData->p_lines);
+		p_fileData->p_lines = p_grownLines;
+		if (NULL != p_grownLinesValues) {
+			memcpy(p_grownLinesValues, p_fileData->p_linesValues, (size_t)(sizeof(DWORDLONG) * p_fileData->numberOfLines));
+			free(p_fileData->p_linesValues);
+			p_fileData->p_linesValues = p_grownLinesValues;
+		}
+		p_fileData->linesCapacity *= 2;
 	}
+	//The current last line (already closed by a newline character)
+	p_currentLastLine = p_fileData->p_lines + (p_fileData->numberOfLines - 1);
+	//Updating the new line's starting byte position & its' (yet) empty length
+	(p_currentLastLine + 1)->initialPositionByByte = p_currentLastLine->initialPositionByByte + p_currentLastLine->numberOfBytesInLine;
+	(p_currentLastLine + 1)->numberOfBytesInLine = 0;
 	//Updating the file(frame) struct with additional line
 	p_fileData->numberOfLines += 1;
-	//Updating the new line's starting byte position
-	(p_currentLastLine->p_nextLine)->initialPositionByByte = p_currentLastLine->initialPositionByByte + p_currentLastLine->numberOfBytesInLine;
 	//Returning the new line pointer to become the new current-line
-	return p_currentLastLine->p_nextLine;
-}
-
-static void updateLineAndFileFrame(file* p_fileData, line* p_currentLine)
-{
-	assert(p_currentLine != NULL);
-	//Updating the total number of bytes in the file - Consider swapping to GetFileSize 
-	p_fileData->numberOfBytes += 1;
-	//Updating the total number of bytes in the line
-	p_currentLine->numberOfBytesInLine += 1;
-
+	return p_currentLastLine + 1;
 }
 
 static BOOL constructFileFrame(file* p_fileData, HANDLE* p_h_inputFileHandle)
 {
-	
-	BOOL retVal;
-	LPTSTR p_singleByte = NULL;
-	DWORD numberOfBytesRead = 0;
-	line* p_currentLine = p_fileData->p_firstLineInFile; 
+	LPTSTR p_readBlock = NULL;
+	DWORD numberOfBytesRead = 0, byteIndex = 0, lineBeginningInBlock = 0, lineValueState = LINE_VALUE_LEADING_BLANKS;
+	DWORDLONG lineValue = 0;
+	line* p_currentLine = NULL;
 	//Asserts
 	assert(p_fileData != NULL);
 	assert(p_h_inputFileHandle != NULL);
 
-	//Memory allocation for the single byte buffer
-	if (NULL == (p_singleByte = (LPTSTR)calloc(sizeof(TCHAR), SINGLE_OBJECT))) {
-		printf("Error: Failed to allocate memory for a single-byte buffer.\n");
+	//Resuming from the last line (re-framed from its' beginning, since it may have been extended) 
+	p_currentLine = p_fileData->p_lines + (p_fileData->numberOfLines - 1);
+	p_currentLine->numberOfBytesInLine = 0;
+	p_fileData->numberOfBytes = p_currentLine->initialPositionByByte;
+
+	//Memory allocation for the read block buffer
+	if (NULL == (p_readBlock = (LPTSTR)calloc(sizeof(TCHAR), FRAMING_READ_BLOCK_SIZE))) {
+		printf("Error: Failed to allocate memory for a read-block buffer.\n");
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
 		printf("Error: Failed to construct the file(frame) struct.\n");
 		return STATUS_CODE_FAILURE;
@@ -238,48 +391,176 @@ static BOOL constructFileFrame(file* p_fileData, HANDLE* p_h_inputFileHandle)
 
 
 	do {
-		//Reading a single byte from the file handle  //CHECK//
-		retVal = ReadFile(
-			*p_h_inputFileHandle,
-			p_singleByte,
-			SINGLE_OBJECT,
-			&numberOfBytesRead,
-			NULL
-		);
-
-		
-
-		//Validating a single byte was read correctly
-		if (STATUS_FILE_READING_SUCCESS != retVal) { //|| ((retVal == STATUS_FILE_READING_SUCCESS) && (numberOfBytesRead == 0) && (p_file->numberOfBytes = 0))){
-			//ReadFile failed if retVal equals 0.
-			//FOR NOW IT IS IRRELEVANT - If ReadFile reached EOF at the begining, it returns that the reading status was successful but the number of bytes read will be set to 0.
-			printf("Error: Failed to read from the file Handle. Exited with code:%d\n", GetLastError());
-			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
-			free(p_singleByte); return STATUS_CODE_FAILURE;
+		//Reading the next block from the file handle
+		if (STATUS_CODE_SUCCESS != readFramingBlock(p_h_inputFileHandle, p_readBlock, &numberOfBytesRead)) {
+			free(p_readBlock); return STATUS_CODE_FAILURE;
 		}
-		if ((STATUS_FILE_READING_SUCCESS == retVal) && (0 == numberOfBytesRead)) {
+		if (END_OF_FILE == numberOfBytesRead) {
 			//If ReadFile reached EOF, it returns that the reading status was successful but the number of bytes read will be set to 0.
-			//Validate if the file is emptyAdd case for an empty file..... print and return EMPTY_FILE
 			if (p_fileData->numberOfBytes == 0) {
 				printf("The input file is empty.\nExiting....\n\n\n\n\n\n");
+				free(p_readBlock);
 				return EMPTY_FILE;
 			}
 			break;
 		}
-		else {
-			//Adding another byte to the current line byte count regardless of what character it is
-			updateLineAndFileFrame(p_fileData, p_currentLine);
-			if (*p_singleByte == (TCHAR)'\n') {
-				//Creating a new line and setting its' ID & initial byte position in the file
-				if ((p_currentLine = prepareAnotherLine(p_fileData, p_currentLine)) == NULL) { free(p_singleByte); return STATUS_CODE_FAILURE; }
+
+		//Scanning the block for newline characters - every newline closes the current line
+		lineBeginningInBlock = 0;
+		for (byteIndex = 0; byteIndex < numberOfBytesRead; byteIndex++) {
+			if (*(p_readBlock + byteIndex) == (TCHAR)'\n') {
+				//Adding the line's bytes within the block (including the newline character) to the current line
+				p_currentLine->numberOfBytesInLine += byteIndex + 1 - lineBeginningInBlock;
+				lineBeginningInBlock = byteIndex + 1;
+				//Keeping the line's value (if any)
+				if (NULL != p_fileData->p_linesValues) {
+					*(p_fileData->p_linesValues + (p_fileData->numberOfLines - 1)) = ((LINE_VALUE_DIGITS == lineValueState) || (LINE_VALUE_ENDED == lineValueState)) ? lineValue : NO_LINE_VALUE;
+					lineValue = 0; lineValueState = LINE_VALUE_LEADING_BLANKS;
+				}
+				//Creating a new line and setting its' initial byte position in the file
+				if (NULL == (p_currentLine = prepareAnotherLine(p_fileData))) { free(p_readBlock); return STATUS_CODE_FAILURE; }
 			}
+			else if (NULL != p_fileData->p_linesValues) parseLineValueCharacter(*(p_readBlock + byteIndex), &lineValue, &lineValueState);
 		}
+		//The remainder of the block belongs to a line which continues in the next block (or is the file's last line)
+		p_currentLine->numberOfBytesInLine += numberOfBytesRead - lineBeginningInBlock;
+		//Updating the total number of bytes in the file
+		p_fileData->numberOfBytes += numberOfBytesRead;
 	} while (numberOfBytesRead != END_OF_FILE); //As long as the number of bytes the operation read, isn't 0(==END_OF_FILE) then we continue reading
 
+	//Keeping the last line's value (the last line isn't closed by a newline character)
+	if (NULL != p_fileData->p_linesValues)
+		*(p_fileData->p_linesValues + (p_fileData->numberOfLines - 1)) = ((LINE_VALUE_DIGITS == lineValueState) || (LINE_VALUE_ENDED == lineValueState)) ? lineValue : NO_LINE_VALUE;
 
-	//Freeing the character buffer
-	free(p_singleByte);
+	//Freeing the read block buffer
+	free(p_readBlock);
 
 	//Construction succeeded...
 	return STATUS_CODE_SUCCESS;
-}
\ No newline at end of file
+}
+
+static BOOL constructCompressedFileFrame(file* p_fileData, HANDLE* p_h_inputFileHandle)
+{
+	LPTSTR p_readBlock = NULL;
+	DWORD numberOfBytesRead = 0, byteIndex = 0;
+	DWORDLONG blockInitialPosition = 0;
+	LARGE_INTEGER fileBeginning;
+	//Asserts
+	assert(p_fileData != NULL);
+	assert(p_h_inputFileHandle != NULL);
+
+	//Memory allocation for the read block buffer
+	if (NULL == (p_readBlock = (LPTSTR)calloc(sizeof(TCHAR), FRAMING_READ_BLOCK_SIZE))) {
+		printf("Error: Failed to allocate memory for a read-block buffer.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//First pass - counting the file's lines & bytes (every newline begins another line)
+	do {
+		if (STATUS_CODE_SUCCESS != readFramingBlock(p_h_inputFileHandle, p_readBlock, &numberOfBytesRead)) {
+			free(p_readBlock); return STATUS_CODE_FAILURE;
+		}
+		for (byteIndex = 0; byteIndex < numberOfBytesRead; byteIndex++)
+			if (*(p_readBlock + byteIndex) == (TCHAR)'\n') p_fileData->numberOfLines += 1;
+		p_fileData->numberOfBytes += numberOfBytesRead;
+	} while (numberOfBytesRead != END_OF_FILE);
+	if (p_fileData->numberOfBytes == 0) {
+		printf("The input file is empty.\nExiting....\n\n\n\n\n\n");
+		free(p_readBlock);
+		return EMPTY_FILE;
+	}
+
+	//The index's layout depends on the #lines & the universe of the offsets (a line may begin right at the end of the file)
+	if (NULL == (p_fileData->p_compressedLinesOffsets = InitializeEliasFanoIndex(p_fileData->numberOfLines, p_fileData->numberOfBytes + 1))) {
+		free(p_readBlock); return STATUS_CODE_FAILURE;
+	}
+
+	//Rewinding the file handle for the second pass
+	fileBeginning.QuadPart = 0;
+	if (FALSE == SetFilePointerEx(*p_h_inputFileHandle, fileBeginning, NULL, FILE_BEGIN)) {
+		printf("Error: Failed to rewind the file Handle for framing, with code: %d.\n", GetLastError());
+		free(p_readBlock); return STATUS_CODE_FAILURE;
+	}
+
+	//Second pass - appending every line's initial byte position to the index (the first line begins at byte 0)
+	if (STATUS_CODE_SUCCESS != AppendToEliasFanoIndex(p_fileData->p_compressedLinesOffsets, 0)) {
+		free(p_readBlock); return STATUS_CODE_FAILURE;
+	}
+	do {
+		if (STATUS_CODE_SUCCESS != readFramingBlock(p_h_inputFileHandle, p_readBlock, &numberOfBytesRead)) {
+			free(p_readBlock); return STATUS_CODE_FAILURE;
+		}
+		for (byteIndex = 0; byteIndex < numberOfBytesRead; byteIndex++)
+			if (*(p_readBlock + byteIndex) == (TCHAR)'\n')
+				if (STATUS_CODE_SUCCESS != AppendToEliasFanoIndex(p_fileData->p_compressedLinesOffsets, blockInitialPosition + byteIndex + 1)) {
+					free(p_readBlock); return STATUS_CODE_FAILURE;
+				}
+		blockInitialPosition += numberOfBytesRead;
+	} while (numberOfBytesRead != END_OF_FILE);
+
+	//Freeing the read block buffer
+	free(p_readBlock);
+
+	//Sampling the index for select & rank queries (also validates the file didn't change between the passes)
+	return FinalizeEliasFanoIndex(p_fileData->p_compressedLinesOffsets);
+}
+
+static BOOL readFramingBlock(HANDLE* p_h_inputFileHandle, LPTSTR p_readBlock, LPDWORD p_numberOfBytesRead)
+{
+	//Asserts
+	assert(p_h_inputFileHandle != NULL);
+	assert(p_readBlock != NULL);
+
+	//Reading the next block from the file handle
+	if (STATUS_FILE_READING_SUCCESS != ReadFile(*p_h_inputFileHandle, p_readBlock, FRAMING_READ_BLOCK_SIZE, p_numberOfBytesRead, NULL)) {
+		printf("Error: Failed to read from the file Handle. Exited with code:%d\n", GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static void parseLineValueCharacter(TCHAR character, PDWORDLONG p_lineValue, LPDWORD p_lineValueState)
+{
+	//Asserts
+	assert(NULL != p_lineValue);
+	assert(NULL != p_lineValueState);
+
+	//The value is already determined (ended, or there is none)
+	if ((LINE_VALUE_ENDED == *p_lineValueState) || (LINE_VALUE_NONE == *p_lineValueState)) return;
+
+	//A digit - accumulated (an overflowing number isn't a value)
+	if (((TCHAR)'0' <= character) && ((TCHAR)'9' >= character)) {
+		if (*p_lineValue > (ULLONG_MAX - 1 - (DWORDLONG)(character - '0')) / 10) { *p_lineValueState = LINE_VALUE_NONE; return; }
+		*p_lineValue = *p_lineValue * 10 + (DWORDLONG)(character - '0');
+		*p_lineValueState = LINE_VALUE_DIGITS;
+	}
+	//Leading blanks are skipped, & any other character ends the number (or means there is none)
+	else if (LINE_VALUE_LEADING_BLANKS == *p_lineValueState) {
+		if (((TCHAR)' ' != character) && ((TCHAR)'\t' != character)) *p_lineValueState = LINE_VALUE_NONE;
+	}
+	else *p_lineValueState = LINE_VALUE_ENDED;
+}
+
+static BOOL locateLineNumber(file* p_fileData, DWORDLONG initialByteOffset, PDWORDLONG p_lineNumber)
+{
+	DWORDLONG low = 0, high = 0, middle = 0;
+	//Asserts
+	assert(NULL != p_fileData);
+	assert(NULL != p_fileData->p_lines);
+	assert(NULL != p_lineNumber);
+
+	//Binary search over the (strictly increasing) initial byte positions of the lines
+	high = p_fileData->numberOfLines;
+	while (low < high) {
+		middle = low + (high - low) / 2;
+		if ((p_fileData->p_lines + middle)->initialPositionByByte < initialByteOffset) low = middle + 1;
+		else high = middle;
+	}
+
+	//Validate a line begins exactly at the given byte offset
+	if ((low == p_fileData->numberOfLines) || ((p_fileData->p_lines + low)->initialPositionByByte != initialByteOffset)) return FALSE;
+	*p_lineNumber = low;
+	return TRUE;
+}
@@ -18,6 +18,8 @@
 // Projects includes --------------------------------------------
 #include "HardCodedData.h"
 #include "MemoryHandling.h"
+#include "EliasFanoIndex.h"
+#include "LinesIndexCache.h"
 
 
 //Functions Declarations
@@ -25,13 +27,47 @@
 ///  Description - This function receives the input file path as input, and uses it 
 ///		to open the input file(with a Handle) in order to map the file into lines. These lines are described by
 ///		the initial byte offset(byte position) in the file, and number of bytes in the line until a newline character
-///		appears('\n'). The lines data is stored in "line"s structs, and all of them are connected as a nested-list
-///		within a "file" struct that contains additional data e.g.total number of lines in the file.
+///		appears('\n'). The lines data is stored in "line"s structs, and all of them are stored as a contiguous array
+///		(by order of appearance) within a "file" struct that contains additional data e.g.total number of lines in the file.
 ///		Evantually, a "file" struct updated with	all of the file data is returned to main.
+///		If compressLinesOffsets is set, the file is read twice (counting the lines, then collecting their initial byte positions)
+///		and only the lines' initial byte positions are kept, compressed within an Elias-Fano index (no lines array).
+///		If useLinesIndexCache is set (lines array only), the number at every line's beginning is kept as well, and the frame is persisted
+///		to a sidecar file - a following run reuses it as is if the file didn't change, or frames only the appended lines if it grew.
 /// </summary>
 /// <param name="char* p_inputFilePath - A pointer to the commandline argument (string) that represents the input file file's path (absolute\relative)"></param>
+/// <param name="BOOL compressLinesOffsets - TRUE for framing into an Elias-Fano index, FALSE for framing into a lines array"></param>
+/// <param name="BOOL useLinesIndexCache - TRUE for reusing\extending\storing the frame & lines' values in a sidecar file (ignored for an Elias-Fano index)"></param>
 /// <returns>A pointer to an updated, dynamicaly allocated "file" struct that contains all the byte-offsets-data of the input file if successful, or NULL if failed.</returns>
-file* frameFileLines(char* p_inputFilePath);
+file* frameFileLines(char* p_inputFilePath, BOOL compressLinesOffsets, BOOL useLinesIndexCache);
+/// <summary>
+///  Description - This function fetches the frame (initial byte position & number of bytes) of the line at position 'lineNumber'
+///		within a framed file, regardless of the way the file was framed (lines array or Elias-Fano index - select operation).
+/// </summary>
+/// <param name="file* p_fileData - A pointer to a framed file struct"></param>
+/// <param name="DWORDLONG lineNumber - The (0-based) number of the desired line"></param>
+/// <param name="line* p_lineFrame - A pointer to a 'line' struct that will be updated with the line's frame"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. the line number is out of the file's bounds</returns>
+BOOL fetchLineFrame(file* p_fileData, DWORDLONG lineNumber, line* p_lineFrame);
+/// <summary>
+///  Description - This function locates the framed line that begins at the given byte offset within a framed file.
+///		Since the lines are stored by order of appearance, their initial byte positions are strictly increasing, so the
+///		search is a binary search over the lines array, or a rank operation over the Elias-Fano index (instead of a scan of the entire file).
+/// </summary>
+/// <param name="file* p_fileData - A pointer to a framed file struct"></param>
+/// <param name="DWORDLONG initialByteOffset - The initial byte position (from the beginning of the file) of the desired line"></param>
+/// <param name="line* p_lineFrame - A pointer to a 'line' struct that will be updated with the line's frame"></param>
+/// <returns>A BOOL value representing the function's outcome. Found (TRUE) or Failure (FALSE) e.g. no line begins at that offset</returns>
+BOOL findLineByInitialByteOffset(file* p_fileData, DWORDLONG initialByteOffset, line* p_lineFrame);
+/// <summary>
+///  Description - This function fetches the number written at the beginning of the line that begins at the given byte offset,
+///		from the lines' values kept while framing (so the file itself isn't read). The file must be framed with its' lines' values.
+/// </summary>
+/// <param name="file* p_fileData - A pointer to a framed file struct (lines array & lines' values)"></param>
+/// <param name="DWORDLONG initialByteOffset - The initial byte position (from the beginning of the file) of the desired line"></param>
+/// <param name="PDWORDLONG p_lineValue - A pointer to the variable that will be updated with the line's value"></param>
+/// <returns>A BOOL value representing the function's outcome. Found (TRUE) or Failure (FALSE) e.g. no line begins at that offset, or it holds no number</returns>
+BOOL fetchLineValueByInitialByteOffset(file* p_fileData, DWORDLONG initialByteOffset, PDWORDLONG p_lineValue);
 
 
 #endif //__FRAME_FILE_LINES_H__
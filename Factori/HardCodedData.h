@@ -14,6 +14,7 @@
 
 // Library includes -------------------------------------------------
 #include <stdio.h>
+#include <limits.h>
 #include <Windows.h>
 
 
@@ -21,25 +22,226 @@
 #define EMPTY_THREAD_PARAMETERS FALSE
 #define MAX_LENGTH_TASK 10 //(999,999,999)
 
+	//A line's parsed value when no number is written at its' beginning (e.g. a solution line in the Tasks file)
+#define NO_LINE_VALUE ULLONG_MAX
+
+	//Lines index cache (sidecar file) constants
+#define LINES_INDEX_CACHE_EXTENSION ".fidx"			// The sidecar's path is the input file's path followed by this extension
+#define LINES_INDEX_CACHE_MAGIC "FACTIDX1"			// 8 characters (no null-terminator is stored) opening every sidecar file
+#define LINES_INDEX_CACHE_MAGIC_LENGTH 8
+#define LINES_INDEX_CACHE_VERSION 1
+
+	//Guided batch claiming constants
+#define GUIDED_CHUNK_DIVISOR 2					// A claimed chunk is the remaining positions divided by (GUIDED_CHUNK_DIVISOR * # threads)
+#define CHUNK_SIZES_HISTOGRAM_BUCKETS 16		// Bucket b counts the claimed chunks of [2^b, 2^(b+1)) positions (the last bucket - anything larger)
+
+	//Priority heap (runtime tasks feed) constants
+#define HEAP_NO_ENTRY ULLONG_MAX				// The entry index of a task identifier that was popped or canceled
+#define TASKS_FEED_READ_BLOCK_SIZE 4096			// # of bytes read from the tasks feed file at once (the longest command line it accepts)
+
+	//Tasks container (binary columnar format) constants
+#define TASKS_CONTAINER_MAGIC "FACTORIB"		// 8 characters (no null-terminator is stored) opening every container file
+#define TASKS_CONTAINER_MAGIC_LENGTH 8
+#define TASKS_CONTAINER_VERSION 1
+#define TASKS_CONTAINER_HAS_PRIORITIES 0x1		// Header flag - the priority permutation column is present
+#define TASKS_CONTAINER_HAS_CHECKSUM 0x2		// Header flag - the checksum field is valid
+#define TASKS_CONTAINER_HAS_DEADLINES 0x4		// Header flag - a deadlines column (a DWORD per priority) follows the priorities column
+
+	//Deadline-aware (EDF) scheduling constants
+#define TASK_DEADLINE_NONE MAXDWORD			// The deadline of a task whose priorities line has no deadline column
+#define DEADLINE_NOT_FINISHED -1				// The finish time of a task that wasn't solved (yet, or skipped past its' deadline)
+
+	//Size-class lanes constants
+#define MAX_SIZE_CLASS_LANES 8					// The most lanes "--lanes" may define (bounds + 1)
+#define SIZE_CLASS_LANE_NONE MAXDWORD			// The home lane of a worker beyond the lanes' reserved shares (it serves the cheapest lanes first)
+
+	//Progress watchdog constants - a worker's activities (the stall diagnostics print them)
+#define WORKER_ACTIVITY_STARTING 0				// Registered, no task fetched yet
+#define WORKER_ACTIVITY_FETCHING 1				// Claiming a position & fetching its' task (or waiting for the tasks feed)
+#define WORKER_ACTIVITY_SOLVING 2				// Factorizing the task
+#define WORKER_ACTIVITY_WAITING_FOR_LOCK 3		// Waiting for the Tasks file writing lock
+#define WORKER_ACTIVITY_WRITING 4				// Writing the solution (or passing it to the ordered output)
+#define WORKER_ACTIVITY_DONE 5					// No tasks remain - the worker terminates
+#define NUMBER_OF_WORKER_ACTIVITIES 6
+
+	//Lock contention profiler constants
+#define LOCK_PROFILE_HISTOGRAM_BUCKETS 40		// Bucket b counts the times of [2^b, 2^(b+1)) time-stamp counter cycles (the last bucket - anything longer)
+#define LOCK_PROFILE_JSON_BYTES_PER_LOCK 8192	// JSON text reserved per profiled lock (every histogram bucket included)
+
 
 // Structures --------------------------------------------------------------------------------------------
 	//line structure is used to store framed (single)line's data. The framing consists of the bytes-offset of the 
 	//initial byte position of the line & number of bytes the line is comprised of until a Newline character.
 	//The struct's purpose is to later read the data in the lines easily (since ReadFile uses bytes offsets)
+	//Offsets are 64-bit since the Tasks file keeps growing with every run (solutions are appended to it) and may pass 4GB
 typedef struct _line {
-	//DWORD lineId;				 // The line ID which help the designated thread to locate the line and its' information 
-	DWORD initialPositionByByte; // The byte ID of the first byte from which the line begins
-	DWORD numberOfBytesInLine;	 // # of bytes in the line -> along with the previous field it is possible to calculate the final byte position
-	struct _line *p_nextLine;	 // pointer to the next line struct
+	DWORDLONG initialPositionByByte; // The byte ID of the first byte from which the line begins
+	DWORD numberOfBytesInLine;		 // # of bytes in the line -> along with the previous field it is possible to calculate the final byte position
 }line;
 
-	//file structure is used to keep the entire file data as a nested-list of line structs
+	//eliasFanoIndex structure is a succinct (compressed) representation of a monotone sequence of 64-bit values, e.g. the
+	// lines' initial byte positions of a file. Every value is split to 'lowBitsWidth' low bits, that are stored packed as is,
+	// and high bits, that are stored in unary code (as gaps) within a bit-vector. This costs about (2 + lowBitsWidth) bits per
+	// value instead of 64, while select (i-th value) & rank (value -> i) are answered with the help of sampled positions.
+typedef struct _eliasFanoIndex {
+	DWORDLONG numberOfValues;			// # of values the index holds (known before the index is built)
+	DWORDLONG numberOfAppendedValues;	// # of values appended so far (during construction)
+	DWORDLONG universe;					// All values are strictly smaller than the universe
+	DWORDLONG lastAppendedValue;		// The last value appended (for monotonicity validation during construction)
+	DWORD lowBitsWidth;					// # of low bits of every value that are stored explicitly
+	DWORDLONG* p_lowBits;				// Packed array of the values' low bits
+	DWORDLONG* p_highBits;				// Bit-vector of the values' high bits in unary code (a set bit per value, a cleared bit per high-bits bucket)
+	DWORDLONG highBitsLength;			// # of bits in the high bits bit-vector
+	DWORDLONG* p_setBitsSamples;		// Position of every SAMPLING_RATE-th set bit in p_highBits (select acceleration)
+	DWORDLONG* p_clearedBitsSamples;	// Position of every SAMPLING_RATE-th cleared bit in p_highBits (rank acceleration)
+}eliasFanoIndex;
+
+	//file structure is used to keep the entire file data as a contiguous array of line structs. The lines are
+	// stored by order of appearance, so their initial byte positions are strictly increasing (binary search is possible).
+	// Alternatively (for huge files), only the lines' initial byte positions are kept, compressed in an Elias-Fano index
+	// (a line's size is the distance to the next line's initial byte position)
 typedef struct _file { 
-	DWORD numberOfLines;		 // # of null-terminated-strings (a file line) in the file
-	DWORD numberOfBytes;		 // # of bytes throughout the entire file
-	line* p_firstLineInFile;	 // pointer to the data of the first line in the file
+	DWORDLONG numberOfLines;	 // # of null-terminated-strings (a file line) in the file
+	DWORDLONG numberOfBytes;	 // # of bytes throughout the entire file
+	DWORDLONG linesCapacity;	 // # of line structs allocated in p_lines (grows by doubling while framing)
+	line* p_lines;				 // pointer to the lines array, p_lines[0] is the first line in the file (NULL if the file is framed compressed)
+	eliasFanoIndex* p_compressedLinesOffsets; // pointer to the compressed lines' initial byte positions (NULL if the file is framed as a lines array)
+	PDWORDLONG p_linesValues;	 // pointer to the number parsed from every line's beginning (NO_LINE_VALUE if none), parallel to p_lines (NULL unless the index cache is used)
 }file;
 
+	//linesIndexCacheHeader structure is the (64 bytes) header of a lines index cache - a sidecar file that persists a framed file's
+	// lines array & lines' values. It is keyed by the framed file's size, last write time & hashes of its' first & last blocks, and is
+	// followed by the lines array & the lines' values array (numberOfLines elements each)
+typedef struct _linesIndexCacheHeader {
+	char magic[LINES_INDEX_CACHE_MAGIC_LENGTH];	// LINES_INDEX_CACHE_MAGIC
+	DWORD version;								// LINES_INDEX_CACHE_VERSION
+	DWORD lineStructSize;						// sizeof(line) of the build that wrote the cache
+	DWORDLONG fileSize;							// The framed file's size in bytes
+	DWORDLONG lastWriteTime;					// The framed file's last write time (FILETIME as a 64-bit value)
+	DWORDLONG firstBlockHash;					// Hash of the framed file's first block (up to 64KB)
+	DWORDLONG lastBlockHash;					// Hash of the framed file's last block (up to 64KB)
+	DWORDLONG numberOfLines;					// # of lines (and lines' values) following the header
+}linesIndexCacheHeader;
+
+	//mappedFile structure holds a read-only view of a file (or of its' beginning) mapped to the process's address space,
+	// so the file's bytes may be accessed as a memory buffer without ReadFile calls or intermediate copies
+typedef struct _mappedFile {
+	HANDLE h_file;						// Handle to the mapped file (opened for reading, shared for reading & writing)
+	HANDLE h_fileMapping;				// Handle to the file mapping object
+	LPCSTR p_view;						// pointer to the first byte of the mapped view
+	DWORDLONG numberOfBytes;			// # of bytes in the mapped view
+}mappedFile;
+
+	//tasksContainerHeader structure is the (64 bytes) header at the beginning of a tasks container file - a binary columnar
+	// alternative to the Tasks & Tasks Priorities text files. The columns follow the header & are addressed by byte offsets.
+	// Anything beyond payloadSize (e.g. solutions appended by previous runs) isn't a part of the container.
+typedef struct _tasksContainerHeader {
+	char magic[TASKS_CONTAINER_MAGIC_LENGTH];	// TASKS_CONTAINER_MAGIC
+	DWORD version;								// TASKS_CONTAINER_VERSION
+	DWORD flags;								// TASKS_CONTAINER_HAS_PRIORITIES | TASKS_CONTAINER_HAS_CHECKSUM | TASKS_CONTAINER_HAS_DEADLINES
+	DWORDLONG numberOfTasks;					// # of rows in the tasks column
+	DWORDLONG numberOfPriorities;				// # of rows in the priority permutation column (0 if absent - tasks are solved by rows order)
+	DWORDLONG tasksColumnOffset;				// Byte offset of the tasks column (packed DWORD task values)
+	DWORDLONG prioritiesColumnOffset;			// Byte offset of the priorities column (packed DWORD tasks' rows, most prioritized first)
+	DWORDLONG payloadSize;						// # of bytes from the beginning of the file to the end of the last column
+	DWORDLONG checksum;							// FNV-1a 64-bit hash of the columns' bytes (valid if TASKS_CONTAINER_HAS_CHECKSUM is set)
+}tasksContainerHeader;
+
+	//tasksContainer structure is a loaded (mapped) tasks container - the columns are accessed in place, with no parsing
+typedef struct _tasksContainer {
+	mappedFile* p_mappedContainer;		// pointer to the mapped view of the container's payload
+	tasksContainerHeader* p_header;		// pointer to the header within the mapped view
+	const DWORD* p_tasksColumn;			// pointer to the tasks column within the mapped view
+	const DWORD* p_prioritiesColumn;	// pointer to the priorities column within the mapped view (NULL if absent)
+	const DWORD* p_deadlinesColumn;		// pointer to the deadlines column within the mapped view (NULL if absent)
+}tasksContainer;
+
+
+
+
+
+	//prioritizedTask structure pairs a task's value with its' position in the priority order (0 is the most prioritized), so the
+	// tasks may be rearranged (e.g. sorted by value) without losing their priorities
+typedef struct _prioritizedTask {
+	DWORDLONG value;					// The task's value
+	DWORDLONG position;					// The task's position in the priority order
+}prioritizedTask;
+
+	//taskPositionsRange structure is a thread's private dispatch state: its' run of consecutive positions in the priority order, claimed at
+	// once (guided batch claiming) - the thread solves the range's tasks one by one before it claims another range. When the work stealing
+	// scheduler is used instead, it holds the thread's own deque's index & the state of its' random victim selection. Either way, it keeps
+	// the position of the task the thread solves
+typedef struct _taskPositionsRange {
+	DWORDLONG nextPosition;				// The next position of the range to solve
+	DWORDLONG endPosition;				// The position following the range's last position (nextPosition == endPosition - the range is exhausted)
+	DWORD workerIndex;					// Index of the thread's own deque (work stealing)
+	DWORD randomState;					// xorshift32 state for choosing victims (work stealing, never 0)
+	DWORD laneIndex;					// The thread's home size-class lane (size-class lanes, SIZE_CLASS_LANE_NONE - a floating worker)
+	DWORDLONG lastPosition;				// The position (dispatch order) of the last fetched task - its' sequence in the ordered output
+}taskPositionsRange;
+
+	//workStealingDeque structure is a Chase-Lev work stealing deque of positions in the priority order. Its' owner thread pushes & pops
+	// at the bottom end, while any other thread may steal from the top end - all without locks (atomic operations on top & bottom only).
+	// The positions array is circular & fixed in size (the deque is seeded before solving & never outgrows its' capacity)
+typedef struct _workStealingDeque {
+	volatile LONGLONG top;				// Index of the top element - incremented by thieves (& by the owner when taking the last element)
+	volatile LONGLONG bottom;			// Index following the bottom element - modified by the owner only
+	PDWORDLONG p_positions;				// pointer to the circular positions array (element i is at i % capacity)
+	DWORDLONG capacity;					// # of positions allocated in p_positions
+}workStealingDeque;
+
+	//workStealingScheduler structure holds a deque per thread, seeded round-robin by priority stripes (position p goes to deque p % # deques),
+	// and the counters used for comparing it with the single shared cursor: throughput (steals) & priority fidelity (start displacement)
+typedef struct _workStealingScheduler {
+	DWORD numberOfDeques;				// # of deques (one per thread)
+	workStealingDeque* p_deques;		// pointer to the deques array
+	volatile LONG nextWorkerIndex;		// The next deque to hand to a starting thread (atomic increments)
+	volatile LONGLONG numberOfSteals;	// # of positions taken from another thread's deque
+	volatile LONGLONG numberOfStartedTasks; // # of positions taken so far (a task's start order)
+	volatile LONGLONG maximalDisplacement;	// The largest distance between a task's start order & its' position in the priority order
+}workStealingScheduler;
+
+	//deduplicatedTasks structure holds the distinct values among the tasks to solve, ordered by the priority of their first occurrence,
+	// along with the number of occurrences of every value - each distinct value is solved once & its' solution is written once per occurrence
+typedef struct _deduplicatedTasks {
+	DWORDLONG numberOfTasks;			// # of tasks (occurrences) the distinct values represent
+	DWORDLONG numberOfDistinctTasks;	// # of distinct values
+	PDWORDLONG p_distinctValues;		// pointer to the distinct values array, p_distinctValues[0] occurs first in the priority order
+	PDWORDLONG p_numberOfOccurrences;	// pointer to the # of occurrences of every distinct value (parallel to p_distinctValues)
+}deduplicatedTasks;
+
+	//heapEntry structure is a task in the priority heap: its' value, its' priority (the lower - the more urgent) & its' identifier,
+	// handed out when the task is inserted & used for reprioritizing or canceling it. Equal priorities are ordered by identifier (FIFO)
+typedef struct _heapEntry {
+	LONGLONG priority;					// The task's priority (may be negative - urgent tasks jump ahead of the initial tasks)
+	DWORDLONG id;						// The task's identifier (the initial tasks' identifiers are their positions in the priority order)
+	DWORDLONG value;					// The task's value
+}heapEntry;
+
+	//priorityHeap structure is a binary min-heap of tasks, indexed by identifier: the most urgent task is popped in O(log n), and any
+	// waiting task may be found in O(1) & reprioritized (decrease-key or increase-key) or canceled in O(log n). Like the Queue, it has no
+	// lock of its' own - the threads' parameters struct guards it with the Priorities Queue lock
+typedef struct _priorityHeap {
+	heapEntry* p_entries;				// pointer to the entries array - entry i's children are entries 2i+1 & 2i+2
+	DWORDLONG capacity;					// # of entries allocated in p_entries
+	DWORDLONG numberOfEntries;			// # of entries in the heap
+	PDWORDLONG p_entryIndexes;			// pointer to the entry index of every identifier handed out so far (HEAP_NO_ENTRY - popped or canceled)
+	DWORDLONG indexesCapacity;			// # of identifiers allocated in p_entryIndexes
+	DWORDLONG nextId;					// The identifier of the next inserted task
+}priorityHeap;
+
+	//tasksFeed structure holds the dynamically prioritized tasks: the initial tasks & the tasks fed while the threads solve them. The threads
+	// wait on the event while the heap is empty, until more tasks are fed or the feed is closed (then no more tasks will ever arrive)
+typedef struct _tasksFeed {
+	priorityHeap* p_heap;				// pointer to the tasks' priority heap
+	HANDLE* p_h_tasksAvailableEvent;	// Manual-reset event - signalled while the heap has tasks or the feed is closed
+	BOOL closed;						// No more tasks will be fed
+	DWORDLONG numberOfDispatchedTasks;	// # of tasks popped so far (a popped task's dispatch order)
+	DWORDLONG numberOfFedTasks;			// # of tasks inserted while solving
+	DWORDLONG numberOfReprioritizedTasks; // # of tasks reprioritized while solving
+	DWORDLONG numberOfCanceledTasks;	// # of tasks canceled while solving
+	DWORDLONG numberOfIgnoredCommands;	// # of reprioritizations & cancellations of tasks that already began solving (or were canceled)
+}tasksFeed;
 
 
 
@@ -67,53 +269,367 @@ typedef struct _factorizedString {
 	LPTSTR p_numberPrimeFactorsString;	// pointer to the string containing a number & its' prime factors components
 }factorizedString;
 
-
-
-
-
-
-
-
-
-//Queue struct - I chose to implement it by a nested list structure....
-	//Cell struct - every element in the queue implemented by a nested-list
-typedef struct _cell {
-	DWORD value;						// Queue's cell's value - an unsigned datatype, since priorities are non-negative numbers
-	struct _cell* p_next;				// pointer to the next element inside the Queue's nested-list
-}cell;
-
-	//Queue struct - main struct that hold the top element in the queue which is a cell datatype struct as defined above
+	//reorderedResult structure is a solved task's solution, waiting in the reorder buffer for the solutions of the tasks preceding it
+typedef struct _reorderedResult {
+	factorizedString* p_solution;		// pointer to the task's solution (NULL - the slot is vacant)
+	DWORDLONG numberOfOccurrences;		// # of times the solution is written (de-duplication)
+}reorderedResult;
+
+	//reorderWaiter structure is a thread blocked beyond the reorder window, waiting on its' own event until the window reaches its' position
+typedef struct _reorderWaiter {
+	BOOL taken;							// The entry belongs to a blocked thread (until it wakes up & owns the mutex again)
+	BOOL waiting;						// The thread wasn't woken up yet
+	DWORDLONG sequence;					// The blocked thread's position
+	HANDLE h_wakeUpEvent;				// Auto-reset event - signalled once the window reaches the position
+}reorderWaiter;
+
+	//reorderBuffer structure is a bounded window of solutions that are written to the Tasks file in priority order (ordered output): the
+	// solution of the task at position s waits in slot (s % windowSize) until all the preceding solutions were written. A thread whose
+	// solution is beyond the window blocks until the window advances. A single thread at a time (the drainer) writes the ready solutions
+typedef struct _reorderBuffer {
+	reorderedResult* p_slots;			// pointer to the window's slots array
+	DWORDLONG windowSize;				// # of slots - the furthest a solution may get ahead of the next one to write
+	DWORDLONG nextSequence;				// The position of the next solution to write (all the preceding solutions were written)
+	BOOL draining;						// A thread is writing the ready solutions, from nextSequence on
+	HANDLE* p_h_reorderMutex;			// Mutex guarding the buffer's fields
+	reorderWaiter* p_waiters;			// pointer to the blocked threads' entries array (one entry per thread)
+	DWORD numberOfWaiters;				// # of entries in p_waiters
+	DWORDLONG numberOfStalls;			// # of times a thread waited for the window to advance
+	DWORDLONG numberOfBufferedResults;	// # of solutions in the window
+	DWORDLONG maximalBufferedResults;	// The largest # of solutions that were in the window at once
+}reorderBuffer;
+
+	//deferredWrite structure is a solved task's solution, kept in its' worker's backlog until the worker writes it to the Tasks file
+typedef struct _deferredWrite {
+	factorizedString* p_solution;		// pointer to the task's solution (owned by the backlog)
+	DWORDLONG numberOfOccurrences;		// # of times the solution is written (de-duplication)
+	DWORDLONG position;					// The solved task's position (dispatch order - the deadline schedule records its' finish)
+}deferredWrite;
+
+	//deferredWritesBacklog structure is a worker's private backlog of solutions that weren't written yet (never shared - no lock)
+typedef struct _deferredWritesBacklog {
+	deferredWrite* p_entries;			// pointer to the backlog's entries array
+	DWORD numberOfEntries;				// # of solutions in the backlog
+	DWORD flushThreshold;				// # of entries (the array's size) at which the worker waits for the Tasks file's lock
+}deferredWritesBacklog;
+
+	//deferredWrites structure is the deferred writes' policy & statistics shared by the workers: a worker writes its' backlog whenever the
+	// Tasks file's lock is vacant (try lock), & waits for the lock only once the backlog reached the threshold (or no tasks remain)
+typedef struct _deferredWrites {
+	DWORD flushThreshold;				// # of solutions a worker may hold before it must wait for the lock
+	volatile LONG numberOfOpportunisticFlushes;	// # of backlogs written when the lock happened to be vacant
+	volatile LONG numberOfForcedFlushes;	// # of backlogs written after waiting for the lock (full backlog or no tasks remaining)
+	volatile LONG numberOfSkippedFlushes;	// # of times the lock was busy & the worker went on solving instead
+	volatile LONGLONG numberOfFlushedSolutions;	// # of solutions written through the backlogs
+	volatile LONG maximalFlushSize;		// The largest # of solutions written in a single flush
+}deferredWrites;
+
+	//outputBuffer structure is a worker's private buffer of solutions' lines, appended to the Tasks file in a single write (never shared - no lock)
+typedef struct _outputBuffer {
+	LPTSTR p_bytes;						// pointer to the buffered lines' bytes
+	DWORD capacity;						// # of bytes the buffer holds - a full buffer is written
+	DWORD numberOfBytes;				// # of bytes buffered
+	DWORD numberOfLines;				// # of solutions' lines buffered
+	DWORD flushIntervalMilliseconds;	// The longest time a line may stay buffered (checked after every task, 0 - until the buffer is full)
+	ULONGLONG oldestLineTick;			// Tick count (milli-seconds) when the oldest buffered line was appended
+}outputBuffer;
+
+	//outputBuffering structure is the output buffers' policy & statistics shared by the workers
+typedef struct _outputBuffering {
+	DWORD bufferSize;					// # of bytes in every worker's buffer
+	DWORD flushIntervalMilliseconds;	// The longest time a line may stay buffered (0 - until the buffer is full)
+	volatile LONG numberOfFullFlushes;	// # of buffers written since the next line didn't fit
+	volatile LONG numberOfTimedFlushes;	// # of buffers written since their oldest line was due
+	volatile LONG numberOfFinalFlushes;	// # of buffers written once no tasks remained
+	volatile LONG numberOfOversizedLines;	// # of lines longer than a whole buffer (written on their own)
+	volatile LONGLONG numberOfFlushedBytes;	// # of bytes written through the buffers
+	volatile LONGLONG numberOfFlushedLines;	// # of lines written through the buffers
+}outputBuffering;
+
+	//appendReservations structure is the end of the Tasks file's output, shared by the writers: a writer reserves its' bytes' range with a
+	// fetch-and-add on the end & writes it positionally (no lock). The file is extended ahead of the reservations in large increments (under
+	// the Tasks file's write lock), so the writes don't extend it, & is cut at the end of the output once the threads terminate
+typedef struct _appendReservations {
+	volatile LONGLONG endOfOutput;		// The offset of the next byte to reserve (fetch-and-add)
+	volatile LONGLONG extendedSize;		// The file's size as extended so far (a range beyond it extends the file before it is written)
+	DWORDLONG initialSize;				// The file's size before solving
+	DWORDLONG extensionSize;			// The least # of bytes the file is extended by at a time
+	volatile LONG numberOfReservations;	// # of ranges reserved
+	volatile LONG numberOfPositionalWrites;	// # of positional writes to the reserved ranges
+	volatile LONG numberOfExtensions;	// # of times the file was extended
+}appendReservations;
+
+	//writerRingSlot structure is a slot of the writer's ring. Its' sequence tells whose turn it is: the position a producer may fill it at
+	// (vacant), or that position + 1 (filled, the writer's to take)
+typedef struct _writerRingSlot {
+	volatile LONG sequence;				// The slot's turn (waited on by parked producers - a 4 bytes word)
+	factorizedString* p_solution;		// pointer to the pushed solution (owned by the ring until the writer writes it)
+	DWORDLONG numberOfOccurrences;		// # of times the solution is written (de-duplication)
+}writerRingSlot;
+
+	//writerRing structure is a bounded lock-free ring of solutions, pushed by the workers (multiple producers) & drained by a single writer
+	// thread, which appends them to the Tasks file in large sequential writes. A full ring holds the producers back (backpressure)
+typedef struct _writerRing {
+	writerRingSlot* p_slots;			// pointer to the ring's slots array
+	LONG capacity;						// # of slots
+	volatile LONG pushPosition;			// The next position to fill (compare-and-swap by the producers)
+	volatile LONG popPosition;			// The next position to take (the writer's only)
+	volatile LONG writerParked;			// The writer waits for a push (a producer wakes it)
+	volatile LONG writerWakes;			// The word the writer parks on - raised by every wake, so a wake can't slip in before the park
+	volatile LONG numberOfParkedProducers;	// # of producers waiting for a vacant slot (the writer wakes them)
+	volatile LONG closed;				// The closing marker was pushed (after the last solution) - the writer terminates once it takes it
+	volatile LONG writerFailed;			// The writer failed - it discards the solutions it takes, & the pushes fail
+	volatile LONG abandoned;			// The solving failed - the writer terminates & the producers stop waiting, without draining the ring
+	BOOL writerJoined;					// The writer terminated after the closing marker (no thread touches the ring anymore)
+	char* p_tasksFilePath;				// pointer to the Tasks list file path
+	HANDLE h_writerThread;				// The writer thread's Handle (NULL until it is started)
+	volatile LONG numberOfPushes;		// # of solutions pushed
+	volatile LONG numberOfStalls;		// # of pushes that found the ring full
+	volatile LONG numberOfProducerParks;	// # of times a producer waited for the writer (after spinning)
+	volatile LONGLONG totalQueueDepth;	// Sum of the ring's depths seen by the pushes (the average depth)
+	volatile LONG maximalQueueDepth;	// The deepest the ring was
+	LONG numberOfWriterParks;			// # of times the writer waited for a push
+	LONG numberOfWrites;				// # of writes to the Tasks file
+	LONGLONG numberOfWrittenBytes;		// # of bytes written
+	LONGLONG numberOfWrittenLines;		// # of solutions' lines written
+	DWORD maximalWriteSize;				// The largest write's # of bytes
+}writerRing;
+
+	//cancellationToken structure lets a solver poll whether its' solution is still wanted: the solving is cancelled once the watched
+	// value no longer equals the expected value (another solver already resolved the task)
+typedef struct _cancellationToken {
+	volatile LONG* p_watchedValue;		// pointer to the value watched while solving
+	LONG expectedValue;					// The watched value as long as the solution is wanted
+}cancellationToken;
+
+	//inFlightTask structure is a thread's task that is being solved. Its' generation is odd while the task is in flight - the first solver
+	// to advance it (compare-and-swap) resolves the task & writes its' solution, every other solver of the task is cancelled
+typedef struct _inFlightTask {
+	volatile LONG generation;			// Odd - the task below is in flight, even - no task is in flight (incremented on publish & on resolve)
+	volatile LONG speculatedGeneration;	// The generation whose task was already adopted by a speculative solver (one copy per task)
+	DWORDLONG task;						// The task's value
+	DWORDLONG position;					// The task's position (dispatch order)
+	DWORDLONG numberOfOccurrences;		// # of times the solution is written (de-duplication)
+	ULONGLONG startTickCount;			// GetTickCount64(.) when the task was published - the oldest in-flight task is speculated first
+}inFlightTask;
+
+	//speculativeTail structure is the threads' in-flight tasks (one slot per thread) - once no tasks remain to dispatch, an idle thread
+	// re-executes the oldest in-flight task of another thread with a different algorithm (Pollard's rho) & the first solution wins
+typedef struct _speculativeTail {
+	inFlightTask* p_slots;				// pointer to the in-flight tasks' array (one slot per thread)
+	DWORD numberOfSlots;				// # of slots in p_slots
+	volatile LONG numberOfRegisteredSolvers;	// # of slots taken by threads so far
+	volatile LONG numberOfSpeculations;	// # of in-flight tasks that were re-executed
+	volatile LONG numberOfSpeculativeWins;	// # of tasks whose speculative solution finished first
+	volatile LONG numberOfCanceledSolutions;	// # of solutions that were cancelled (or discarded) since another solver finished first
+}speculativeTail;
+
+	//deadlineSchedule structure is an earliest deadline first dispatch order: the positions are sorted by their latest start time (the deadline
+	// minus the task's estimated cost), the tasks without deadlines follow in priority order. A task that can no longer meet its' deadline
+	// when it is claimed is demoted (solved after all the other tasks) or skipped. Times are micro-seconds since solving began
+typedef struct _deadlineSchedule {
+	PDWORDLONG p_order;					// pointer to the positions in dispatch order (indexed by the claimed cursor's value)
+	LPDWORD p_deadlines;				// pointer to the deadlines (milli-seconds) per position (TASK_DEADLINE_NONE - none)
+	PDWORDLONG p_estimatedCosts;		// pointer to the estimated solving costs (micro-seconds) per position
+	PDWORDLONG p_values;				// pointer to the tasks' values per position (for the report)
+	volatile LONGLONG* p_finishTimes;	// pointer to the times the solutions were written per position (DEADLINE_NOT_FINISHED - not written)
+	DWORDLONG numberOfTasks;			// # of positions
+	BOOL skipPastDeadlineTasks;			// Past-deadline policy - skip (TRUE) or demote (FALSE)
+	volatile DWORDLONG* p_demotedPositions;	// pointer to the demoted positions (position + 1, 0 - the entry is reserved but not written yet)
+	volatile LONGLONG numberOfDemotedPositions;	// # of reserved demoted entries
+	volatile LONGLONG nextDemotedPosition;	// The next demoted entry to claim (never passes numberOfDemotedPositions)
+	volatile LONG numberOfSkippedTasks;	// # of tasks skipped past their deadlines
+	DWORDLONG picosecondsPerDivision;	// Calibrated cost of a single trial division
+	LARGE_INTEGER startCounter;			// QueryPerformanceCounter(.) when solving began
+	LARGE_INTEGER counterFrequency;		// QueryPerformanceFrequency(.)
+}deadlineSchedule;
+
+	//sizeClassLane structure is a lane of the positions whose tasks fall in a single size class (by the # of their decimal digits), in priority
+	// order. The lane's reserved workers claim its' positions first, and any other worker borrows them once its' own lane is empty
+typedef struct _sizeClassLane {
+	PDWORDLONG p_positions;				// pointer to the lane's positions, in priority order
+	DWORDLONG numberOfPositions;		// # of positions in the lane
+	volatile LONGLONG nextPosition;		// Index of the next position to claim in p_positions - atomic fetch-and-add, no lock
+	DWORD maximalNumberOfDigits;		// The most decimal digits of the lane's tasks (the last lane - anything larger)
+	DWORD numberOfReservedWorkers;		// # of workers whose home lane this is
+	volatile LONG numberOfBorrowedTasks;	// # of the lane's positions claimed by workers of other lanes (or floating workers)
+	volatile LONGLONG totalStartDelay;	// Sum of the lane's tasks' start delays (micro-seconds since solving began)
+	volatile LONGLONG maximalStartDelay;	// The longest start delay of a lane's task (micro-seconds since solving began)
+}sizeClassLane;
+
+	//sizeClassLanes structure splits the positions into lanes by the tasks' magnitudes, each with a reserved share of the workers, so the cheap
+	// tasks don't wait behind expensive ones. A worker whose lane is empty borrows from the other lanes, cheapest first
+typedef struct _sizeClassLanes {
+	sizeClassLane lanes[MAX_SIZE_CLASS_LANES];	// The lanes, by ascending size class
+	DWORD numberOfLanes;				// # of lanes in use
+	DWORD numberOfReservedWorkers;		// # of workers reserved to lanes (the following workers float)
+	volatile LONG numberOfRegisteredWorkers;	// # of workers that took a home lane so far
+	LARGE_INTEGER startCounter;			// Performance counter at the beginning of solving
+	LARGE_INTEGER counterFrequency;		// Performance counter frequency (counts per second)
+}sizeClassLanes;
+
+
+
+
+
+
+
+
+
+//Queue struct - implemented by a ring buffer: a contiguous, preallocated array of cells' values, in which the top cell is at
+//				 'topCell' and the following cells wrap around the array's end. Top, Pop & Push are O(1) (Push doubles a full array)
 typedef struct _queue {
-	cell* firstCell;
-	//An empty state would be when firstCell == NULL   instead of the field on the right//BOOL empty; 
+	PDWORDLONG p_cells;					// pointer to the cells' values array - unsigned 64-bit values, since priorities are non-negative byte offsets
+	DWORDLONG capacity;					// # of cells allocated in p_cells
+	DWORDLONG topCell;					// Index of the top cell in p_cells
+	DWORDLONG numberOfCells;			// # of cells in the queue (an empty state would be when numberOfCells == 0)
 }queue;
 
 
 
-//Lock struct - I chose my lock to pocess 2 Mutexes & 1 Semaphore in order to solve the Readers\Writers problem with 
-//				Starvation prevention
+//Lock profile struct - a lock's contention profile, allocated only when profiling is enabled (a disabled profiler costs a NULL check).
+//				Times are time-stamp counter cycles, counted in log2 histograms (converted to micro-seconds when the profile is dumped)
+typedef struct _lockProfile {
+	volatile LONG numberOfReadAcquisitions;							// # of granted reading accesses
+	volatile LONG numberOfWriteAcquisitions;						// # of granted writing accesses
+	volatile LONG numberOfContendedAcquisitions;					// # of accesses granted only after waiting
+	volatile LONG numberOfContenders;								// # of threads waiting for the lock right now
+	volatile LONG maximalNumberOfContenders;						// The most threads that waited for the lock at once
+	volatile LONG waitTimeHistogram[LOCK_PROFILE_HISTOGRAM_BUCKETS];		// Contended accesses' wait times
+	volatile LONG writeHoldTimeHistogram[LOCK_PROFILE_HISTOGRAM_BUCKETS];	// Writers' hold times
+	volatile LONG readHoldTimeHistogram[LOCK_PROFILE_HISTOGRAM_BUCKETS];	// Shared periods' lengths (the first Reader in - the last Reader out)
+	volatile LONGLONG totalWaitCycles;								// Sum of the contended accesses' wait times
+	volatile LONGLONG totalWriteHoldCycles;							// Sum of the Writers' hold times
+	volatile LONGLONG totalReadHoldCycles;							// Sum of the shared periods' lengths
+	volatile LONG numberOfReadPeriods;								// # of shared periods
+	ULONGLONG readPeriodStartTimestamp;								// Time-stamp counter when the current shared period began
+	ULONGLONG startTimestamp;										// Time-stamp counter when profiling began (cycles to micro-seconds calibration)
+	LARGE_INTEGER startCounter;										// Performance counter when profiling began (cycles to micro-seconds calibration)
+}lockProfile;
+
+//Lock struct - My lock solves the Readers\Writers problem with Starvation prevention (turnstile) on a single atomic state word,
+//				so an uncontended lock\release is a single interlocked operation, and threads park on the word only under contention -
+//				after a short spin, bounded by the recent Writers' hold times (the critical sections are very short)
 typedef struct _lock{
-	HANDLE* p_h_turnstileMutex;										// Turstile Mutex as was learned in the recitation - Its' purpose is to choose between Writer & Readers
-	HANDLE* p_h_readersCountingAtEntryOrDepartureProceduresMutex;	// Readers Mutex - Its' purpose is to create compartmentalization between Readers, while they may access the resource (allow counting Readers' number atomiclly)
-	HANDLE* p_h_vaccantResourceStatusSemphore;						// EmptyRoom Semaphore - Its' purpose is as was taught in the recitation - to signal when the resource is vacant for accessing by either Readers or Writer
-	int numberOfThreads;											// # Threads for Syncronous Objects signalling\unlocking timeouts calculations
-	int numberOfTasks;												// # Tasks for Syncronous Objects signalling\unlocking timeouts calculations
+	const char* p_name;												// The lock's name (statistics & profile)
+	volatile LONG state;											// State word - bit 0: a Writer holds the turnstile (new Readers wait), bits 1..31: # Readers inside the resource
+	volatile LONG numberOfWaiters;									// # Threads parked on the state word (WaitOnAddress) - a release wakes them only if there are any
+	BOOL spinningDisabled;											// Park right away instead of spinning first (oversubscribed hosts, "--no-spin")
+	ULONGLONG writerAcquiredTimestamp;								// Time-stamp counter when the current Writer was granted the lock
+	volatile LONGLONG averageHoldCycles;							// Moving average of the Writers' hold times (time-stamp counter cycles) - bounds the spin
+	volatile LONG numberOfContendedWaits;							// Statistics - # of times a thread couldn't take the lock right away
+	volatile LONG numberOfSpinAcquisitions;							// Statistics - # of those waits that ended while spinning (no park)
+	volatile LONG numberOfParks;									// Statistics - # of times a thread parked on the state word
+	volatile LONG numberOfUnacquiredAttempts;						// Statistics - # of try\timed acquisitions that gave up (the lock was busy)
+	lockProfile* p_profile;											// The lock's contention profile (NULL unless "--profile-locks")
 }lock;
 
 
 
+//Solver options struct - holds the optional commandline flags (given after the 4 mandatory arguments) that
+//							select alternative solving procedures. A zeroed struct means the default behaviour
+typedef struct _solverOptions {
+	BOOL compressedLinesIndex;				// Frame the input files into an Elias-Fano lines' offsets index instead of a lines array ("--compressed-index")
+	BOOL verifyContainerChecksum;			// Validate a tasks container's checksum before solving ("--verify-checksum")
+	BOOL useLinesIndexCache;				// Reuse (or extend) the framed lines & values persisted in a sidecar file ("--index-cache")
+	BOOL lazySubset;						// Parse only the referenced lines from mapped views of the input files, with no framing ("--lazy-subset")
+	BOOL deduplicateTasks;					// Solve every distinct task value once & write its' solution once per occurrence ("--dedup")
+	int minimalChunkSize;					// Guided batch claiming - the smallest run of positions claimed at once ("--chunk-floor <n>", 0 - 1)
+	int maximalChunkSize;					// Guided batch claiming - the largest run of positions claimed at once ("--chunk-ceiling <n>", 0 - 1, i.e. single claims)
+	BOOL workStealing;						// Dispatch from per-thread work stealing deques instead of the single shared cursor ("--work-stealing")
+	char* p_tasksFeedPath;					// Dispatch from a priority heap & feed it with the file's commands while solving ("--feed <file>", NULL - none)
+	int orderedOutputWindow;				// Write the solutions in priority order through a reorder window of this many solutions ("--ordered-output <n>", 0 - none)
+	int deferredWritesThreshold;			// Keep the solutions in a per-worker backlog, written when the Tasks file's lock is vacant or the backlog holds this many ("--deferred-writes <n>", 0 - none)
+	int outputBufferSize;					// Buffer every worker's solutions' lines & append them in a single write once this many bytes are buffered ("--output-buffer <bytes>", 0 - none)
+	int outputFlushMilliseconds;			// The longest time a line may stay buffered ("--output-flush-ms <ms>", 0 - until the buffer is full)
+	int appendExtensionSize;				// Append by reserving ranges of the output (fetch-and-add) & writing them positionally, with no lock - the file is extended by this many bytes at a time ("--reserve-appends <bytes>", 0 - none)
+	int writerRingCapacity;					// Pass the solutions through a bounded lock-free ring of this many slots to a single writer thread ("--writer-thread <capacity>", 0 - none)
+	BOOL speculateTail;						// Re-execute the oldest in-flight tasks on idle threads once no tasks remain to dispatch ("--speculate-tail")
+	BOOL earliestDeadlineFirst;				// Dispatch by the deadlines column, earliest latest start time first ("--edf")
+	BOOL skipPastDeadlineTasks;				// Skip the tasks that can no longer meet their deadlines instead of demoting them ("--past-deadline skip")
+	BOOL pastDeadlinePolicyGiven;			// "--past-deadline <demote|skip>" was given (valid only with "--edf")
+	int laneDigitsBounds[MAX_SIZE_CLASS_LANES - 1];	// Size-class lanes - the most decimal digits of every lane but the last, ascending ("--lanes <d1,d2,...>")
+	int numberOfLaneDigitsBounds;			// # of lanes' bounds given (0 - no lanes)
+	int laneShares[MAX_SIZE_CLASS_LANES];	// Size-class lanes - the # of workers reserved to every lane ("--lane-shares <s1,s2,...>")
+	int numberOfLaneShares;					// # of lanes' shares given (0 - a single worker per lane, while workers remain)
+	BOOL disableSpinning;					// The locks' waiters park right away instead of spinning first ("--no-spin")
+	char* p_lockProfilePath;				// Profile the locks' contention - a table is printed & the JSON is written to the file ("--profile-locks <file>", NULL - none)
+	int stallWindowSeconds;					// The longest time no task may be completed in before the solving is failed ("--stall-window <seconds>", 0 - the default)
+}solverOptions;
+
+
+
+	//workerProgress structure is a worker's progress slot - what it does right now & how many tasks it completed. Only the worker writes it,
+	// the watchdog reads it for the stall diagnostics
+typedef struct _workerProgress {
+	DWORD threadId;						// The worker thread's identifier
+	volatile LONG activity;				// The worker's current activity (WORKER_ACTIVITY_*)
+	volatile DWORDLONG task;			// The task the activity concerns (0 - none)
+	volatile ULONGLONG activityStartTick;	// Tick count (milli-seconds) when the activity began
+	volatile LONG numberOfCompletedTasks;	// # of tasks the worker completed
+}workerProgress;
+
+	//progressWatchdog structure replaces the fixed synchronization timeouts: the waits have no time cap, while a watchdog thread fails the
+	// solving only once no task was completed within the stall window (while tasks are in progress)
+typedef struct _progressWatchdog {
+	workerProgress* p_workers;			// The workers' progress slots, in registration order
+	DWORD numberOfWorkers;				// # of slots (# of worker threads)
+	volatile LONG numberOfRegisteredWorkers;	// # of workers that took a slot so far
+	volatile LONGLONG numberOfCompletedTasks;	// The progress counter - # of tasks completed by all the workers (atomic increments)
+	DWORD stallWindowMilliseconds;		// The longest time no task may be completed in
+	HANDLE* p_workerHandles;			// The workers' Handles (owned by the solving's caller)
+	HANDLE h_watchdogThread;			// The watchdog thread's Handle (NULL until it is started)
+}progressWatchdog;
+
+
+
 //Thread input parameters struct (package) - This is a struct main to combine all the inputs to a thread to assist
 //											 it solving a set of tasks with syncronization to the other threads
 typedef struct _threadPackage {
 	//Resource 1
 	char* p_tasksFilePath;					// pointer to the Tasks list file path (resource)
-	lock* p_tasksFileLock;					// pointer to the Tasks list file resource lock
-	//Resource 2
+	lock* p_tasksFileLock;					// pointer to the Tasks list file resource lock (guards the appending writes, or only the file's extensions with reserved appends - the tasks' reads are positional & lock-free)
+	//Resource 2 (immutable once the threads are created - tasks are claimed by position, not popped)
 	queue* p_prioritiesQueue;				// pointer to the Tasks Priorities Queue struct (resource)
-	lock* p_prioritiesQueueLock;			// pointer to the Tasks Priorities Queue struct resource lock
+	lock* p_prioritiesQueueLock;			// pointer to the Tasks Priorities Queue struct resource lock (for operations that modify the Queue)
+	volatile LONGLONG nextTaskPosition;		// Position of the next task to claim in the priority order (Queue, container or distinct tasks) - atomic fetch-and-add, no lock
+	//Guided batch claiming - the size of a claimed run of positions shrinks with the remaining positions, within [minimal, maximal]
+	DWORDLONG minimalChunkSize;				// Smallest run of positions claimed at once (at least 1)
+	DWORDLONG maximalChunkSize;				// Largest run of positions claimed at once (1 - every claim is a single fetch-and-add)
+	DWORDLONG numberOfThreads;				// # Threads sharing the positions (the chunk size is a share of the remaining positions per thread)
+	volatile LONG chunkSizesHistogram[CHUNK_SIZES_HISTOGRAM_BUCKETS]; // # of claimed chunks per size bucket (atomic increments)
+	//Shared cursor alternative - per-thread work stealing deques of positions (NULL unless "--work-stealing")
+	workStealingScheduler* p_workStealingScheduler;	// pointer to the work stealing scheduler
+	//Resource 2 alternative - a priority heap, modified while solving (NULL unless "--feed") - guarded by the Priorities Queue lock
+	tasksFeed* p_tasksFeed;					// pointer to the runtime tasks feed
+	//Resource 1 ordering - the solutions wait in a bounded window until all the preceding ones were written (NULL unless "--ordered-output")
+	reorderBuffer* p_reorderBuffer;			// pointer to the reorder buffer (has its' own mutex)
+	//Resource 1 batching - the solutions wait in their workers' backlogs until the lock is vacant (NULL unless "--deferred-writes")
+	deferredWrites* p_deferredWrites;		// pointer to the deferred writes' policy & statistics (atomic increments, no lock)
+	//Resource 1 batching - the solutions' lines are appended to their workers' buffers, each written at once (NULL unless "--output-buffer")
+	outputBuffering* p_outputBuffering;		// pointer to the output buffers' policy & statistics (atomic increments, no lock)
+	//Resource 1 alternative - the appends reserve their ranges of the output & write them positionally (NULL unless "--reserve-appends")
+	appendReservations* p_appendReservations;	// pointer to the end of the output (atomic fetch-and-add - the lock only guards the file's extensions)
+	//Resource 1 alternative - the solutions are pushed to a ring, & a single writer thread appends them (NULL unless "--writer-thread")
+	writerRing* p_writerRing;				// pointer to the writer's ring (lock-free)
+	//Job tail - the threads' in-flight tasks, re-executed by idle threads (NULL unless "--speculate-tail") - atomic operations, no lock
+	speculativeTail* p_speculativeTail;		// pointer to the in-flight tasks' slots
+	//Shared cursor indirection - the cursor claims indexes of an earliest deadline first order (NULL unless "--edf")
+	deadlineSchedule* p_deadlineSchedule;	// pointer to the deadline schedule (atomic operations, no lock)
+	//Shared cursor alternative - a cursor per size-class lane, each with reserved workers (NULL unless "--lanes")
+	sizeClassLanes* p_sizeClassLanes;		// pointer to the size-class lanes (atomic operations, no lock)
 	//Resource 3 (This one will NEVER be accessed with Writers)
 	file* p_tasksFileData;					// pointer to the Tasks file data struct (resource)
 		//This thread doesn't need a lock because threads will only READ from it, which doesn't demand Synchronizing
+	//Resource 3 alternative - a read-only view of the Tasks file, from which the prioritized tasks are parsed lazily (NULL unless "--lazy-subset")
+	mappedFile* p_mappedTasksFile;			// pointer to the mapped view of the Tasks file's bytes that existed before solving (read only - no lock)
+	//Resource 2 & 3 alternative - a tasks container replaces the Queue & the Tasks file data (NULL when solving from text files)
+	tasksContainer* p_tasksContainer;		// pointer to the mapped tasks container (read only - no lock)
+	DWORDLONG numberOfTasks;				// # Tasks to solve (container positions beyond the priorities column repeat the last one)
+	//Resource 2 alternative - the distinct tasks' values, resolved before solving (NULL unless "--dedup")
+	deduplicatedTasks* p_deduplicatedTasks;	// pointer to the distinct tasks (read only - no lock)
+	//Progress - the workers' progress slots & the stall detection that replaces the waits' timeouts
+	progressWatchdog* p_progressWatchdog;	// pointer to the progress watchdog (slots written by their workers, atomic progress counter)
 }threadPackage;
 
 
@@ -0,0 +1,254 @@
+/* LinesIndexCache.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for persisting a framed
+		file's lines array & lines' values to a sidecar file (the file's path followed
+		by LINES_INDEX_CACHE_EXTENSION), and for reusing it on following runs - as is,
+		if the file didn't change, or as a prefix, if lines were only appended to it.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "LinesIndexCache.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD KEY_BLOCK_SIZE = 65536;			//The cache is keyed by hashes of the file's first & last 64KB
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function allocates (on the Heap) the sidecar file's path - the framed file's path followed by LINES_INDEX_CACHE_EXTENSION.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the framed file's path"></param>
+/// <returns>A pointer to the sidecar's path string if successful, or NULL if failed</returns>
+static char* buildCachePath(char* p_filePath);
+/// <summary>
+///  Description - This function calculates the cache's key of a file as if the file ended at byte 'keyedSize': the hashes of its' first &
+///		last blocks (up to KEY_BLOCK_SIZE bytes each, before 'keyedSize').
+/// </summary>
+/// <param name="HANDLE h_file - A handle to the file opened for reading"></param>
+/// <param name="DWORDLONG keyedSize - The number of bytes from the beginning of the file the key describes"></param>
+/// <param name="linesIndexCacheHeader* p_key - A pointer to the header struct whose hashes will be updated"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL calculateBlocksHashes(HANDLE h_file, DWORDLONG keyedSize, linesIndexCacheHeader* p_key);
+/// <summary>
+///  Description - This function hashes 'numberOfBytes' bytes (up to KEY_BLOCK_SIZE) of a file, beginning at byte 'offset'.
+/// </summary>
+/// <param name="HANDLE h_file - A handle to the file opened for reading"></param>
+/// <param name="BYTE* p_block - A pointer to a buffer of KEY_BLOCK_SIZE bytes"></param>
+/// <param name="DWORDLONG offset - The block's initial byte position"></param>
+/// <param name="DWORD numberOfBytes - The block's size in bytes"></param>
+/// <param name="PDWORDLONG p_hash - A pointer to the variable that will be updated with the block's hash"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL hashFileBlock(HANDLE h_file, BYTE* p_block, DWORDLONG offset, DWORD numberOfBytes, PDWORDLONG p_hash);
+/// <summary>
+///  Description - This function fetches the size & the last write time of a file.
+/// </summary>
+/// <param name="HANDLE h_file - A handle to the file"></param>
+/// <param name="PDWORDLONG p_fileSize - A pointer to the variable that will be updated with the file's size"></param>
+/// <param name="PDWORDLONG p_lastWriteTime - A pointer to the variable that will be updated with the file's last write time"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL fetchFileSizeAndLastWriteTime(HANDLE h_file, PDWORDLONG p_fileSize, PDWORDLONG p_lastWriteTime);
+
+
+
+
+// Functions definitions ------------------------------------------------------------------
+
+BOOL loadLinesIndexCache(char* p_filePath, HANDLE h_file, file* p_fileData, LPDWORD p_cacheState)
+{
+	char* p_cachePath = NULL;
+	HANDLE h_cacheFile = INVALID_HANDLE_VALUE;
+	linesIndexCacheHeader cachedKey, currentKey;
+	line* p_cachedLines = NULL;
+	PDWORDLONG p_cachedLinesValues = NULL;
+	DWORDLONG cachedLinesCapacity = 0;
+	//Input integrity validation
+	if ((NULL == p_filePath) || (NULL == p_fileData) || (NULL == p_fileData->p_lines) || (NULL == p_fileData->p_linesValues) || (NULL == p_cacheState)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+	*p_cacheState = LINES_INDEX_CACHE_MISSED;
+
+	//Opening the sidecar file (a missing sidecar is a miss)
+	if (NULL == (p_cachePath = buildCachePath(p_filePath))) return STATUS_CODE_FAILURE;
+	h_cacheFile = CreateFile(p_cachePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	free(p_cachePath);
+	if (INVALID_HANDLE_VALUE == h_cacheFile) return STATUS_CODE_SUCCESS;
+
+	//Validating the cached key against the file as it is now - the blocks' hashes are compared as the file was when it was cached
+	memset(&currentKey, 0, sizeof(linesIndexCacheHeader));
+	if ((STATUS_CODE_SUCCESS != readEntireBufferFromFile(h_cacheFile, &cachedKey, sizeof(linesIndexCacheHeader))) ||
+		(0 != memcmp(cachedKey.magic, LINES_INDEX_CACHE_MAGIC, LINES_INDEX_CACHE_MAGIC_LENGTH)) ||
+		(LINES_INDEX_CACHE_VERSION != cachedKey.version) || (sizeof(line) != cachedKey.lineStructSize) || (0 == cachedKey.numberOfLines) ||
+		(STATUS_CODE_SUCCESS != fetchFileSizeAndLastWriteTime(h_file, &currentKey.fileSize, &currentKey.lastWriteTime)) ||
+		(currentKey.fileSize < cachedKey.fileSize) ||
+		(STATUS_CODE_SUCCESS != calculateBlocksHashes(h_file, cachedKey.fileSize, &currentKey)) ||
+		(currentKey.firstBlockHash != cachedKey.firstBlockHash) || (currentKey.lastBlockHash != cachedKey.lastBlockHash) ||
+		((currentKey.fileSize == cachedKey.fileSize) && (currentKey.lastWriteTime != cachedKey.lastWriteTime))) {
+		CloseHandle(h_cacheFile);
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//Loading the cached lines array & lines' values (with room for appended lines)
+	cachedLinesCapacity = (cachedKey.numberOfLines < p_fileData->linesCapacity) ? p_fileData->linesCapacity : cachedKey.numberOfLines;
+	if ((NULL == (p_cachedLines = (line*)calloc(sizeof(line), (size_t)cachedLinesCapacity))) ||
+		(NULL == (p_cachedLinesValues = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)cachedLinesCapacity)))) {
+		printf("Error: Failed to allocate memory for %llu cached lines.\n", cachedKey.numberOfLines);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		if (NULL != p_cachedLines) free(p_cachedLines);
+		CloseHandle(h_cacheFile);
+		return STATUS_CODE_FAILURE;
+	}
+	if ((STATUS_CODE_SUCCESS != readEntireBufferFromFile(h_cacheFile, p_cachedLines, sizeof(line) * cachedKey.numberOfLines)) ||
+		(STATUS_CODE_SUCCESS != readEntireBufferFromFile(h_cacheFile, p_cachedLinesValues, sizeof(DWORDLONG) * cachedKey.numberOfLines))) {
+		//A truncated sidecar is a miss
+		free(p_cachedLines);
+		free(p_cachedLinesValues);
+		CloseHandle(h_cacheFile);
+		return STATUS_CODE_SUCCESS;
+	}
+	CloseHandle(h_cacheFile);
+
+	//Replacing the file struct's arrays with the cached ones
+	free(p_fileData->p_lines);
+	free(p_fileData->p_linesValues);
+	p_fileData->p_lines = p_cachedLines;
+	p_fileData->p_linesValues = p_cachedLinesValues;
+	p_fileData->linesCapacity = cachedLinesCapacity;
+	p_fileData->numberOfLines = cachedKey.numberOfLines;
+	p_fileData->numberOfBytes = cachedKey.fileSize;
+	*p_cacheState = (currentKey.fileSize == cachedKey.fileSize) ? LINES_INDEX_CACHE_MATCHED : LINES_INDEX_CACHE_EXTENDABLE;
+	printf("Lines index cache of '%s' %s (%llu lines).\n", p_filePath, (LINES_INDEX_CACHE_MATCHED == *p_cacheState) ? "matched" : "is extended", cachedKey.numberOfLines);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL storeLinesIndexCache(char* p_filePath, HANDLE h_file, file* p_fileData)
+{
+	char* p_cachePath = NULL;
+	HANDLE h_cacheFile = INVALID_HANDLE_VALUE;
+	linesIndexCacheHeader key;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_filePath) || (NULL == p_fileData) || (NULL == p_fileData->p_lines) || (NULL == p_fileData->p_linesValues)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Calculating the key of the file as it was framed
+	memset(&key, 0, sizeof(linesIndexCacheHeader));
+	memcpy(key.magic, LINES_INDEX_CACHE_MAGIC, LINES_INDEX_CACHE_MAGIC_LENGTH);
+	key.version = LINES_INDEX_CACHE_VERSION;
+	key.lineStructSize = sizeof(line);
+	key.numberOfLines = p_fileData->numberOfLines;
+	if ((STATUS_CODE_SUCCESS != fetchFileSizeAndLastWriteTime(h_file, &key.fileSize, &key.lastWriteTime)) || (key.fileSize != p_fileData->numberOfBytes) ||
+		(STATUS_CODE_SUCCESS != calculateBlocksHashes(h_file, key.fileSize, &key))) return STATUS_CODE_FAILURE;
+
+	//Writing the key & both arrays to the sidecar file (overwriting an older cache)
+	if (NULL == (p_cachePath = buildCachePath(p_filePath))) return STATUS_CODE_FAILURE;
+	h_cacheFile = CreateFile(p_cachePath, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == h_cacheFile) {
+		printf("Error: Failed to create the lines index cache file '%s', with code: %d.\n", p_cachePath, GetLastError());
+		free(p_cachePath);
+		return STATUS_CODE_FAILURE;
+	}
+	retVal = (STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_cacheFile, &key, sizeof(linesIndexCacheHeader))) &&
+		(STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_cacheFile, p_fileData->p_lines, sizeof(line) * p_fileData->numberOfLines)) &&
+		(STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_cacheFile, p_fileData->p_linesValues, sizeof(DWORDLONG) * p_fileData->numberOfLines));
+	CloseHandle(h_cacheFile);
+
+	//A partially written cache is deleted (it would be a miss anyway)
+	if (STATUS_CODE_SUCCESS != retVal) DeleteFile(p_cachePath);
+	free(p_cachePath);
+	return retVal;
+}
+
+
+
+//......................................Static functions..........................................
+
+static char* buildCachePath(char* p_filePath)
+{
+	char* p_cachePath = NULL;
+	size_t cachePathSize = 0;
+	//Asserts
+	assert(NULL != p_filePath);
+
+	//The framed file's path followed by the sidecar's extension
+	cachePathSize = strlen(p_filePath) + strlen(LINES_INDEX_CACHE_EXTENSION) + 1;
+	if (NULL == (p_cachePath = (char*)calloc(sizeof(char), cachePathSize))) {
+		printf("Error: Failed to allocate memory for the lines index cache path.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	sprintf_s(p_cachePath, cachePathSize, "%s%s", p_filePath, LINES_INDEX_CACHE_EXTENSION);
+	return p_cachePath;
+}
+
+static BOOL calculateBlocksHashes(HANDLE h_file, DWORDLONG keyedSize, linesIndexCacheHeader* p_key)
+{
+	BYTE* p_block = NULL;
+	DWORD blockSize = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_key);
+
+	//Memory allocation for a single block buffer
+	if (NULL == (p_block = (BYTE*)calloc(sizeof(BYTE), KEY_BLOCK_SIZE))) {
+		printf("Error: Failed to allocate memory for a key block buffer.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Hashing the first & last blocks (the same block, for a small file)
+	blockSize = (keyedSize < KEY_BLOCK_SIZE) ? (DWORD)keyedSize : KEY_BLOCK_SIZE;
+	retVal = (STATUS_CODE_SUCCESS == hashFileBlock(h_file, p_block, 0, blockSize, &p_key->firstBlockHash)) &&
+		(STATUS_CODE_SUCCESS == hashFileBlock(h_file, p_block, keyedSize - blockSize, blockSize, &p_key->lastBlockHash));
+
+	free(p_block);
+	return retVal;
+}
+
+static BOOL hashFileBlock(HANDLE h_file, BYTE* p_block, DWORDLONG offset, DWORD numberOfBytes, PDWORDLONG p_hash)
+{
+	LARGE_INTEGER blockPosition;
+	//Asserts
+	assert(NULL != p_block);
+	assert(NULL != p_hash);
+
+	//Reading the block from its' initial byte position
+	blockPosition.QuadPart = (LONGLONG)offset;
+	if ((FALSE == SetFilePointerEx(h_file, blockPosition, NULL, FILE_BEGIN)) ||
+		(STATUS_CODE_SUCCESS != readEntireBufferFromFile(h_file, p_block, numberOfBytes))) return STATUS_CODE_FAILURE;
+
+	*p_hash = calculateBufferHash(BUFFER_HASH_INITIAL_VALUE, p_block, numberOfBytes);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL fetchFileSizeAndLastWriteTime(HANDLE h_file, PDWORDLONG p_fileSize, PDWORDLONG p_lastWriteTime)
+{
+	LARGE_INTEGER fileSize;
+	FILETIME lastWriteTime;
+	//Asserts
+	assert(NULL != p_fileSize);
+	assert(NULL != p_lastWriteTime);
+
+	if ((FALSE == GetFileSizeEx(h_file, &fileSize)) || (FALSE == GetFileTime(h_file, NULL, NULL, &lastWriteTime))) {
+		printf("Error: Failed to fetch a file's size & last write time, with code: %d.\n", GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+	*p_fileSize = (DWORDLONG)fileSize.QuadPart;
+	*p_lastWriteTime = ((DWORDLONG)lastWriteTime.dwHighDateTime << 32) | (DWORDLONG)lastWriteTime.dwLowDateTime;
+	return STATUS_CODE_SUCCESS;
+}
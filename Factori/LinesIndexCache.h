@@ -0,0 +1,54 @@
+/* LinesIndexCache.h
+-------------------------------------------------------------
+	Module Description - header module for LinesIndexCache.c
+-------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __LINES_INDEX_CACHE_H__
+#define __LINES_INDEX_CACHE_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MappedFile.h"
+
+
+// Constants ---------------------------------------------------
+	//loadLinesIndexCache(.)'s cache states
+#define LINES_INDEX_CACHE_MISSED 0		// No usable cache - the file must be framed entirely
+#define LINES_INDEX_CACHE_MATCHED 1		// The cache describes the file as is - no framing is needed
+#define LINES_INDEX_CACHE_EXTENDABLE 2	// The file grew by appending - framing resumes from the last cached line
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function attempts to load the lines index cache (sidecar file) of a file into a new "file" struct (lines array
+///		& lines' values). The cache's key is validated against the file: the hashes of its' first & last blocks (as they were when the cache
+///		was stored) must match, and then either the size & last write time match too (LINES_INDEX_CACHE_MATCHED), or the file is larger
+///		(LINES_INDEX_CACHE_EXTENDABLE - lines were appended). A missing, stale or corrupted cache isn't a failure (LINES_INDEX_CACHE_MISSED).
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the framed file's path (the sidecar's path is derived from it)"></param>
+/// <param name="HANDLE h_file - A handle to the framed file opened for reading (its' file pointer is moved)"></param>
+/// <param name="file* p_fileData - A pointer to a new "file" struct with a lines array & a lines' values array (replaced by the cached ones)"></param>
+/// <param name="LPDWORD p_cacheState - A pointer to the variable that will be updated with the cache state"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. memory allocation failure</returns>
+BOOL loadLinesIndexCache(char* p_filePath, HANDLE h_file, file* p_fileData, LPDWORD p_cacheState);
+/// <summary>
+///	 Description - This function stores the lines array & the lines' values of a framed file to its' lines index cache (sidecar file),
+///		keyed by the file's current size, last write time & hashes of its' first & last blocks. An existing cache is overwritten.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the framed file's path (the sidecar's path is derived from it)"></param>
+/// <param name="HANDLE h_file - A handle to the framed file opened for reading (its' file pointer is moved)"></param>
+/// <param name="file* p_fileData - A pointer to the framed "file" struct (lines array & lines' values)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL storeLinesIndexCache(char* p_filePath, HANDLE h_file, file* p_fileData);
+
+
+#endif //__LINES_INDEX_CACHE_H__
@@ -0,0 +1,873 @@
+/* PlatformLinux.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains the Linux implementation of the Windows
+		API subset the solver uses (declared by this directory's Windows.h): every
+		Handle is a tagged platformHandle struct - a file descriptor, a pthread, or a
+		Mutex\Event made of a pthread mutex & a condition variable (on the monotonic
+		clock). The solver's own locks never reach this module's Synchronous objects:
+		they park on futexes through WaitOnAddress.
+------------------------------------------------------------------------------------------
+*/
+
+#define _GNU_SOURCE
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "Windows.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+	//Handle types
+static const DWORD HANDLE_TYPE_FILE = 1;
+static const DWORD HANDLE_TYPE_FILE_MAPPING = 2;
+static const DWORD HANDLE_TYPE_THREAD = 3;
+static const DWORD HANDLE_TYPE_MUTEX = 4;
+static const DWORD HANDLE_TYPE_EVENT = 5;
+
+static const LONG THREAD_HANDLE_REFERENCES = 2;			//The Handle & the running thread - the last one to let go frees the struct
+
+static const LONGLONG  NANOSECONDS_PER_SECOND = 1000000000LL;
+static const LONGLONG  NANOSECONDS_PER_MILLISECOND = 1000000LL;
+static const ULONGLONG FILETIME_INTERVALS_PER_SECOND = 10000000ULL;	//100 nano-seconds intervals
+static const ULONGLONG FILETIME_UNIX_EPOCH = 116444736000000000ULL;		//January 1, 1970 in 100 nano-seconds intervals since January 1, 1601
+static const LONGLONG  NANOSECONDS_PER_FILETIME_INTERVAL = 100;
+
+static const int FUTEX_WAKE_ALL_WAITERS = INT_MAX;
+
+
+
+
+// Structures ----------------------------------------------------------------------------
+	//platformHandle structure is what a Handle points at - a file's descriptor, a thread, or a Synchronous object whose state is
+	// guarded by the struct's pthread mutex, while waiters sleep on its' condition variable until the state changes
+typedef struct _platformHandle {
+	DWORD type;							// HANDLE_TYPE_*
+	volatile LONG numberOfReferences;	// A thread's Handle is referenced by the running thread too
+	int fileDescriptor;					// Files & file mappings (-1 otherwise)
+	LONGLONG mappingSize;				// File mappings - the # of bytes a view maps by default
+	pthread_mutex_t stateMutex;			// Guards the thread's, Mutex's or Event's state
+	pthread_cond_t stateChanged;		// Signalled (broadcast) whenever the state changes
+	//Threads
+	LPTHREAD_START_ROUTINE p_startRoutine;	// The thread's routine
+	LPVOID p_parameter;					// The routine's parameter
+	DWORD threadId;						// The kernel thread identifier (0 until the thread started)
+	BOOL terminated;					// The routine returned
+	DWORD exitCode;						// The routine's return value (STILL_ACTIVE until it returned)
+	//Mutexes
+	pthread_t owner;					// The owning thread (valid while recursionCount > 0)
+	DWORD recursionCount;				// # of times the owner acquired the Mutex
+	//Events
+	BOOL manualReset;					// A manual-reset Event stays signalled until ResetEvent
+	BOOL signalled;						// The Event's state
+}platformHandle;
+
+	//mappedView structure records a view's length, since munmap needs it & UnmapViewOfFile is given the base address only
+typedef struct _mappedView {
+	LPCVOID p_baseAddress;
+	size_t length;
+	struct _mappedView* p_next;
+}mappedView;
+
+
+
+
+// Globals -------------------------------------------------------------------------------
+static __thread DWORD lastErrorCode = ERROR_SUCCESS;
+static pthread_mutex_t mappedViewsMutex = PTHREAD_MUTEX_INITIALIZER;
+static mappedView* p_mappedViews = NULL;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function records the calling thread's last error code, translating an errno value to its' Windows counterpart.
+/// </summary>
+/// <param name="int errorNumber - The errno value"></param>
+static void setLastErrorFromErrno(int errorNumber);
+/// <summary>
+///  Description - This function allocates a Handle's struct (calloc) with an initiated state mutex & monotonic clock condition variable.
+/// </summary>
+/// <param name="DWORD type - The Handle's type (HANDLE_TYPE_*)"></param>
+/// <returns>A pointer to the platformHandle struct, or NULL if failed</returns>
+static platformHandle* createPlatformHandle(DWORD type);
+/// <summary>
+///  Description - This function drops a reference to a Handle's struct, & frees it (closing its' descriptor) once none remain.
+/// </summary>
+/// <param name="platformHandle* p_handle - A pointer to the Handle's struct"></param>
+static void releasePlatformHandle(platformHandle* p_handle);
+/// <summary>
+///  Description - This function validates that a Handle points at a struct of the expected type.
+/// </summary>
+/// <param name="HANDLE h_object - The Handle"></param>
+/// <param name="DWORD type - The expected type (HANDLE_TYPE_*)"></param>
+/// <returns>A pointer to the Handle's struct, or NULL (ERROR_INVALID_HANDLE) if it isn't one</returns>
+static platformHandle* fetchPlatformHandle(HANDLE h_object, DWORD type);
+/// <summary>
+///  Description - This function is every created thread's pthread routine: it publishes the kernel thread identifier, runs the Windows
+///		thread routine & records its' return value as the exit code (waking the threads waiting for the termination).
+/// </summary>
+/// <param name="void* p_argument - A pointer to the thread's Handle struct"></param>
+/// <returns>NULL</returns>
+static void* platformThreadRoutine(void* p_argument);
+/// <summary>
+///  Description - This function checks whether a wait for a Synchronous object would be satisfied right now, & if so - takes it
+///		(acquires the Mutex, resets an auto-reset Event). The object's state mutex is held by the caller.
+/// </summary>
+/// <param name="platformHandle* p_handle - A pointer to the object's Handle struct"></param>
+/// <returns>TRUE if the wait is satisfied, FALSE otherwise</returns>
+static BOOL tryToSatisfyWait(platformHandle* p_handle);
+/// <summary>
+///  Description - This function converts a relative wait in milli-seconds to an absolute monotonic clock deadline.
+/// </summary>
+/// <param name="DWORD milliseconds - The wait's length"></param>
+/// <param name="struct timespec* p_deadline - A pointer to the deadline to set"></param>
+static void calculateWaitDeadline(DWORD milliseconds, struct timespec* p_deadline);
+/// <summary>
+///  Description - This function calculates the milli-seconds that remain until an absolute monotonic clock deadline (0 once it passed).
+/// </summary>
+/// <param name="const struct timespec* p_deadline - A pointer to the deadline"></param>
+/// <returns>The remaining milli-seconds</returns>
+static DWORD calculateRemainingMilliseconds(const struct timespec* p_deadline);
+/// <summary>
+///  Description - This function converts seconds & nano-seconds since the Unix epoch to a FILETIME.
+/// </summary>
+/// <param name="const struct timespec* p_time - A pointer to the time"></param>
+/// <param name="LPFILETIME p_fileTime - A pointer to the FILETIME to set (NULL - ignored)"></param>
+static void convertTimespecToFileTime(const struct timespec* p_time, LPFILETIME p_fileTime);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+//......................................Errors & threads..........................................
+DWORD GetLastError(void)
+{
+	return lastErrorCode;
+}
+
+DWORD GetCurrentThreadId(void)
+{
+	return (DWORD)syscall(SYS_gettid);
+}
+
+HANDLE CreateThread(LPVOID p_threadAttributes, SIZE_T stackSize, LPTHREAD_START_ROUTINE p_startRoutine, LPVOID p_parameter, DWORD creationFlags, LPDWORD p_threadId)
+{
+	platformHandle* p_handle = NULL;
+	pthread_attr_t threadAttributes;
+	pthread_t thread;
+	int errorNumber = 0;
+	//Input integrity validation
+	if (NULL == p_startRoutine) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return NULL;
+	}
+	if (NULL == (p_handle = createPlatformHandle(HANDLE_TYPE_THREAD))) return NULL;
+	p_handle->p_startRoutine = p_startRoutine;
+	p_handle->p_parameter = p_parameter;
+	p_handle->exitCode = STILL_ACTIVE;
+	p_handle->numberOfReferences = THREAD_HANDLE_REFERENCES;
+
+	//The thread is detached - its' termination is waited for through the Handle's state, not joined
+	pthread_attr_init(&threadAttributes);
+	pthread_attr_setdetachstate(&threadAttributes, PTHREAD_CREATE_DETACHED);
+	if (0 != stackSize) pthread_attr_setstacksize(&threadAttributes, stackSize);
+	errorNumber = pthread_create(&thread, &threadAttributes, platformThreadRoutine, p_handle);
+	pthread_attr_destroy(&threadAttributes);
+	if (0 != errorNumber) {
+		setLastErrorFromErrno(errorNumber);
+		p_handle->numberOfReferences = 1;
+		releasePlatformHandle(p_handle);
+		return NULL;
+	}
+
+	//The kernel thread identifier is known only once the thread runs
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	while (0 == p_handle->threadId) pthread_cond_wait(&(p_handle->stateChanged), &(p_handle->stateMutex));
+	if (NULL != p_threadId) *p_threadId = p_handle->threadId;
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return (HANDLE)p_handle;
+}
+
+BOOL GetExitCodeThread(HANDLE h_thread, LPDWORD p_exitCode)
+{
+	platformHandle* p_handle = NULL;
+	//Input integrity validation
+	if ((NULL == (p_handle = fetchPlatformHandle(h_thread, HANDLE_TYPE_THREAD))) || (NULL == p_exitCode)) return STATUS_CODE_FAILURE;
+
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	*p_exitCode = p_handle->exitCode;
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return STATUS_CODE_SUCCESS;
+}
+
+
+//......................................Synchronous objects..........................................
+HANDLE CreateMutex(LPVOID p_mutexAttributes, BOOL initialOwner, LPCSTR p_name)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = createPlatformHandle(HANDLE_TYPE_MUTEX))) return NULL;
+	if (TRUE == initialOwner) {
+		p_handle->owner = pthread_self();
+		p_handle->recursionCount = 1;
+	}
+	return (HANDLE)p_handle;
+}
+
+BOOL ReleaseMutex(HANDLE h_mutex)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = fetchPlatformHandle(h_mutex, HANDLE_TYPE_MUTEX))) return STATUS_CODE_FAILURE;
+
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	if ((0 == p_handle->recursionCount) || (0 == pthread_equal(p_handle->owner, pthread_self()))) {
+		pthread_mutex_unlock(&(p_handle->stateMutex));
+		lastErrorCode = ERROR_NOT_OWNER;
+		return STATUS_CODE_FAILURE;
+	}
+	if (0 == --(p_handle->recursionCount)) pthread_cond_broadcast(&(p_handle->stateChanged));
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return STATUS_CODE_SUCCESS;
+}
+
+HANDLE CreateEvent(LPVOID p_eventAttributes, BOOL manualReset, BOOL initialState, LPCSTR p_name)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = createPlatformHandle(HANDLE_TYPE_EVENT))) return NULL;
+	p_handle->manualReset = manualReset;
+	p_handle->signalled = initialState;
+	return (HANDLE)p_handle;
+}
+
+BOOL SetEvent(HANDLE h_event)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = fetchPlatformHandle(h_event, HANDLE_TYPE_EVENT))) return STATUS_CODE_FAILURE;
+
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	p_handle->signalled = TRUE;
+	pthread_cond_broadcast(&(p_handle->stateChanged));
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL ResetEvent(HANDLE h_event)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = fetchPlatformHandle(h_event, HANDLE_TYPE_EVENT))) return STATUS_CODE_FAILURE;
+
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	p_handle->signalled = FALSE;
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return STATUS_CODE_SUCCESS;
+}
+
+DWORD WaitForSingleObject(HANDLE h_object, DWORD milliseconds)
+{
+	platformHandle* p_handle = (platformHandle*)h_object;
+	struct timespec deadline;
+	//Input integrity validation
+	if ((NULL == p_handle) || (INVALID_HANDLE_VALUE == h_object) ||
+		((HANDLE_TYPE_THREAD != p_handle->type) && (HANDLE_TYPE_MUTEX != p_handle->type) && (HANDLE_TYPE_EVENT != p_handle->type))) {
+		lastErrorCode = ERROR_INVALID_HANDLE; return WAIT_FAILED;
+	}
+
+	if (INFINITE != milliseconds) calculateWaitDeadline(milliseconds, &deadline);
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	while (FALSE == tryToSatisfyWait(p_handle)) {
+		if (INFINITE == milliseconds) pthread_cond_wait(&(p_handle->stateChanged), &(p_handle->stateMutex));
+		else if ((ETIMEDOUT == pthread_cond_timedwait(&(p_handle->stateChanged), &(p_handle->stateMutex), &deadline)) && (FALSE == tryToSatisfyWait(p_handle))) {
+			pthread_mutex_unlock(&(p_handle->stateMutex));
+			return WAIT_TIMEOUT;
+		}
+	}
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	return WAIT_OBJECT_0;
+}
+
+DWORD WaitForMultipleObjects(DWORD numberOfObjects, const HANDLE* p_objects, BOOL waitAll, DWORD milliseconds)
+{
+	struct timespec deadline;
+	DWORD objectIndex = 0, waitCode = WAIT_OBJECT_0;
+	//Input integrity validation
+	if ((0 == numberOfObjects) || (NULL == p_objects)) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return WAIT_FAILED;
+	}
+	if (FALSE == waitAll) {
+		lastErrorCode = ERROR_NOT_SUPPORTED; return WAIT_FAILED;
+	}
+
+	//The objects are waited for one after the other, within a single deadline - exact for threads' termination (once terminated, a thread
+	// stays so), while Mutexes & auto-reset Events taken before a timeout stay taken
+	if (INFINITE != milliseconds) calculateWaitDeadline(milliseconds, &deadline);
+	for (objectIndex = 0; objectIndex < numberOfObjects; objectIndex++) {
+		waitCode = WaitForSingleObject(p_objects[objectIndex], (INFINITE == milliseconds) ? INFINITE : calculateRemainingMilliseconds(&deadline));
+		if (WAIT_OBJECT_0 != waitCode) return waitCode;
+	}
+	return WAIT_OBJECT_0;
+}
+
+BOOL CloseHandle(HANDLE h_object)
+{
+	platformHandle* p_handle = (platformHandle*)h_object;
+	//Input integrity validation
+	if ((NULL == p_handle) || (INVALID_HANDLE_VALUE == h_object)) {
+		lastErrorCode = ERROR_INVALID_HANDLE; return STATUS_CODE_FAILURE;
+	}
+	releasePlatformHandle(p_handle);
+	return STATUS_CODE_SUCCESS;
+}
+
+
+//......................................Address waits..........................................
+BOOL WaitOnAddress(volatile void* p_address, PVOID p_compareAddress, SIZE_T addressSize, DWORD milliseconds)
+{
+	struct timespec timeout;
+	//Input integrity validation - futexes are 4-byte words
+	if ((NULL == p_address) || (NULL == p_compareAddress) || (sizeof(int) != addressSize)) {
+		lastErrorCode = ERROR_NOT_SUPPORTED; return STATUS_CODE_FAILURE;
+	}
+
+	timeout.tv_sec = milliseconds / 1000;
+	timeout.tv_nsec = (long)(milliseconds % 1000) * NANOSECONDS_PER_MILLISECOND;
+	if (0 == syscall(SYS_futex, (int*)p_address, FUTEX_WAIT_PRIVATE, *(int*)p_compareAddress, (INFINITE == milliseconds) ? NULL : &timeout, NULL, 0)) return STATUS_CODE_SUCCESS;
+
+	//EAGAIN - the value already differs, EINTR - a spurious wake (the caller re-examines the value anyway)
+	if (ETIMEDOUT == errno) {
+		lastErrorCode = ERROR_TIMEOUT; return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+void WakeByAddressSingle(PVOID p_address)
+{
+	syscall(SYS_futex, (int*)p_address, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+void WakeByAddressAll(PVOID p_address)
+{
+	syscall(SYS_futex, (int*)p_address, FUTEX_WAKE_PRIVATE, FUTEX_WAKE_ALL_WAITERS, NULL, NULL, 0);
+}
+
+
+//......................................Time..........................................
+void Sleep(DWORD milliseconds)
+{
+	struct timespec duration;
+	duration.tv_sec = milliseconds / 1000;
+	duration.tv_nsec = (long)(milliseconds % 1000) * NANOSECONDS_PER_MILLISECOND;
+	while ((-1 == nanosleep(&duration, &duration)) && (EINTR == errno));
+}
+
+ULONGLONG GetTickCount64(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (ULONGLONG)now.tv_sec * 1000 + (ULONGLONG)now.tv_nsec / NANOSECONDS_PER_MILLISECOND;
+}
+
+BOOL QueryPerformanceCounter(LARGE_INTEGER* p_performanceCount)
+{
+	struct timespec now;
+	if (NULL == p_performanceCount) return STATUS_CODE_FAILURE;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	p_performanceCount->QuadPart = (LONGLONG)now.tv_sec * NANOSECONDS_PER_SECOND + now.tv_nsec;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL QueryPerformanceFrequency(LARGE_INTEGER* p_frequency)
+{
+	if (NULL == p_frequency) return STATUS_CODE_FAILURE;
+	p_frequency->QuadPart = NANOSECONDS_PER_SECOND;
+	return STATUS_CODE_SUCCESS;
+}
+
+#if !defined(__x86_64__) && !defined(__i386__)
+ULONGLONG ReadTimeStampCounter(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+	return (ULONGLONG)now.tv_sec * NANOSECONDS_PER_SECOND + (ULONGLONG)now.tv_nsec;
+}
+#endif
+
+
+//......................................Files..........................................
+HANDLE CreateFile(LPCSTR p_fileName, DWORD desiredAccess, DWORD shareMode, LPVOID p_securityAttributes, DWORD creationDisposition, DWORD flagsAndAttributes, HANDLE h_templateFile)
+{
+	platformHandle* p_handle = NULL;
+	int openFlags = O_CLOEXEC, fileDescriptor = -1;
+	BOOL writes = (0 != (desiredAccess & (GENERIC_WRITE | FILE_APPEND_DATA)));
+	//Input integrity validation
+	if (NULL == p_fileName) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return INVALID_HANDLE_VALUE;
+	}
+
+	//Access - append only access (without writing access) appends every write at the end of the file
+	openFlags |= (TRUE == writes) ? ((0 != (desiredAccess & GENERIC_READ)) ? O_RDWR : O_WRONLY) : O_RDONLY;
+	if ((0 != (desiredAccess & FILE_APPEND_DATA)) && (0 == (desiredAccess & GENERIC_WRITE))) openFlags |= O_APPEND;
+
+	//Disposition
+	switch (creationDisposition) {
+	case CREATE_NEW:		openFlags |= O_CREAT | O_EXCL; break;
+	case CREATE_ALWAYS:		openFlags |= O_CREAT | O_TRUNC; break;
+	case OPEN_ALWAYS:		openFlags |= O_CREAT; break;
+	case TRUNCATE_EXISTING:	openFlags |= O_TRUNC; break;
+	case OPEN_EXISTING:		break;
+	default:
+		lastErrorCode = ERROR_INVALID_PARAMETER; return INVALID_HANDLE_VALUE;
+	}
+
+	if (-1 == (fileDescriptor = open(p_fileName, openFlags, 0644))) {
+		setLastErrorFromErrno(errno); return INVALID_HANDLE_VALUE;
+	}
+	if (0 != (flagsAndAttributes & FILE_FLAG_SEQUENTIAL_SCAN)) posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+	else if (0 != (flagsAndAttributes & FILE_FLAG_RANDOM_ACCESS)) posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_RANDOM);
+
+	if (NULL == (p_handle = createPlatformHandle(HANDLE_TYPE_FILE))) {
+		close(fileDescriptor); return INVALID_HANDLE_VALUE;
+	}
+	p_handle->fileDescriptor = fileDescriptor;
+	return (HANDLE)p_handle;
+}
+
+BOOL ReadFile(HANDLE h_file, LPVOID p_buffer, DWORD numberOfBytesToRead, LPDWORD p_numberOfBytesRead, LPOVERLAPPED p_overlapped)
+{
+	platformHandle* p_handle = NULL;
+	off_t offset = 0;
+	ssize_t numberOfBytes = 0;
+	DWORD numberOfBytesRead = 0;
+	//Input integrity validation
+	if (NULL != p_numberOfBytesRead) *p_numberOfBytesRead = 0;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+	if ((NULL == p_buffer) && (0 != numberOfBytesToRead)) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return STATUS_CODE_FAILURE;
+	}
+	if (NULL != p_overlapped) offset = (off_t)(((ULONGLONG)p_overlapped->OffsetHigh << 32) | p_overlapped->Offset);
+
+	//Short reads are continued - like a Windows file read, fewer bytes are read only at the end of the file
+	while (numberOfBytesRead < numberOfBytesToRead) {
+		numberOfBytes = (NULL == p_overlapped) ?
+			read(p_handle->fileDescriptor, (BYTE*)p_buffer + numberOfBytesRead, numberOfBytesToRead - numberOfBytesRead) :
+			pread(p_handle->fileDescriptor, (BYTE*)p_buffer + numberOfBytesRead, numberOfBytesToRead - numberOfBytesRead, offset + numberOfBytesRead);
+		if (0 == numberOfBytes) break;
+		if (-1 == numberOfBytes) {
+			if (EINTR == errno) continue;
+			setLastErrorFromErrno(errno);
+			if (NULL != p_numberOfBytesRead) *p_numberOfBytesRead = numberOfBytesRead;
+			return STATUS_CODE_FAILURE;
+		}
+		numberOfBytesRead += (DWORD)numberOfBytes;
+	}
+	if (NULL != p_numberOfBytesRead) *p_numberOfBytesRead = numberOfBytesRead;
+
+	//A positional read at the end of the file fails (a synchronous Windows Handle reports the end of the file so)
+	if ((NULL != p_overlapped) && (0 == numberOfBytesRead) && (0 != numberOfBytesToRead)) {
+		lastErrorCode = ERROR_HANDLE_EOF; return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL WriteFile(HANDLE h_file, LPCVOID p_buffer, DWORD numberOfBytesToWrite, LPDWORD p_numberOfBytesWritten, LPOVERLAPPED p_overlapped)
+{
+	platformHandle* p_handle = NULL;
+	struct stat fileStatus;
+	off_t offset = 0;
+	ssize_t numberOfBytes = 0;
+	DWORD numberOfBytesWritten = 0;
+	//Input integrity validation
+	if (NULL != p_numberOfBytesWritten) *p_numberOfBytesWritten = 0;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+	if ((NULL == p_buffer) && (0 != numberOfBytesToWrite)) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return STATUS_CODE_FAILURE;
+	}
+
+	//A positional write at offset 0xFFFFFFFF:0xFFFFFFFF writes at the end of the file
+	if (NULL != p_overlapped) {
+		if ((MAXDWORD == p_overlapped->Offset) && (MAXDWORD == p_overlapped->OffsetHigh)) {
+			if (-1 == fstat(p_handle->fileDescriptor, &fileStatus)) {
+				setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+			}
+			offset = fileStatus.st_size;
+		}
+		else offset = (off_t)(((ULONGLONG)p_overlapped->OffsetHigh << 32) | p_overlapped->Offset);
+	}
+
+	//Short writes are continued until all the bytes were written
+	while (numberOfBytesWritten < numberOfBytesToWrite) {
+		numberOfBytes = (NULL == p_overlapped) ?
+			write(p_handle->fileDescriptor, (const BYTE*)p_buffer + numberOfBytesWritten, numberOfBytesToWrite - numberOfBytesWritten) :
+			pwrite(p_handle->fileDescriptor, (const BYTE*)p_buffer + numberOfBytesWritten, numberOfBytesToWrite - numberOfBytesWritten, offset + numberOfBytesWritten);
+		if (-1 == numberOfBytes) {
+			if (EINTR == errno) continue;
+			setLastErrorFromErrno(errno);
+			if (NULL != p_numberOfBytesWritten) *p_numberOfBytesWritten = numberOfBytesWritten;
+			return STATUS_CODE_FAILURE;
+		}
+		numberOfBytesWritten += (DWORD)numberOfBytes;
+	}
+	if (NULL != p_numberOfBytesWritten) *p_numberOfBytesWritten = numberOfBytesWritten;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL SetFilePointerEx(HANDLE h_file, LARGE_INTEGER distanceToMove, PLARGE_INTEGER p_newFilePointer, DWORD moveMethod)
+{
+	platformHandle* p_handle = NULL;
+	off_t newFilePointer = 0;
+	int whence = SEEK_SET;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+
+	switch (moveMethod) {
+	case FILE_BEGIN:	whence = SEEK_SET; break;
+	case FILE_CURRENT:	whence = SEEK_CUR; break;
+	case FILE_END:		whence = SEEK_END; break;
+	default:
+		lastErrorCode = ERROR_INVALID_PARAMETER; return STATUS_CODE_FAILURE;
+	}
+	if (-1 == (newFilePointer = lseek(p_handle->fileDescriptor, (off_t)distanceToMove.QuadPart, whence))) {
+		setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+	}
+	if (NULL != p_newFilePointer) p_newFilePointer->QuadPart = (LONGLONG)newFilePointer;
+	return STATUS_CODE_SUCCESS;
+}
+
+DWORD SetFilePointer(HANDLE h_file, LONG distanceToMove, PLONG p_distanceToMoveHigh, DWORD moveMethod)
+{
+	LARGE_INTEGER distance, newFilePointer;
+	//Without the high part, the distance is a signed 32-bit value
+	if (NULL == p_distanceToMoveHigh) distance.QuadPart = distanceToMove;
+	else {
+		distance.LowPart = (DWORD)distanceToMove;
+		distance.HighPart = *p_distanceToMoveHigh;
+	}
+	if (FALSE == SetFilePointerEx(h_file, distance, &newFilePointer, moveMethod)) return INVALID_SET_FILE_POINTER;
+	if (NULL != p_distanceToMoveHigh) *p_distanceToMoveHigh = newFilePointer.HighPart;
+	return newFilePointer.LowPart;
+}
+
+BOOL SetEndOfFile(HANDLE h_file)
+{
+	platformHandle* p_handle = NULL;
+	off_t filePointer = 0;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+
+	//The file ends at the file pointer (truncated or extended)
+	if ((-1 == (filePointer = lseek(p_handle->fileDescriptor, 0, SEEK_CUR))) || (-1 == ftruncate(p_handle->fileDescriptor, filePointer))) {
+		setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL GetFileSizeEx(HANDLE h_file, PLARGE_INTEGER p_fileSize)
+{
+	platformHandle* p_handle = NULL;
+	struct stat fileStatus;
+	if ((NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) || (NULL == p_fileSize)) return STATUS_CODE_FAILURE;
+
+	if (-1 == fstat(p_handle->fileDescriptor, &fileStatus)) {
+		setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+	}
+	p_fileSize->QuadPart = (LONGLONG)fileStatus.st_size;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL GetFileTime(HANDLE h_file, LPFILETIME p_creationTime, LPFILETIME p_lastAccessTime, LPFILETIME p_lastWriteTime)
+{
+	platformHandle* p_handle = NULL;
+	struct stat fileStatus;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+
+	if (-1 == fstat(p_handle->fileDescriptor, &fileStatus)) {
+		setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+	}
+	//POSIX keeps no creation time - the status change time stands for it
+	convertTimespecToFileTime(&(fileStatus.st_ctim), p_creationTime);
+	convertTimespecToFileTime(&(fileStatus.st_atim), p_lastAccessTime);
+	convertTimespecToFileTime(&(fileStatus.st_mtim), p_lastWriteTime);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL FlushFileBuffers(HANDLE h_file)
+{
+	platformHandle* p_handle = NULL;
+	if (NULL == (p_handle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return STATUS_CODE_FAILURE;
+
+	if (-1 == fsync(p_handle->fileDescriptor)) {
+		setLastErrorFromErrno(errno); return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL DeleteFile(LPCSTR p_fileName)
+{
+	if ((NULL == p_fileName) || (-1 == unlink(p_fileName))) {
+		setLastErrorFromErrno((NULL == p_fileName) ? EINVAL : errno); return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+
+//......................................File mappings..........................................
+HANDLE CreateFileMapping(HANDLE h_file, LPVOID p_attributes, DWORD protection, DWORD maximumSizeHigh, DWORD maximumSizeLow, LPCSTR p_name)
+{
+	platformHandle* p_fileHandle = NULL, *p_handle = NULL;
+	LARGE_INTEGER mappingSize;
+	//Input integrity validation - read only mappings
+	if (NULL == (p_fileHandle = fetchPlatformHandle(h_file, HANDLE_TYPE_FILE))) return NULL;
+	if (PAGE_READONLY != protection) {
+		lastErrorCode = ERROR_NOT_SUPPORTED; return NULL;
+	}
+
+	//The mapping's size - the file's size when none is given
+	mappingSize.LowPart = maximumSizeLow;
+	mappingSize.HighPart = (LONG)maximumSizeHigh;
+	if ((0 == mappingSize.QuadPart) && (FALSE == GetFileSizeEx(h_file, &mappingSize))) return NULL;
+
+	//The mapping keeps its' own descriptor - the file's Handle may be closed before the views are mapped
+	if (NULL == (p_handle = createPlatformHandle(HANDLE_TYPE_FILE_MAPPING))) return NULL;
+	if (-1 == (p_handle->fileDescriptor = fcntl(p_fileHandle->fileDescriptor, F_DUPFD_CLOEXEC, 0))) {
+		setLastErrorFromErrno(errno);
+		releasePlatformHandle(p_handle);
+		return NULL;
+	}
+	p_handle->mappingSize = mappingSize.QuadPart;
+	return (HANDLE)p_handle;
+}
+
+LPVOID MapViewOfFile(HANDLE h_fileMapping, DWORD desiredAccess, DWORD fileOffsetHigh, DWORD fileOffsetLow, SIZE_T numberOfBytesToMap)
+{
+	platformHandle* p_handle = NULL;
+	mappedView* p_view = NULL;
+	off_t offset = 0;
+	void* p_baseAddress = NULL;
+	//Input integrity validation - read only views
+	if (NULL == (p_handle = fetchPlatformHandle(h_fileMapping, HANDLE_TYPE_FILE_MAPPING))) return NULL;
+	if (FILE_MAP_READ != desiredAccess) {
+		lastErrorCode = ERROR_NOT_SUPPORTED; return NULL;
+	}
+	offset = (off_t)(((ULONGLONG)fileOffsetHigh << 32) | fileOffsetLow);
+	if (0 == numberOfBytesToMap) numberOfBytesToMap = (SIZE_T)(p_handle->mappingSize - offset);
+
+	if (NULL == (p_view = (mappedView*)calloc(sizeof(mappedView), SINGLE_OBJECT))) {
+		lastErrorCode = ERROR_NOT_ENOUGH_MEMORY; return NULL;
+	}
+	if (MAP_FAILED == (p_baseAddress = mmap(NULL, numberOfBytesToMap, PROT_READ, MAP_SHARED, p_handle->fileDescriptor, offset))) {
+		setLastErrorFromErrno(errno);
+		free(p_view);
+		return NULL;
+	}
+
+	//Recording the view's length for UnmapViewOfFile
+	p_view->p_baseAddress = p_baseAddress;
+	p_view->length = numberOfBytesToMap;
+	pthread_mutex_lock(&mappedViewsMutex);
+	p_view->p_next = p_mappedViews;
+	p_mappedViews = p_view;
+	pthread_mutex_unlock(&mappedViewsMutex);
+	return p_baseAddress;
+}
+
+BOOL UnmapViewOfFile(LPCVOID p_baseAddress)
+{
+	mappedView** p_p_view = NULL, *p_view = NULL;
+
+	//Unlinking the view's record
+	pthread_mutex_lock(&mappedViewsMutex);
+	for (p_p_view = &p_mappedViews; NULL != *p_p_view; p_p_view = &((*p_p_view)->p_next)) {
+		if (p_baseAddress != (*p_p_view)->p_baseAddress) continue;
+		p_view = *p_p_view;
+		*p_p_view = p_view->p_next;
+		break;
+	}
+	pthread_mutex_unlock(&mappedViewsMutex);
+	if (NULL == p_view) {
+		lastErrorCode = ERROR_INVALID_PARAMETER; return STATUS_CODE_FAILURE;
+	}
+
+	munmap((void*)p_view->p_baseAddress, p_view->length);
+	free(p_view);
+	return STATUS_CODE_SUCCESS;
+}
+
+
+//......................................Secure CRT functions..........................................
+int sprintf_s(char* p_buffer, size_t bufferSize, const char* p_format, ...)
+{
+	va_list arguments;
+	int length = 0;
+	if ((NULL == p_buffer) || (0 == bufferSize) || (NULL == p_format)) return -1;
+
+	va_start(arguments, p_format);
+	length = vsnprintf(p_buffer, bufferSize, p_format, arguments);
+	va_end(arguments);
+
+	//A text that doesn't fit leaves an empty buffer, as the secure CRT does
+	if ((0 > length) || ((size_t)length >= bufferSize)) {
+		p_buffer[0] = '\0'; return -1;
+	}
+	return length;
+}
+
+int sscanf_s(const char* p_string, const char* p_format, ...)
+{
+	va_list arguments;
+	int numberOfConversions = 0;
+	va_start(arguments, p_format);
+	numberOfConversions = vsscanf(p_string, p_format, arguments);
+	va_end(arguments);
+	return numberOfConversions;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static void setLastErrorFromErrno(int errorNumber)
+{
+	switch (errorNumber) {
+	case ENOENT:	lastErrorCode = ERROR_FILE_NOT_FOUND; break;
+	case ENOTDIR:	lastErrorCode = ERROR_PATH_NOT_FOUND; break;
+	case EACCES:
+	case EPERM:		lastErrorCode = ERROR_ACCESS_DENIED; break;
+	case EBADF:		lastErrorCode = ERROR_INVALID_HANDLE; break;
+	case ENOMEM:	lastErrorCode = ERROR_NOT_ENOUGH_MEMORY; break;
+	case EEXIST:	lastErrorCode = ERROR_FILE_EXISTS; break;
+	case EINVAL:	lastErrorCode = ERROR_INVALID_PARAMETER; break;
+	case ENOSPC:	lastErrorCode = ERROR_DISK_FULL; break;
+	case EPIPE:		lastErrorCode = ERROR_BROKEN_PIPE; break;
+	default:		lastErrorCode = (DWORD)errorNumber; break;
+	}
+}
+
+static platformHandle* createPlatformHandle(DWORD type)
+{
+	platformHandle* p_handle = NULL;
+	pthread_condattr_t conditionAttributes;
+
+	if (NULL == (p_handle = (platformHandle*)calloc(sizeof(platformHandle), SINGLE_OBJECT))) {
+		lastErrorCode = ERROR_NOT_ENOUGH_MEMORY; return NULL;
+	}
+	p_handle->type = type;
+	p_handle->numberOfReferences = 1;
+	p_handle->fileDescriptor = -1;
+
+	//Timed waits are measured on the monotonic clock (immune to wall clock changes)
+	pthread_mutex_init(&(p_handle->stateMutex), NULL);
+	pthread_condattr_init(&conditionAttributes);
+	pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+	pthread_cond_init(&(p_handle->stateChanged), &conditionAttributes);
+	pthread_condattr_destroy(&conditionAttributes);
+	return p_handle;
+}
+
+static void releasePlatformHandle(platformHandle* p_handle)
+{
+	if (0 < InterlockedDecrement(&(p_handle->numberOfReferences))) return;
+
+	if (-1 != p_handle->fileDescriptor) close(p_handle->fileDescriptor);
+	pthread_cond_destroy(&(p_handle->stateChanged));
+	pthread_mutex_destroy(&(p_handle->stateMutex));
+	free(p_handle);
+}
+
+static platformHandle* fetchPlatformHandle(HANDLE h_object, DWORD type)
+{
+	if ((NULL == h_object) || (INVALID_HANDLE_VALUE == h_object) || (type != ((platformHandle*)h_object)->type)) {
+		lastErrorCode = ERROR_INVALID_HANDLE; return NULL;
+	}
+	return (platformHandle*)h_object;
+}
+
+static void* platformThreadRoutine(void* p_argument)
+{
+	platformHandle* p_handle = (platformHandle*)p_argument;
+	DWORD exitCode = 0;
+
+	//Publishing the kernel thread identifier (CreateThread waits for it)
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	p_handle->threadId = GetCurrentThreadId();
+	pthread_cond_broadcast(&(p_handle->stateChanged));
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+
+	exitCode = p_handle->p_startRoutine(p_handle->p_parameter);
+
+	//Termination - the waiting threads are woken, & the thread lets go of its' reference to the Handle
+	pthread_mutex_lock(&(p_handle->stateMutex));
+	p_handle->exitCode = exitCode;
+	p_handle->terminated = TRUE;
+	pthread_cond_broadcast(&(p_handle->stateChanged));
+	pthread_mutex_unlock(&(p_handle->stateMutex));
+	releasePlatformHandle(p_handle);
+	return NULL;
+}
+
+static BOOL tryToSatisfyWait(platformHandle* p_handle)
+{
+	if (HANDLE_TYPE_THREAD == p_handle->type) return p_handle->terminated;
+
+	//A Mutex is taken when vacant, or recursively by its' owner
+	if (HANDLE_TYPE_MUTEX == p_handle->type) {
+		if ((0 != p_handle->recursionCount) && (0 == pthread_equal(p_handle->owner, pthread_self()))) return FALSE;
+		p_handle->owner = pthread_self();
+		p_handle->recursionCount++;
+		return TRUE;
+	}
+
+	//An auto-reset Event releases a single waiter
+	if (FALSE == p_handle->signalled) return FALSE;
+	if (FALSE == p_handle->manualReset) p_handle->signalled = FALSE;
+	return TRUE;
+}
+
+static void calculateWaitDeadline(DWORD milliseconds, struct timespec* p_deadline)
+{
+	clock_gettime(CLOCK_MONOTONIC, p_deadline);
+	p_deadline->tv_sec += milliseconds / 1000;
+	p_deadline->tv_nsec += (long)(milliseconds % 1000) * NANOSECONDS_PER_MILLISECOND;
+	if (NANOSECONDS_PER_SECOND <= p_deadline->tv_nsec) {
+		p_deadline->tv_sec++;
+		p_deadline->tv_nsec -= NANOSECONDS_PER_SECOND;
+	}
+}
+
+static DWORD calculateRemainingMilliseconds(const struct timespec* p_deadline)
+{
+	struct timespec now;
+	LONGLONG remainingNanoseconds = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	remainingNanoseconds = ((LONGLONG)p_deadline->tv_sec - now.tv_sec) * NANOSECONDS_PER_SECOND + (p_deadline->tv_nsec - now.tv_nsec);
+	return (0 >= remainingNanoseconds) ? 0 : (DWORD)((remainingNanoseconds + NANOSECONDS_PER_MILLISECOND - 1) / NANOSECONDS_PER_MILLISECOND);
+}
+
+static void convertTimespecToFileTime(const struct timespec* p_time, LPFILETIME p_fileTime)
+{
+	ULONGLONG intervals = 0;
+	if (NULL == p_fileTime) return;
+
+	intervals = FILETIME_UNIX_EPOCH + (ULONGLONG)p_time->tv_sec * FILETIME_INTERVALS_PER_SECOND + (ULONGLONG)(p_time->tv_nsec / NANOSECONDS_PER_FILETIME_INTERVAL);
+	p_fileTime->dwLowDateTime = (DWORD)intervals;
+	p_fileTime->dwHighDateTime = (DWORD)(intervals >> 32);
+}
@@ -0,0 +1,238 @@
+/* Windows.h (Linux platform layer)
+---------------------------------------------------------------------------------
+	Module Description - header module for PlatformLinux.c. On Linux this
+		directory is placed first on the include path, so every module's
+		#include <Windows.h> finds the subset of the Windows API the solver uses,
+		implemented over POSIX: threads are pthreads, the locks park on futexes
+		(WaitOnAddress), file I/O uses read/write or pread/pwrite (OVERLAPPED
+		offsets), and file mappings are mmap views. The solver's modules are
+		compiled unchanged against it.
+		The types keep their Windows widths (LLP64): DWORD & LONG are 32-bit,
+		so the tasks container's binary layout is identical on both platforms.
+---------------------------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __PLATFORM_LINUX_WINDOWS_H__
+#define __PLATFORM_LINUX_WINDOWS_H__
+
+
+// Library includes --------------------------------------------
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <limits.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+// Types -------------------------------------------------------
+typedef int BOOL;
+typedef unsigned char BYTE, *PBYTE;
+typedef unsigned short WORD;
+typedef uint32_t DWORD, ULONG, *PDWORD, *LPDWORD;
+typedef int32_t LONG, *PLONG;
+typedef long long LONGLONG, LONG64;
+typedef unsigned long long DWORDLONG, ULONGLONG, *PDWORDLONG, *PULONGLONG;
+typedef unsigned int UINT;
+typedef size_t SIZE_T;
+typedef int errno_t;
+typedef char CHAR, TCHAR, *LPTSTR, *LPSTR;
+typedef const char* LPCSTR, *LPCTSTR;
+typedef void* HANDLE, *LPVOID, *PVOID;
+typedef const void* LPCVOID;
+typedef DWORD (*LPTHREAD_START_ROUTINE)(LPVOID lpThreadParameter);
+
+typedef union _LARGE_INTEGER {
+	struct {
+		DWORD LowPart;
+		LONG HighPart;
+	};
+	LONGLONG QuadPart;
+}LARGE_INTEGER, *PLARGE_INTEGER;
+
+	//100 nano-seconds intervals since January 1, 1601 (UTC)
+typedef struct _FILETIME {
+	DWORD dwLowDateTime;
+	DWORD dwHighDateTime;
+}FILETIME, *LPFILETIME;
+
+	//Only the offset is used - ReadFile\WriteFile with an OVERLAPPED offset are positional (pread\pwrite), the I/O is always synchronous
+typedef struct _OVERLAPPED {
+	uintptr_t Internal;
+	uintptr_t InternalHigh;
+	union {
+		struct {
+			DWORD Offset;
+			DWORD OffsetHigh;
+		};
+		PVOID Pointer;
+	};
+	HANDLE hEvent;
+}OVERLAPPED, *LPOVERLAPPED;
+
+
+// Constants ---------------------------------------------------
+#define WINAPI
+#define TRUE 1
+#define FALSE 0
+#define MAXDWORD 0xffffffff
+#define INFINITE 0xFFFFFFFF
+#define STILL_ACTIVE 259
+
+	//Wait functions' outcomes
+#define WAIT_OBJECT_0 0x00000000L
+#define WAIT_ABANDONED_0 0x00000080L
+#define WAIT_TIMEOUT 258L
+#define WAIT_FAILED ((DWORD)0xFFFFFFFF)
+
+	//GetLastError codes (errno values are translated to these, the rest are returned as is)
+#define ERROR_SUCCESS 0L
+#define ERROR_FILE_NOT_FOUND 2L
+#define ERROR_PATH_NOT_FOUND 3L
+#define ERROR_ACCESS_DENIED 5L
+#define ERROR_INVALID_HANDLE 6L
+#define ERROR_NOT_ENOUGH_MEMORY 8L
+#define ERROR_HANDLE_EOF 38L
+#define ERROR_NOT_SUPPORTED 50L
+#define ERROR_FILE_EXISTS 80L
+#define ERROR_INVALID_PARAMETER 87L
+#define ERROR_BROKEN_PIPE 109L
+#define ERROR_DISK_FULL 112L
+#define ERROR_NOT_OWNER 288L
+#define ERROR_TIMEOUT 1460L
+
+	//CreateFile's access, sharing (accepted & ignored - POSIX has no mandatory sharing modes), dispositions & flags
+#define GENERIC_READ 0x80000000
+#define GENERIC_WRITE 0x40000000
+#define FILE_APPEND_DATA 0x00000004
+#define FILE_SHARE_READ 0x00000001
+#define FILE_SHARE_WRITE 0x00000002
+#define FILE_SHARE_DELETE 0x00000004
+#define CREATE_NEW 1
+#define CREATE_ALWAYS 2
+#define OPEN_EXISTING 3
+#define OPEN_ALWAYS 4
+#define TRUNCATE_EXISTING 5
+#define FILE_ATTRIBUTE_NORMAL 0x00000080
+#define FILE_FLAG_SEQUENTIAL_SCAN 0x08000000
+#define FILE_FLAG_RANDOM_ACCESS 0x10000000
+#define INVALID_HANDLE_VALUE ((HANDLE)(intptr_t)-1)
+
+	//File pointer move methods
+#define FILE_BEGIN 0
+#define FILE_CURRENT 1
+#define FILE_END 2
+#define INVALID_SET_FILE_POINTER ((DWORD)-1)
+
+	//File mapping (read only views)
+#define PAGE_READONLY 0x02
+#define FILE_MAP_READ 0x0004
+
+
+// Inline functions --------------------------------------------
+	//Interlocked operations - sequentially consistent, like the Windows ones (full barriers)
+static inline LONG InterlockedIncrement(volatile LONG* p_target) { return __atomic_add_fetch(p_target, 1, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedDecrement(volatile LONG* p_target) { return __atomic_sub_fetch(p_target, 1, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedExchange(volatile LONG* p_target, LONG value) { return __atomic_exchange_n(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedExchangeAdd(volatile LONG* p_target, LONG value) { return __atomic_fetch_add(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedOr(volatile LONG* p_target, LONG value) { return __atomic_fetch_or(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedAnd(volatile LONG* p_target, LONG value) { return __atomic_fetch_and(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONG InterlockedCompareExchange(volatile LONG* p_target, LONG exchange, LONG comparand)
+{
+	__atomic_compare_exchange_n(p_target, &comparand, exchange, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return comparand;
+}
+static inline LONGLONG InterlockedIncrement64(volatile LONGLONG* p_target) { return __atomic_add_fetch(p_target, 1, __ATOMIC_SEQ_CST); }
+static inline LONGLONG InterlockedDecrement64(volatile LONGLONG* p_target) { return __atomic_sub_fetch(p_target, 1, __ATOMIC_SEQ_CST); }
+static inline LONGLONG InterlockedExchange64(volatile LONGLONG* p_target, LONGLONG value) { return __atomic_exchange_n(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONGLONG InterlockedExchangeAdd64(volatile LONGLONG* p_target, LONGLONG value) { return __atomic_fetch_add(p_target, value, __ATOMIC_SEQ_CST); }
+static inline LONGLONG InterlockedCompareExchange64(volatile LONGLONG* p_target, LONGLONG exchange, LONGLONG comparand)
+{
+	__atomic_compare_exchange_n(p_target, &comparand, exchange, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return comparand;
+}
+static inline PVOID InterlockedCompareExchangePointer(PVOID volatile* p_target, PVOID exchange, PVOID comparand)
+{
+	__atomic_compare_exchange_n(p_target, &comparand, exchange, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return comparand;
+}
+static inline void MemoryBarrier(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+	//Spin-wait hint & the time-stamp counter (a monotonic nano-seconds clock where the processor has no time-stamp counter)
+#if defined(__x86_64__) || defined(__i386__)
+static inline void YieldProcessor(void) { _mm_pause(); }
+static inline ULONGLONG ReadTimeStampCounter(void) { return (ULONGLONG)__rdtsc(); }
+#else
+static inline void YieldProcessor(void) { __asm__ __volatile__("" ::: "memory"); }
+ULONGLONG ReadTimeStampCounter(void);
+#endif
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - Errors & threads: the calling thread's last error code (errno values translated), its' kernel thread identifier,
+///		thread creation (a pthread whose routine's return value is its' exit code) & its' exit code (STILL_ACTIVE while it runs).
+/// </summary>
+DWORD GetLastError(void);
+DWORD GetCurrentThreadId(void);
+HANDLE CreateThread(LPVOID p_threadAttributes, SIZE_T stackSize, LPTHREAD_START_ROUTINE p_startRoutine, LPVOID p_parameter, DWORD creationFlags, LPDWORD p_threadId);
+BOOL GetExitCodeThread(HANDLE h_thread, LPDWORD p_exitCode);
+/// <summary>
+///	 Description - Synchronous objects: a recursive Mutex owned by its' locking thread, auto\manual-reset Events, and the waits for them &
+///		for threads' termination. WaitForMultipleObjects supports waiting for all the objects only (the solver's only use).
+/// </summary>
+HANDLE CreateMutex(LPVOID p_mutexAttributes, BOOL initialOwner, LPCSTR p_name);
+BOOL ReleaseMutex(HANDLE h_mutex);
+HANDLE CreateEvent(LPVOID p_eventAttributes, BOOL manualReset, BOOL initialState, LPCSTR p_name);
+BOOL SetEvent(HANDLE h_event);
+BOOL ResetEvent(HANDLE h_event);
+DWORD WaitForSingleObject(HANDLE h_object, DWORD milliseconds);
+DWORD WaitForMultipleObjects(DWORD numberOfObjects, const HANDLE* p_objects, BOOL waitAll, DWORD milliseconds);
+BOOL CloseHandle(HANDLE h_object);
+/// <summary>
+///	 Description - Address waits: a futex wait on a 4-byte value while it equals the compared value, & the wakes of its' waiters.
+/// </summary>
+BOOL WaitOnAddress(volatile void* p_address, PVOID p_compareAddress, SIZE_T addressSize, DWORD milliseconds);
+void WakeByAddressSingle(PVOID p_address);
+void WakeByAddressAll(PVOID p_address);
+/// <summary>
+///	 Description - Time: Sleep, a monotonic milli-seconds tick count, and a nano-seconds performance counter.
+/// </summary>
+void Sleep(DWORD milliseconds);
+ULONGLONG GetTickCount64(void);
+BOOL QueryPerformanceCounter(LARGE_INTEGER* p_performanceCount);
+BOOL QueryPerformanceFrequency(LARGE_INTEGER* p_frequency);
+/// <summary>
+///	 Description - Files: a file descriptor per Handle. Without an OVERLAPPED struct ReadFile\WriteFile use the file pointer (read\write),
+///		with one they are positional (pread\pwrite) & leave the file pointer as is. A positional ReadFile at the end of the file fails with
+///		ERROR_HANDLE_EOF, as on a synchronous Windows Handle.
+/// </summary>
+HANDLE CreateFile(LPCSTR p_fileName, DWORD desiredAccess, DWORD shareMode, LPVOID p_securityAttributes, DWORD creationDisposition, DWORD flagsAndAttributes, HANDLE h_templateFile);
+BOOL ReadFile(HANDLE h_file, LPVOID p_buffer, DWORD numberOfBytesToRead, LPDWORD p_numberOfBytesRead, LPOVERLAPPED p_overlapped);
+BOOL WriteFile(HANDLE h_file, LPCVOID p_buffer, DWORD numberOfBytesToWrite, LPDWORD p_numberOfBytesWritten, LPOVERLAPPED p_overlapped);
+BOOL SetFilePointerEx(HANDLE h_file, LARGE_INTEGER distanceToMove, PLARGE_INTEGER p_newFilePointer, DWORD moveMethod);
+DWORD SetFilePointer(HANDLE h_file, LONG distanceToMove, PLONG p_distanceToMoveHigh, DWORD moveMethod);
+BOOL SetEndOfFile(HANDLE h_file);
+BOOL GetFileSizeEx(HANDLE h_file, PLARGE_INTEGER p_fileSize);
+BOOL GetFileTime(HANDLE h_file, LPFILETIME p_creationTime, LPFILETIME p_lastAccessTime, LPFILETIME p_lastWriteTime);
+BOOL FlushFileBuffers(HANDLE h_file);
+BOOL DeleteFile(LPCSTR p_fileName);
+/// <summary>
+///	 Description - File mappings: read only mmap views of a file (the mapping's size - the file's size when 0 is given).
+/// </summary>
+HANDLE CreateFileMapping(HANDLE h_file, LPVOID p_attributes, DWORD protection, DWORD maximumSizeHigh, DWORD maximumSizeLow, LPCSTR p_name);
+LPVOID MapViewOfFile(HANDLE h_fileMapping, DWORD desiredAccess, DWORD fileOffsetHigh, DWORD fileOffsetLow, SIZE_T numberOfBytesToMap);
+BOOL UnmapViewOfFile(LPCVOID p_baseAddress);
+/// <summary>
+///	 Description - The secure CRT functions the solver uses: sprintf_s (an empty buffer & -1 when the text doesn't fit), and sscanf_s for numeric conversions only
+///		(no %s\%c\%[ - they would expect buffer sizes).
+/// </summary>
+int sprintf_s(char* p_buffer, size_t bufferSize, const char* p_format, ...) __attribute__((format(printf, 3, 4)));
+int sscanf_s(const char* p_string, const char* p_format, ...);
+
+
+#endif //__PLATFORM_LINUX_WINDOWS_H__
@@ -1,7 +1,8 @@
 /* Lock.c
 ------------------------------------------------------------------------------------------
-	Module Description - This module contains functions meant for freeing dynamic memory
-	allocations & for closing WINAPI Handles.
+	Module Description - This module contains functions meant for the resources' Readers\
+	Writers locks: every lock is a single atomic state word (a Writer bit that serves as
+	the turnstile & a Readers count) - threads only park (WaitOnAddress) under contention.
 ------------------------------------------------------------------------------------------
 */
 
@@ -23,158 +24,231 @@ static const BOOL  STATUS_CODE_SUCCESS = TRUE;
 
 static const DWORD SINGLE_OBJECT = 1;
 
-static const DWORD TIMEOUT_BASE_CONSTANT_MS = 1; //1 milli-second
-static const DWORD RESOURCE_IS_NOT_EMPTY = 1;
-static const DWORD RESOURCE_IS_EMPTY = 0;
 
 static const DWORD READ_ACCESS = 1;
-static const DWORD RELEASE_TURNSTILE_MUTEX_FAILED = 0;
-static const DWORD RELEASE_EMPTY_RESOURCE_SEMAPHORE_FAILED = 0;
 
+static const LONG LOCK_STATE_WRITER = 0x1;		//State word's Writer bit - a Writer holds the turnstile (inside the resource, or waiting for the Readers to leave)
+static const LONG LOCK_STATE_READER = 0x2;		//State word's Readers count unit - the count occupies the bits above the Writer bit
 
-// Global Variables
-static int numberOfRealTimeReadersCounter = 0;
+static const LONGLONG  LOCK_HOLD_AVERAGE_WEIGHT_SHIFT = 3;		//Every hold time moves the average by 1/8 of its' difference from it
+static const ULONGLONG LOCK_SPIN_HOLD_MULTIPLIER = 2;			//A waiter spins up to twice the average hold time
+static const ULONGLONG LOCK_MINIMAL_SPIN_CYCLES = 1000;		//Time-stamp counter cycles - the shortest spin (also before any hold was measured)
+static const ULONGLONG LOCK_MAXIMAL_SPIN_CYCLES = 50000;		//Time-stamp counter cycles (~10-20 micro-seconds) - beyond it, parking is cheaper than spinning
+
+static const ULONGLONG NO_LOCK_DEADLINE = 0;					//The blocking acquisitions wait with no time cap
+
+static const double LOCK_PROFILE_MEDIAN = 0.5;
+static const double LOCK_PROFILE_TAIL = 0.99;
+static const double MICROSECONDS_PER_SECOND = 1000000.0;
 
 
 
 // Functions declerations ------------------------------------------------------------------
 
 /// <summary>
-///  Description - This function performs the WaitForSingleObject(.) WINAPI function with a given timeout value, in order to receive ownership\signalling of
-///		a Mutex\(Binary)Semaphore synchronous object. In case of timeout the entire program is said to have failed to solve all tasks in a proper matter, and 
-///		the program will initiate exitting procedure.
+///  Description - This function waits until the lock's state word differs from the state the thread observed: it spins first (unless spinning
+///		is disabled), then parks on the state word (WaitOnAddress) until the deadline - with no time cap for the blocking acquisitions, where a
+///		stuck solving is detected by the progress watchdog instead. The parked threads are counted, so the releasing threads wake them only if there are any.
 /// </summary>
-/// <param name="HANDLE* p_h_objectHandle - A pointer to Synchronous Object's handle"></param>
-/// <param name="DWORD timeout - An unsigned integer value representing the timeout duration until WaitForSingleObject(.) should stop waiting"></param>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+/// <param name="LONG observedState - The state word's value the thread observed (& can't proceed with)"></param>
 /// <param name="DWORD readOrWriteState - An unsigned integer indicating whether the lock is requested for a Reading request or Writing request, and helps choosing a suitable failure message"></param>
-/// <returns>A BOOL value representing the function's outcome (Syncronous object "capturing"). Success (TRUE) or Failure (False) e.g. timeout or abondonment</returns>
-static BOOL waitForSynchronousObjectToSignalOrUnlock(HANDLE* p_h_objectHandle, DWORD timeout, DWORD readOrWriteState);
+/// <param name="ULONGLONG deadline - The tick count (milli-seconds) the wait ends at, or NO_LOCK_DEADLINE"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - the state may have changed or the deadline passed, or Failure (False) e.g. the wait failed</returns>
+static BOOL waitForLockStateToChange(lock* p_lock, LONG observedState, DWORD readOrWriteState, ULONGLONG deadline);
+/// <summary>
+///  Description - This function grants a reading access, waiting (spinning, then parking) while a Writer holds the turnstile - until the deadline.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+/// <param name="ULONGLONG deadline - The tick count (milli-seconds) to give up at, or NO_LOCK_DEADLINE"></param>
+/// <returns>Success (TRUE) - the access was granted, or Failure (False) - the deadline passed or the wait failed</returns>
+static BOOL acquireReadAccess(lock* p_lock, ULONGLONG deadline);
+/// <summary>
+///  Description - This function grants a writing access: it takes the turnstile & waits for the Readers inside to leave - until the deadline.
+///		If the deadline passes while the Readers drain, the turnstile is released.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+/// <param name="ULONGLONG deadline - The tick count (milli-seconds) to give up at, or NO_LOCK_DEADLINE"></param>
+/// <returns>Success (TRUE) - the access was granted, or Failure (False) - the deadline passed or the wait failed</returns>
+static BOOL acquireWriteAccess(lock* p_lock, ULONGLONG deadline);
+/// <summary>
+///  Description - This function calculates a timed acquisition's deadline.
+/// </summary>
+/// <param name="DWORD milliseconds - The acquisition's time limit (INFINITE - none)"></param>
+/// <returns>The deadline's tick count (milli-seconds), or NO_LOCK_DEADLINE</returns>
+static ULONGLONG calculateLockDeadline(DWORD milliseconds);
+/// <summary>
+///  Description - This function spins (with pause instructions) while the lock's state word still holds the state the thread observed, for up to
+///		twice the recent Writers' average hold time. If the average hold is longer than the maximal spin, it doesn't spin at all.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+/// <param name="LONG observedState - The state word's value the thread observed (& can't proceed with)"></param>
+/// <returns>TRUE if the state word changed while spinning, FALSE otherwise (the thread should park)</returns>
+static BOOL spinForLockStateToChange(lock* p_lock, LONG observedState);
+/// <summary>
+///  Description - This function marks the beginning of a profiled thread's wait for the lock: it counts the thread as a contender (updating the
+///		maximal # of contenders) & returns the wait's start time.
+/// </summary>
+/// <param name="lockProfile* p_profile - A pointer to the lock's profile"></param>
+/// <returns>The wait's start time (time-stamp counter, never 0)</returns>
+static ULONGLONG beginProfiledLockWait(lockProfile* p_profile);
+/// <summary>
+///  Description - This function records a granted access in the lock's profile: its' mode, and if it waited - its' wait time (the thread stops
+///		being a contender). The first Reader of a shared period also marks the period's beginning.
+/// </summary>
+/// <param name="lockProfile* p_profile - A pointer to the lock's profile"></param>
+/// <param name="DWORD readOrWriteState - READ_ACCESS for a reading access, a writing access otherwise"></param>
+/// <param name="ULONGLONG waitStart - The wait's start time (0 - the access was granted right away)"></param>
+/// <param name="LONG previousState - The state word's value the access was granted upon"></param>
+static void recordProfiledLockAcquisition(lockProfile* p_profile, DWORD readOrWriteState, ULONGLONG waitStart, LONG previousState);
+/// <summary>
+///  Description - This function adds a time to a profile's log2 histogram & to its' sum.
+/// </summary>
+/// <param name="volatile LONG* p_histogram - A pointer to the histogram's buckets"></param>
+/// <param name="volatile LONGLONG* p_totalCycles - A pointer to the times' sum"></param>
+/// <param name="ULONGLONG cycles - The time (time-stamp counter cycles)"></param>
+static void addToLockProfileHistogram(volatile LONG* p_histogram, volatile LONGLONG* p_totalCycles, ULONGLONG cycles);
+/// <summary>
+///  Description - This function finds the upper bound of the histogram's bucket in which a given fraction of the counted times end.
+/// </summary>
+/// <param name="volatile LONG* p_histogram - A pointer to the histogram's buckets"></param>
+/// <param name="double fraction - The fraction of the counted times (e.g. 0.99)"></param>
+/// <returns>The bucket's upper bound (time-stamp counter cycles), or 0 if the histogram is empty</returns>
+static ULONGLONG findLockProfilePercentile(volatile LONG* p_histogram, double fraction);
+/// <summary>
+///  Description - This function calibrates the time-stamp counter against the performance counter, over the time since profiling began.
+/// </summary>
+/// <param name="lockProfile* p_profile - A pointer to the lock's profile"></param>
+/// <returns>The # of time-stamp counter cycles per micro-second (at least 1)</returns>
+static double calculateCyclesPerMicrosecond(lockProfile* p_profile);
+/// <summary>
+///  Description - This function appends a profile's histogram to a JSON text, as an array of its' non-empty buckets' upper bounds (micro-seconds) & counts.
+/// </summary>
+/// <param name="char* p_json - A pointer to the JSON text's buffer"></param>
+/// <param name="size_t jsonSize - The buffer's size (bytes)"></param>
+/// <param name="size_t* p_jsonLength - A pointer to the JSON text's length (updated)"></param>
+/// <param name="const char* p_histogramName - A pointer to the histogram's JSON key"></param>
+/// <param name="volatile LONG* p_histogram - A pointer to the histogram's buckets"></param>
+/// <param name="double cyclesPerMicrosecond - The time-stamp counter's calibration"></param>
+static void appendLockProfileHistogramJson(char* p_json, size_t jsonSize, size_t* p_jsonLength, const char* p_histogramName, volatile LONG* p_histogram, double cyclesPerMicrosecond);
+/// <summary>
+///  Description - This function wakes all the threads parked on the lock's state word, if there are any (no kernel call otherwise).
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+static void wakeLockWaiters(lock* p_lock);
 
 
 // Functions definitions ------------------------------------------------------------------
 
-lock* InitializeLock()
+lock* InitializeLock(const char* p_lockName)
 {
 	lock* p_lock = NULL;
 	//Lock struct dynamic memory allocation
 	if (NULL == (p_lock = (lock*)calloc(sizeof(lock), SINGLE_OBJECT))) {
-		printf("Error: Failed to allocate memory for a Queue struct.\n");
+		printf("Error: Failed to allocate memory for a Lock struct.\n");
 		printf("At file: %s\nAt line number: %d\nAt function: %s", __FILE__, __LINE__, __func__);
 		return NULL;
 	}
 
-	//Memory allocation for the Lock struct has been successful
+	p_lock->p_name = p_lockName;
+
+	//Memory allocation for the Lock struct has been successful (a zeroed state word - a vacant resource)
 	return p_lock;
 }
 
-BOOL read_lock(lock* p_lock)
+BOOL enableLockProfiling(lock* p_lock)
 {
 	//Input integrity validation
 	if (NULL == p_lock) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 
-	//Obtain Ownership of the Turnstile mutex that chooses between a new Reader to a new Writer...(even when there might be Readers inside the resource)
-	//Explanation: Basically I had a hard time understding whether this part should remain outside of the read_lock function or within it,
-	//	since, read_lock must always return with a positive result, if there are already Reader\s accessing the resource (Meaning,
-	//	the file has already been locked for reading). But in the case a new Writer has arrived and OWNED the Turnstile mutex, then, new Readers
-	//  would remain waiting from accessing the resource for READING, EVEN if there are already Readers inside the resource as contrary to the
-	//	multiple Readers constraint, and when their waiting timeout reached the thread would quit with a fail message.
-	//  Finally, I decided to insert the Turnstile mutex aquisition inside the read_lock function, as part of a "Load Balancing" regime 
-	//	(between Writer & Readers) which is in fact a RACE to own the Turstile mutex lock in order to prevent STARVATION, even though
-	//  a new Reader might have to wait when the resource is locked for reading (and there are Readers reading the resource), and would have
-	//	to wait until the Writer owning the Turstile mutex will receive the "EmptyRoom" Semaphore signalling, enter the resource,
-	//	write its' task, leave and signal back the Semaphore & Turstile mutex
-	// Differently, leaving the Turstile mutex aquisition outside this function (Meaning, in the thread's regime), would statisfy the description
-	//  completely ("If the resource is locked for reading, so read_lock will always return without any wait, for a new reader"), but wouldn't
-	//  be elegant and would demand a programmer using the Lock.c module to always program this part as well..  I hope its' fine..
-	if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-		p_lock->p_h_turnstileMutex,															//Mutex handle pointer
-		TIMEOUT_BASE_CONSTANT_MS * MAX_LENGTH_TASK * p_lock->numberOfThreads,				//Timeout = (Max task length)*#Threads milliSeconds * 2
-		READ_ACCESS																			//Reading bit, for printing appropriate failure message if needed
-	))   return STATUS_CODE_FAILURE; //add another message in Thread func.
-
-
-	//Release Turnstile mutex IMMEDIATELY after owning it & begin resource entrance regime 
-	if (RELEASE_TURNSTILE_MUTEX_FAILED == ReleaseMutex(*(p_lock->p_h_turnstileMutex))) {
-		printf("Error: Thread no. %lu failed to release Turnstile mutex to begin reading a resource with code: %d.\nExiting\n", GetCurrentThreadId(), GetLastError());
+	//Profile struct dynamic memory allocation (zeroed counters & histograms)
+	if (NULL == (p_lock->p_profile = (lockProfile*)calloc(sizeof(lockProfile), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for a Lock profile struct.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s", __FILE__, __LINE__, __func__);
 		return STATUS_CODE_FAILURE;
 	}
 
+	//The calibration's beginning
+	QueryPerformanceCounter(&(p_lock->p_profile->startCounter));
+	p_lock->p_profile->startTimestamp = ReadTimeStampCounter();
+	return STATUS_CODE_SUCCESS;
+}
 
+void printLockStatistics(lock* p_lock)
+{
+	//Input integrity validation
+	if (NULL == p_lock) return;
 
+	printf("%s lock: %ld contended waits, %ld ended while spinning, %ld parks, %ld unacquired try or timed attempts, average write hold %lld cycles%s\n", p_lock->p_name,
+		(long)p_lock->numberOfContendedWaits, (long)p_lock->numberOfSpinAcquisitions, (long)p_lock->numberOfParks, (long)p_lock->numberOfUnacquiredAttempts, p_lock->averageHoldCycles,
+		(TRUE == p_lock->spinningDisabled) ? " (spinning disabled)" : "");
+}
 
-	//Obtain Ownership of the Readers entrance\departure passage mutex that updates the current number of Readers reading the resource atomically...
-	if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-		p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex,					//Mutex handle pointer
-		TIMEOUT_BASE_CONSTANT_MS * p_lock->numberOfThreads,								//Timeout = #Threads milliSeconds
-		READ_ACCESS																		//Reading bit, for printing appropriate failure message if needed
-	))   return STATUS_CODE_FAILURE; //add another message in Thread func.
-	
-	//Adding '1' to the Readers currently reading the resource
-	numberOfRealTimeReadersCounter++;
-
-	//Vlidating if the entering Reader is the first reader of the following bunch of Readers (If there will be one)
-	if(RESOURCE_IS_NOT_EMPTY == numberOfRealTimeReadersCounter)
-		//Singalling OFF the semaphore that is responsible over entry of Writer\Readers to the resource..
-		if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-			p_lock->p_h_vaccantResourceStatusSemphore,									//Semaphore handle pointer
-			TIMEOUT_BASE_CONSTANT_MS * MAX_LENGTH_TASK * p_lock->numberOfThreads,		//Timeout = (Max task length)*#Threads milliSeconds
-			READ_ACCESS																	//Reading bit, for printing appropriate failure message if needed
-		))	return STATUS_CODE_FAILURE; //add another message in Thread func.
-
-	//Before finishing executing the Read lock & letting the thread proceed to read its' desired contents from the resource,
-	// we release the entrance\departure procedure mutex...
-	if (RELEASE_TURNSTILE_MUTEX_FAILED == ReleaseMutex(*(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex))) {
-		printf("Error: Thread no. %lu failed to release Turnstile mutex to begin reading a resource with code: %d.\nExiting\n", GetCurrentThreadId(), GetLastError());
-		return STATUS_CODE_FAILURE;
+BOOL read_lock(lock* p_lock)
+{
+	//Input integrity validation
+	if (NULL == p_lock) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
+	return acquireReadAccess(p_lock, NO_LOCK_DEADLINE);
+}
 
+BOOL try_read_lock(lock* p_lock)
+{
+	LONG observedState = 0;
+	//Input integrity validation
+	if (NULL == p_lock) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
 
+	//Entering only while no Writer holds the turnstile (a compare-and-swap lost to another Reader is retried - the lock isn't busy)
+	while (0 == ((observedState = p_lock->state) & LOCK_STATE_WRITER)) {
+		if (observedState != InterlockedCompareExchange(&(p_lock->state), observedState + LOCK_STATE_READER, observedState)) continue;
+		if (NULL != p_lock->p_profile) recordProfiledLockAcquisition(p_lock->p_profile, READ_ACCESS, 0, observedState);
+		return STATUS_CODE_SUCCESS;
+	}
+	InterlockedIncrement(&(p_lock->numberOfUnacquiredAttempts));
+	return STATUS_CODE_FAILURE;
+}
 
-
-	//Read locking was successful..
-	return STATUS_CODE_SUCCESS;
+BOOL timed_read_lock(lock* p_lock, DWORD milliseconds)
+{
+	//Input integrity validation
+	if (NULL == p_lock) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	return acquireReadAccess(p_lock, calculateLockDeadline(milliseconds));
 }
 
 BOOL read_release(lock* p_lock)
 {
+	LONG remainingState = 0;
+	ULONGLONG readPeriodStart = 0;
 	//Input integrity validation
 	if (NULL == p_lock) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 
-	//Begin resource departure regime....
-
-	//Obtain Ownership of the Readers entrance\departure passage mutex that updates the current number of Readers reading the resource atomically...
-	if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-		p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex,					//Mutex handle pointer
-		TIMEOUT_BASE_CONSTANT_MS * p_lock->numberOfThreads,								//Timeout = #Threads milliSeconds
-		READ_ACCESS																		//Reading bit, for printing appropriate failure message if needed
-	))   return STATUS_CODE_FAILURE; //add another message in Thread func.
-
-	//Substracting '1' to the Readers currently reading the resource
-	numberOfRealTimeReadersCounter--;
+	//The shared period's beginning is read while the Reader is still inside (the period can't end & restart meanwhile)
+	if (NULL != p_lock->p_profile) readPeriodStart = p_lock->p_profile->readPeriodStartTimestamp;
 
-	//Validating whther this exiting Reader is the last Reader in the bunch
-	if (RESOURCE_IS_EMPTY == numberOfRealTimeReadersCounter)
-		//Singalling ON the semaphore that is responsible over entry of Writer\Readers to the resource, if all readers left...
-		if (RELEASE_EMPTY_RESOURCE_SEMAPHORE_FAILED == ReleaseSemaphore(
-			*(p_lock->p_h_vaccantResourceStatusSemphore),							//Semaphore handle 
-			1,																		//Rise the Semaphore count by 1 only!
-			NULL																	//No need to validate the previous count
-		)) {
-			printf("Error: Thread no. %lu failed to signal the vacant-resource-Semaphore with code: %d.\nExiting\n", GetCurrentThreadId(), GetLastError());
-			return STATUS_CODE_FAILURE;
-		}
-
-	//Before finishing executing the Read lock release & letting the thread proceed to further operations,
-	// we release the entrance\departure procedure mutex...
-	if (RELEASE_TURNSTILE_MUTEX_FAILED == ReleaseMutex(*(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex))) {
-		printf("Error: Thread no. %lu failed to release Turnstile mutex to begin reading a resource with code: %d.\nExiting\n", GetCurrentThreadId(), GetLastError());
+	//Substracting '1' from the Readers currently reading the resource
+	remainingState = InterlockedExchangeAdd(&(p_lock->state), -LOCK_STATE_READER) - LOCK_STATE_READER;
+	if (0 > remainingState) {
+		InterlockedExchangeAdd(&(p_lock->state), LOCK_STATE_READER);
+		printf("Error: Thread no. %lu released a reading access it wasn't granted.\n", (unsigned long)GetCurrentThreadId());
 		return STATUS_CODE_FAILURE;
 	}
 
+	//The last Reader to leave ends the shared period, & lets in the Writer that holds the turnstile
+	if ((NULL != p_lock->p_profile) && (LOCK_STATE_READER > remainingState)) {
+		InterlockedIncrement(&(p_lock->p_profile->numberOfReadPeriods));
+		addToLockProfileHistogram(p_lock->p_profile->readHoldTimeHistogram, &(p_lock->p_profile->totalReadHoldCycles), ReadTimeStampCounter() - readPeriodStart);
+	}
+	if (LOCK_STATE_WRITER == remainingState) wakeLockWaiters(p_lock);
+
 	//Read lock release was successful..
 	return STATUS_CODE_SUCCESS;
 }
@@ -188,64 +262,54 @@ BOOL write_lock(lock* p_lock)
 	if (NULL == p_lock) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
+	return acquireWriteAccess(p_lock, NO_LOCK_DEADLINE);
+}
 
-	//Obtain Ownership of the Turnstile mutex that chooses between a new Reader to a new Writer...
-	if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-		p_lock->p_h_turnstileMutex,														//Mutex handle pointer
-		TIMEOUT_BASE_CONSTANT_MS * MAX_LENGTH_TASK * p_lock->numberOfThreads,			//Timeout = (Max task length)*#Threads milliSeconds
-		READ_ACCESS-1																	//Writing bit, for printing appropriate failure message if needed
-	))   return STATUS_CODE_FAILURE; //add another message in Thread func.
-
-
-	/* ---------------------------------------------------------------------------------------------------------- */
-    /* NOT ALL RESOURCES HAVE READERS (WRITERS ONLY RESOURCE) -> SO THEIR LOCK WILL ONLY HAVE THE TURNSTILE MUTEX */
-    /* ---------------------------------------------------------------------------------------------------------- */
-	if(NULL != p_lock->p_h_vaccantResourceStatusSemphore)
-		//If Semaphore is signalling, the Writer may decrease its' count & enter the resource for a writing operation..
-		if (STATUS_CODE_FAILURE == waitForSynchronousObjectToSignalOrUnlock(
-			p_lock->p_h_vaccantResourceStatusSemphore,											//Semaphore handle pointer
-			TIMEOUT_BASE_CONSTANT_MS * MAX_LENGTH_TASK *p_lock->numberOfThreads,				//Timeout = (Max task length)*#Threads milliSeconds * 10
-			READ_ACCESS - 1																		//Writing bit, for printing appropriate failure message if needed
-		)) {
-			//Release Turnstile mutex in case of Readers not vacating the resource fast enough!!!!!! 
-			if (RELEASE_TURNSTILE_MUTEX_FAILED == ReleaseMutex(*(p_lock->p_h_turnstileMutex))) {
-				printf("Error: Thread no. %lu failed to release Turnstile mutex to finish writing to a resource with code: %d.\nExiting...\n", GetCurrentThreadId(), GetLastError());
-				return STATUS_CODE_FAILURE;
-			}
-			return STATUS_CODE_FAILURE; //add another message in Thread func.
-		}
+BOOL try_write_lock(lock* p_lock)
+{
+	//Input integrity validation
+	if (NULL == p_lock) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
 
-	//Writer may now access the resource & perform a witing operation (Writing lock succeeded)
+	//Only a vacant lock is taken - no Writer holds the turnstile & no Reader is inside (a single compare-and-swap, never a wait)
+	if (0 != InterlockedCompareExchange(&(p_lock->state), LOCK_STATE_WRITER, 0)) {
+		InterlockedIncrement(&(p_lock->numberOfUnacquiredAttempts));
+		return STATUS_CODE_FAILURE;
+	}
+	if (NULL != p_lock->p_profile) recordProfiledLockAcquisition(p_lock->p_profile, READ_ACCESS - 1, 0, 0);
+	p_lock->writerAcquiredTimestamp = ReadTimeStampCounter();
 	return STATUS_CODE_SUCCESS;
 }
 
-BOOL write_release(lock* p_lock)
+BOOL timed_write_lock(lock* p_lock, DWORD milliseconds)
 {
 	//Input integrity validation
 	if (NULL == p_lock) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
+	return acquireWriteAccess(p_lock, calculateLockDeadline(milliseconds));
+}
 
-	//Release Turnstile mutex & finish resource departure regime (Writing) 
-	if (RELEASE_TURNSTILE_MUTEX_FAILED == ReleaseMutex(*(p_lock->p_h_turnstileMutex))) {
-		printf("Error: Thread no. %lu failed to release Turnstile mutex to finish writing to a resource with code: %d.\nExiting...\n", GetCurrentThreadId(), GetLastError());
-		return STATUS_CODE_FAILURE;
+BOOL write_release(lock* p_lock)
+{
+	LONGLONG holdCycles = 0;
+	//Input integrity validation
+	if (NULL == p_lock) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 
-	/* ---------------------------------------------------------------------------------------------------------- */
-	/* NOT ALL RESOURCES HAVE READERS (WRITERS ONLY RESOURCE) -> SO THEIR LOCK WILL ONLY HAVE THE TURNSTILE MUTEX */
-	/* ---------------------------------------------------------------------------------------------------------- */
-	if (NULL != p_lock->p_h_vaccantResourceStatusSemphore)
-		if (RELEASE_EMPTY_RESOURCE_SEMAPHORE_FAILED == ReleaseSemaphore(
-			*(p_lock->p_h_vaccantResourceStatusSemphore),							//Semaphore handle 
-			1,																		//Rise the Semaphore count by 1 only!
-			NULL																	//No need to validate the previous count
-		)) {
-			printf("Error: Thread no. %lu failed to enable the vacant-resource-Semaphore to signal with code: %d.\nExiting...\n", GetCurrentThreadId(), GetLastError());
-			return STATUS_CODE_FAILURE;
-		}
+	//Updating the hold times' moving average (only the Writer holding the lock updates it)
+	holdCycles = (LONGLONG)(ReadTimeStampCounter() - p_lock->writerAcquiredTimestamp);
+	p_lock->averageHoldCycles += (holdCycles - p_lock->averageHoldCycles) >> LOCK_HOLD_AVERAGE_WEIGHT_SHIFT;
+	if (NULL != p_lock->p_profile) addToLockProfileHistogram(p_lock->p_profile->writeHoldTimeHistogram, &(p_lock->p_profile->totalWriteHoldCycles), (ULONGLONG)holdCycles);
 
-	
+	//Release the turnstile & finish resource departure regime (Writing)
+	if (0 == (InterlockedAnd(&(p_lock->state), ~LOCK_STATE_WRITER) & LOCK_STATE_WRITER)) {
+		printf("Error: Thread no. %lu released a writing access it wasn't granted.\n", (unsigned long)GetCurrentThreadId());
+		return STATUS_CODE_FAILURE;
+	}
+	wakeLockWaiters(p_lock);
 
 	//Writing lock release succeeded
 	return STATUS_CODE_SUCCESS;
@@ -253,31 +317,112 @@ BOOL write_release(lock* p_lock)
 
 
 
+void printLockProfilesTable(lock** p_locks, DWORD numberOfLocks)
+{
+	lockProfile* p_profile = NULL;
+	double cyclesPerMicrosecond = 0;
+	LONG numberOfWrites = 0, numberOfContended = 0, numberOfReadPeriods = 0;
+	DWORD lockIndex = 0;
+	//Input integrity validation
+	if (NULL == p_locks) return;
+
+	printf("\nLocks profile (times in micro-seconds, percentiles are histogram bucket bounds):\n");
+	printf("%-18s %10s %10s %10s %8s %10s %10s %10s %10s %10s %10s %10s\n", "Lock", "Reads", "Writes", "Contended", "Waiters",
+		"Wait avg", "Wait p50", "Wait p99", "Write avg", "Write p99", "Read avg", "Read p99");
+	for (lockIndex = 0; lockIndex < numberOfLocks; lockIndex++) {
+		if ((NULL == p_locks[lockIndex]) || (NULL == (p_profile = p_locks[lockIndex]->p_profile))) continue;
+		cyclesPerMicrosecond = calculateCyclesPerMicrosecond(p_profile);
+		numberOfContended = p_profile->numberOfContendedAcquisitions;
+		numberOfWrites = p_profile->numberOfWriteAcquisitions;
+		numberOfReadPeriods = p_profile->numberOfReadPeriods;
+
+		printf("%-18s %10ld %10ld %10ld %8ld %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", p_locks[lockIndex]->p_name,
+			(long)p_profile->numberOfReadAcquisitions, (long)numberOfWrites, (long)numberOfContended, (long)p_profile->maximalNumberOfContenders,
+			(0 == numberOfContended) ? 0 : ((double)p_profile->totalWaitCycles / numberOfContended / cyclesPerMicrosecond),
+			findLockProfilePercentile(p_profile->waitTimeHistogram, LOCK_PROFILE_MEDIAN) / cyclesPerMicrosecond,
+			findLockProfilePercentile(p_profile->waitTimeHistogram, LOCK_PROFILE_TAIL) / cyclesPerMicrosecond,
+			(0 == numberOfWrites) ? 0 : ((double)p_profile->totalWriteHoldCycles / numberOfWrites / cyclesPerMicrosecond),
+			findLockProfilePercentile(p_profile->writeHoldTimeHistogram, LOCK_PROFILE_TAIL) / cyclesPerMicrosecond,
+			(0 == numberOfReadPeriods) ? 0 : ((double)p_profile->totalReadHoldCycles / numberOfReadPeriods / cyclesPerMicrosecond),
+			findLockProfilePercentile(p_profile->readHoldTimeHistogram, LOCK_PROFILE_TAIL) / cyclesPerMicrosecond);
+	}
+}
+
+BOOL writeLockProfilesJson(lock** p_locks, DWORD numberOfLocks, char* p_jsonFilePath)
+{
+	lockProfile* p_profile = NULL;
+	char* p_json = NULL;
+	size_t jsonSize = 0, jsonLength = 0;
+	double cyclesPerMicrosecond = 0;
+	DWORD lockIndex = 0;
+	BOOL isFirstLock = TRUE;
+	HANDLE h_jsonFile = NULL;
+	BOOL writeStatus = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_locks) || (NULL == p_jsonFilePath)) {
+		printf("Error: Bad inputs to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	//JSON text buffer dynamic memory allocation (every lock's text is bounded - every histogram bucket fits)
+	jsonSize = (size_t)(numberOfLocks + SINGLE_OBJECT) * LOCK_PROFILE_JSON_BYTES_PER_LOCK;
+	if (NULL == (p_json = (char*)calloc(jsonSize, sizeof(char)))) {
+		printf("Error: Failed to allocate memory for the locks profile JSON text.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	jsonLength += sprintf_s(p_json + jsonLength, jsonSize - jsonLength, "{\n  \"locks\": [");
+	for (lockIndex = 0; lockIndex < numberOfLocks; lockIndex++) {
+		if ((NULL == p_locks[lockIndex]) || (NULL == (p_profile = p_locks[lockIndex]->p_profile))) continue;
+		cyclesPerMicrosecond = calculateCyclesPerMicrosecond(p_profile);
+
+		jsonLength += sprintf_s(p_json + jsonLength, jsonSize - jsonLength,
+			"%s\n    {\n      \"name\": \"%s\",\n      \"readAcquisitions\": %ld,\n      \"writeAcquisitions\": %ld,\n"
+			"      \"contendedAcquisitions\": %ld,\n      \"maximalWaiters\": %ld,\n      \"readPeriods\": %ld,\n"
+			"      \"totalWaitMicroseconds\": %.3f,\n      \"totalWriteHoldMicroseconds\": %.3f,\n      \"totalReadHoldMicroseconds\": %.3f",
+			(TRUE == isFirstLock) ? "" : ",", p_locks[lockIndex]->p_name, (long)p_profile->numberOfReadAcquisitions, (long)p_profile->numberOfWriteAcquisitions,
+			(long)p_profile->numberOfContendedAcquisitions, (long)p_profile->maximalNumberOfContenders, (long)p_profile->numberOfReadPeriods,
+			p_profile->totalWaitCycles / cyclesPerMicrosecond, p_profile->totalWriteHoldCycles / cyclesPerMicrosecond,
+			p_profile->totalReadHoldCycles / cyclesPerMicrosecond);
+		appendLockProfileHistogramJson(p_json, jsonSize, &jsonLength, "waitTimeHistogram", p_profile->waitTimeHistogram, cyclesPerMicrosecond);
+		appendLockProfileHistogramJson(p_json, jsonSize, &jsonLength, "writeHoldTimeHistogram", p_profile->writeHoldTimeHistogram, cyclesPerMicrosecond);
+		appendLockProfileHistogramJson(p_json, jsonSize, &jsonLength, "readHoldTimeHistogram", p_profile->readHoldTimeHistogram, cyclesPerMicrosecond);
+		jsonLength += sprintf_s(p_json + jsonLength, jsonSize - jsonLength, "\n    }");
+		isFirstLock = FALSE;
+	}
+	jsonLength += sprintf_s(p_json + jsonLength, jsonSize - jsonLength, "\n  ]\n}\n");
+
+	//The JSON file is created (or overwritten) & written at once
+	h_jsonFile = CreateFile(p_jsonFilePath, GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == h_jsonFile) {
+		printf("Error: Failed to create the locks profile file '%s' with error code: %d\n", p_jsonFilePath, GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_json);
+		return STATUS_CODE_FAILURE;
+	}
+	writeStatus = writeEntireBufferToFile(h_jsonFile, p_json, (DWORDLONG)jsonLength);
+	CloseHandle(h_jsonFile);
+	free(p_json);
+	if (STATUS_CODE_FAILURE == writeStatus) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	printf("Locks profile written to '%s'\n", p_jsonFilePath);
+	return STATUS_CODE_SUCCESS;
+}
+
 BOOL DestroyLock(lock** p_p_lock)
 {
-	lock* p_lock = NULL;
 	//Input integrity validation
 	if (NULL == p_p_lock) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 
-	//For ease of access..
-	p_lock = *p_p_lock;
-
-	//Closing all the Synchronous Objects' handles
+	//The lock holds no Synchronous Objects' handles - only its' struct (& profile) is freed
 	printf("Beginning Lock destruction...\n");
-	closeHandleProcedure(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-	closeHandleProcedure(p_lock->p_h_turnstileMutex);
-	closeHandleProcedure(p_lock->p_h_vaccantResourceStatusSemphore);
-
-	/*//Freeing the Handles' dynamically allocated memory
-	free(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-	free(p_lock->p_h_turnstileMutex);
-	free(p_lock->p_h_vaccantResourceStatusSemphore);
-	*/
-
-	//Freeing the lock struct
-	free(p_lock);
+	if (NULL != *p_p_lock) free((*p_p_lock)->p_profile);
+	free(*p_p_lock);
 
 	//Placing NULL to the pointer addressing the lock struct
 	*p_p_lock = NULL;
@@ -291,29 +436,251 @@ BOOL DestroyLock(lock** p_p_lock)
 
 
 //.................................................Static functions...............................................
-static BOOL waitForSynchronousObjectToSignalOrUnlock(HANDLE* p_h_objectHandle, DWORD timeout, DWORD readOrWriteState)
+static BOOL acquireReadAccess(lock* p_lock, ULONGLONG deadline)
 {
-	DWORD syncObjectWaitCode = 0;
-
-	//Wait for the synchronous object to either signal or get unlocked for the thread's request to either read\write from\to the resource...
-	// Resource == either the Priorities Tasks Queue or the Tasks file 
-	syncObjectWaitCode = WaitForSingleObject(*p_h_objectHandle, timeout);
-
-	//Validate the returning Wait code
-	switch (syncObjectWaitCode)
-	{
-	case WAIT_TIMEOUT:	//Waiting Timeout reached
-		if (READ_ACCESS == readOrWriteState) printf("Thread no. %lu reached timeout while waiting to be granted a reading access\n", GetCurrentThreadId());
-		else printf("Thread no. %lu reached timeout while waiting to be granted a writing access\n", GetCurrentThreadId());
-		return STATUS_CODE_FAILURE;
+	LONG observedState = 0;
+	ULONGLONG waitStart = 0;
+	//Assert
+	assert(NULL != p_lock);
+
+	//A new Reader enters only while no Writer holds the turnstile (even when there are already Readers inside the resource), so a Writer that
+	// took the turnstile waits only for the Readers that were already inside - as a "Load Balancing" regime between Writers & Readers
+	while (TRUE) {
+		observedState = p_lock->state;
+		if (0 == (observedState & LOCK_STATE_WRITER)) {
+			//Adding '1' to the Readers currently reading the resource (retrying if another thread changed the state word meanwhile)
+			if (observedState == InterlockedCompareExchange(&(p_lock->state), observedState + LOCK_STATE_READER, observedState)) break;
+			continue;
+		}
+		if ((NO_LOCK_DEADLINE != deadline) && (GetTickCount64() >= deadline)) {
+			if (0 != waitStart) InterlockedDecrement(&(p_lock->p_profile->numberOfContenders));
+			InterlockedIncrement(&(p_lock->numberOfUnacquiredAttempts));
+			return STATUS_CODE_FAILURE;
+		}
+		if ((NULL != p_lock->p_profile) && (0 == waitStart)) waitStart = beginProfiledLockWait(p_lock->p_profile);
+		if (STATUS_CODE_FAILURE == waitForLockStateToChange(p_lock, observedState, READ_ACCESS, deadline)) {
+			if (0 != waitStart) InterlockedDecrement(&(p_lock->p_profile->numberOfContenders));
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Read locking was successful..
+	if (NULL != p_lock->p_profile) recordProfiledLockAcquisition(p_lock->p_profile, READ_ACCESS, waitStart, observedState);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL acquireWriteAccess(lock* p_lock, ULONGLONG deadline)
+{
+	LONG observedState = 0;
+	ULONGLONG waitStart = 0;
+	//Assert
+	assert(NULL != p_lock);
+
+	//Taking the turnstile - setting the Writer bit, which no other Writer holds (from now on, new Readers wait)
+	while (TRUE) {
+		observedState = p_lock->state;
+		if (0 == (observedState & LOCK_STATE_WRITER)) {
+			if (observedState == InterlockedCompareExchange(&(p_lock->state), observedState | LOCK_STATE_WRITER, observedState)) break;
+			continue;
+		}
+		if ((NO_LOCK_DEADLINE != deadline) && (GetTickCount64() >= deadline)) {
+			if (0 != waitStart) InterlockedDecrement(&(p_lock->p_profile->numberOfContenders));
+			InterlockedIncrement(&(p_lock->numberOfUnacquiredAttempts));
+			return STATUS_CODE_FAILURE;
+		}
+		if ((NULL != p_lock->p_profile) && (0 == waitStart)) waitStart = beginProfiledLockWait(p_lock->p_profile);
+		if (STATUS_CODE_FAILURE == waitForLockStateToChange(p_lock, observedState, READ_ACCESS - 1, deadline)) {
+			if (0 != waitStart) InterlockedDecrement(&(p_lock->p_profile->numberOfContenders));
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+
+	/* ---------------------------------------------------------------------------------------------------------- */
+	/* NOT ALL RESOURCES HAVE READERS (WRITERS ONLY RESOURCE) -> THEIR READERS COUNT IS ALWAYS 0 (NO WAIT AT ALL)  */
+	/* ---------------------------------------------------------------------------------------------------------- */
+	//Waiting for the Readers inside the resource to leave (only they may change the state word now)
+	while (LOCK_STATE_WRITER != (observedState = p_lock->state)) {
+		if ((NULL != p_lock->p_profile) && (0 == waitStart)) waitStart = beginProfiledLockWait(p_lock->p_profile);
+		if (((NO_LOCK_DEADLINE != deadline) && (GetTickCount64() >= deadline)) ||
+			(STATUS_CODE_FAILURE == waitForLockStateToChange(p_lock, observedState, READ_ACCESS - 1, deadline))) {
+			if (0 != waitStart) InterlockedDecrement(&(p_lock->p_profile->numberOfContenders));
+			if (NO_LOCK_DEADLINE != deadline) InterlockedIncrement(&(p_lock->numberOfUnacquiredAttempts));
+			//Release the turnstile in case the wait for the Readers to vacate the resource failed (or timed out)!!!!!!
+			InterlockedAnd(&(p_lock->state), ~LOCK_STATE_WRITER);
+			wakeLockWaiters(p_lock);
+			return STATUS_CODE_FAILURE; //add another message in Thread func.
+		}
+	}
+
+	//Writer may now access the resource & perform a witing operation (Writing lock succeeded) - its' hold time is measured from here
+	if (NULL != p_lock->p_profile) recordProfiledLockAcquisition(p_lock->p_profile, READ_ACCESS - 1, waitStart, observedState);
+	p_lock->writerAcquiredTimestamp = ReadTimeStampCounter();
+	return STATUS_CODE_SUCCESS;
+}
 
-	case WAIT_OBJECT_0:	//Waiting ended with a positive response (signalling or unlocking)
+static ULONGLONG calculateLockDeadline(DWORD milliseconds)
+{
+	//A deadline of 0 would read as no deadline - the earliest tick count is 1
+	if (INFINITE == milliseconds) return NO_LOCK_DEADLINE;
+	return GetTickCount64() + milliseconds + 1;
+}
+
+static BOOL waitForLockStateToChange(lock* p_lock, LONG observedState, DWORD readOrWriteState, ULONGLONG deadline)
+{
+	ULONGLONG now = 0;
+	//Assert
+	assert(NULL != p_lock);
+
+	//Spinning first - the holder usually leaves within a few hundred cycles, far sooner than a park & wake would take
+	InterlockedIncrement(&(p_lock->numberOfContendedWaits));
+	if ((FALSE == p_lock->spinningDisabled) && (TRUE == spinForLockStateToChange(p_lock, observedState))) {
+		InterlockedIncrement(&(p_lock->numberOfSpinAcquisitions));
 		return STATUS_CODE_SUCCESS;
+	}
 
-	default:			//Other failures... 
-		if (READ_ACCESS == readOrWriteState) printf("Thread no. %lu didn't receive access for reading a resource with code 0x%x\n", GetCurrentThreadId(), syncObjectWaitCode);
-		else printf("Thread no. %lu didn't receive access for reading a resource with code 0x%x\n", GetCurrentThreadId(), syncObjectWaitCode);
-		printf("0x%x\n", syncObjectWaitCode);
+	//Parking until the state word changes - counted first, so a releasing thread that changes the state word afterwards sees the waiter
+	// (& if it changed in between, WaitOnAddress returns immediately). Wakes may be spurious - the caller re-examines the state word anyway
+	// A timed wait parks only until its' deadline (the caller then finds the deadline passed)
+	if ((NO_LOCK_DEADLINE != deadline) && ((now = GetTickCount64()) >= deadline)) return STATUS_CODE_SUCCESS;
+	InterlockedIncrement(&(p_lock->numberOfParks));
+	InterlockedIncrement(&(p_lock->numberOfWaiters));
+	if ((FALSE == WaitOnAddress(&(p_lock->state), &observedState, sizeof(LONG), (NO_LOCK_DEADLINE == deadline) ? INFINITE : (DWORD)(deadline - now))) &&
+		(ERROR_TIMEOUT != GetLastError())) {
+		InterlockedDecrement(&(p_lock->numberOfWaiters));
+		printf("Thread no. %lu didn't receive access for %s a resource with code %d\n", (unsigned long)GetCurrentThreadId(), (READ_ACCESS == readOrWriteState) ? "reading" : "writing", GetLastError());
 		return STATUS_CODE_FAILURE;
 	}
-}
\ No newline at end of file
+	InterlockedDecrement(&(p_lock->numberOfWaiters));
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL spinForLockStateToChange(lock* p_lock, LONG observedState)
+{
+	ULONGLONG spinStart = 0, spinCycles = 0;
+	//Assert
+	assert(NULL != p_lock);
+
+	//The spin's bound - twice the average hold (no spin at all for long holds)
+	spinCycles = LOCK_SPIN_HOLD_MULTIPLIER * (ULONGLONG)p_lock->averageHoldCycles;
+	if (LOCK_MAXIMAL_SPIN_CYCLES < spinCycles) return FALSE;
+	if (LOCK_MINIMAL_SPIN_CYCLES > spinCycles) spinCycles = LOCK_MINIMAL_SPIN_CYCLES;
+
+	//Spinning on plain reads of the state word (no interlocked operations while it's held)
+	spinStart = ReadTimeStampCounter();
+	do {
+		YieldProcessor();
+		if (observedState != p_lock->state) return TRUE;
+	} while (ReadTimeStampCounter() - spinStart < spinCycles);
+	return FALSE;
+}
+
+static void wakeLockWaiters(lock* p_lock)
+{
+	//Assert
+	assert(NULL != p_lock);
+
+	//Interlocked read - ordered after the caller's (interlocked) state word change
+	if (0 < InterlockedCompareExchange(&(p_lock->numberOfWaiters), 0, 0)) WakeByAddressAll((PVOID)&(p_lock->state));
+}
+
+static ULONGLONG beginProfiledLockWait(lockProfile* p_profile)
+{
+	LONG numberOfContenders = 0, maximalNumberOfContenders = 0;
+	ULONGLONG waitStart = 0;
+	//Assert
+	assert(NULL != p_profile);
+
+	//The maximum only grows - a compare-and-swap loop that gives up once another thread recorded a larger one
+	numberOfContenders = InterlockedIncrement(&(p_profile->numberOfContenders));
+	while (numberOfContenders > (maximalNumberOfContenders = p_profile->maximalNumberOfContenders)) {
+		if (maximalNumberOfContenders == InterlockedCompareExchange(&(p_profile->maximalNumberOfContenders), numberOfContenders, maximalNumberOfContenders)) break;
+	}
+
+	//A zero wait start stands for "didn't wait"
+	waitStart = ReadTimeStampCounter();
+	return (0 == waitStart) ? 1 : waitStart;
+}
+
+static void recordProfiledLockAcquisition(lockProfile* p_profile, DWORD readOrWriteState, ULONGLONG waitStart, LONG previousState)
+{
+	//Assert
+	assert(NULL != p_profile);
+
+	if (READ_ACCESS == readOrWriteState) {
+		InterlockedIncrement(&(p_profile->numberOfReadAcquisitions));
+		//The first Reader in begins a shared period
+		if (LOCK_STATE_READER > previousState) p_profile->readPeriodStartTimestamp = ReadTimeStampCounter();
+	}
+	else InterlockedIncrement(&(p_profile->numberOfWriteAcquisitions));
+
+	//A contended access - the thread stops waiting
+	if (0 != waitStart) {
+		InterlockedIncrement(&(p_profile->numberOfContendedAcquisitions));
+		InterlockedDecrement(&(p_profile->numberOfContenders));
+		addToLockProfileHistogram(p_profile->waitTimeHistogram, &(p_profile->totalWaitCycles), ReadTimeStampCounter() - waitStart);
+	}
+}
+
+static void addToLockProfileHistogram(volatile LONG* p_histogram, volatile LONGLONG* p_totalCycles, ULONGLONG cycles)
+{
+	DWORD bucketIndex = 0;
+	//Assert
+	assert((NULL != p_histogram) && (NULL != p_totalCycles));
+
+	//Bucket of [2^b, 2^(b+1)) cycles - b is the index of the highest set bit
+	while ((bucketIndex < LOCK_PROFILE_HISTOGRAM_BUCKETS - 1) && (1 < (cycles >> bucketIndex))) bucketIndex++;
+	InterlockedIncrement(&(p_histogram[bucketIndex]));
+	InterlockedExchangeAdd64(p_totalCycles, (LONGLONG)cycles);
+}
+
+static ULONGLONG findLockProfilePercentile(volatile LONG* p_histogram, double fraction)
+{
+	LONGLONG numberOfTimes = 0, numberOfCountedTimes = 0;
+	DWORD bucketIndex = 0;
+	//Assert
+	assert(NULL != p_histogram);
+
+	for (bucketIndex = 0; bucketIndex < LOCK_PROFILE_HISTOGRAM_BUCKETS; bucketIndex++) numberOfTimes += p_histogram[bucketIndex];
+	if (0 == numberOfTimes) return 0;
+
+	//The first bucket in which the wanted fraction of the times is reached
+	for (bucketIndex = 0; bucketIndex < LOCK_PROFILE_HISTOGRAM_BUCKETS - 1; bucketIndex++) {
+		numberOfCountedTimes += p_histogram[bucketIndex];
+		if ((double)numberOfCountedTimes >= fraction * (double)numberOfTimes) break;
+	}
+	return (ULONGLONG)2 << bucketIndex;
+}
+
+static double calculateCyclesPerMicrosecond(lockProfile* p_profile)
+{
+	LARGE_INTEGER currentCounter, counterFrequency;
+	double elapsedMicroseconds = 0;
+	//Assert
+	assert(NULL != p_profile);
+
+	QueryPerformanceCounter(&currentCounter);
+	QueryPerformanceFrequency(&counterFrequency);
+	elapsedMicroseconds = (double)(currentCounter.QuadPart - p_profile->startCounter.QuadPart) * MICROSECONDS_PER_SECOND / (double)counterFrequency.QuadPart;
+	if (1 > elapsedMicroseconds) return 1;
+
+	elapsedMicroseconds = (double)(ReadTimeStampCounter() - p_profile->startTimestamp) / elapsedMicroseconds;
+	return (1 > elapsedMicroseconds) ? 1 : elapsedMicroseconds;
+}
+
+static void appendLockProfileHistogramJson(char* p_json, size_t jsonSize, size_t* p_jsonLength, const char* p_histogramName, volatile LONG* p_histogram, double cyclesPerMicrosecond)
+{
+	DWORD bucketIndex = 0;
+	BOOL isFirstBucket = TRUE;
+	//Assert
+	assert((NULL != p_json) && (NULL != p_jsonLength) && (NULL != p_histogramName) && (NULL != p_histogram));
+
+	*p_jsonLength += sprintf_s(p_json + *p_jsonLength, jsonSize - *p_jsonLength, ",\n      \"%s\": [", p_histogramName);
+	for (bucketIndex = 0; bucketIndex < LOCK_PROFILE_HISTOGRAM_BUCKETS; bucketIndex++) {
+		if (0 == p_histogram[bucketIndex]) continue;
+		*p_jsonLength += sprintf_s(p_json + *p_jsonLength, jsonSize - *p_jsonLength, "%s{ \"upToMicroseconds\": %.3f, \"count\": %ld }",
+			(TRUE == isFirstBucket) ? "" : ", ", (double)((ULONGLONG)2 << bucketIndex) / cyclesPerMicrosecond, (long)p_histogram[bucketIndex]);
+		isFirstBucket = FALSE;
+	}
+	*p_jsonLength += sprintf_s(p_json + *p_jsonLength, jsonSize - *p_jsonLength, "]");
+}
@@ -17,57 +17,112 @@
 // Projects includes -------------------------------------------
 #include "HardCodedData.h"
 #include "MemoryHandling.h"
+#include "MappedFile.h"
 
 
 
 //Functions Declarations
 
 /// <summary>
-///	 Description - This function allocates memory (on the Heap) for a "lock" struct and returns a pointer to it (calloc)
+///	 Description - This function allocates memory (on the Heap) for a "lock" struct and returns a pointer to it (calloc). A zeroed lock is vacant:
+///		no Writer holds the turnstile, no Readers are inside the resource & no thread waits - no Synchronous Objects (kernel Handles) are needed
 /// </summary>
+/// <param name="const char* p_lockName - A pointer to the lock's name (string) for its' statistics & profile"></param>
 /// <returns>A pointer to an initiated 'lock' struct if successful, or NULL if failed.</returns>
-lock* InitializeLock();
+lock* InitializeLock(const char* p_lockName);
 /// <summary>
-///  Description - This function describes the read lock request routine, and initially consists of owning the Turnstile Mutex and releasing it.
-///		Following that, an ownership request will be made toward the Readers Mutex, and if granted the Real-Time-Readers-currently-accessing-the-resource
-///		count will be incremented. In the case of an vacant resource (no thread is accessing the resource no matter the type of access), then the
-///		vacant-resource Semaphore is signalled OFF by the read-lock requesting thread, thus, making the resource access currently exclusive for Readers.
-///		Finally, the Readers Mutex is unlocked by the thread (thus making the current-Readers count increment procedure uniteruptted by any other Reader thread)
+///	 Description - This function enables the lock's contention profile: acquisitions, contended acquisitions, the most waiters at once, and wait & hold
+///		times' histograms. An unprofiled lock pays a single NULL check per operation.
 /// </summary>
-/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the resource synchronous objects and the lock's timeout components"></param>
-/// <returns>A BOOL value representing the function's outcome (Read lock status). Success (TRUE) or Failure (False)</returns>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+BOOL enableLockProfiling(lock* p_lock);
+/// <summary>
+///	 Description - This function prints the lock's statistics: the waits for it, how many of them ended while spinning (without parking), the parks
+///		and the Writers' average hold time the spin is tuned by.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct"></param>
+void printLockStatistics(lock* p_lock);
+/// <summary>
+///	 Description - This function prints the profiled locks' contention profiles as a table (micro-seconds). Unprofiled locks are skipped.
+/// </summary>
+/// <param name="lock** p_locks - A pointer to the locks' pointers array"></param>
+/// <param name="DWORD numberOfLocks - # of locks in the array"></param>
+void printLockProfilesTable(lock** p_locks, DWORD numberOfLocks);
+/// <summary>
+///	 Description - This function writes the profiled locks' contention profiles to a JSON file (created or overwritten), histograms included.
+/// </summary>
+/// <param name="lock** p_locks - A pointer to the locks' pointers array"></param>
+/// <param name="DWORD numberOfLocks - # of locks in the array"></param>
+/// <param name="char* p_jsonFilePath - A pointer to the JSON file's path"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+BOOL writeLockProfilesJson(lock** p_locks, DWORD numberOfLocks, char* p_jsonFilePath);
+/// <summary>
+///  Description - This function describes the read lock request routine. While no Writer holds the turnstile (the state word's Writer bit),
+///		the Reader enters the resource by adding itself to the state word's Readers count with a single compare-and-swap - no kernel call at all.
+///		Otherwise (a Writer is inside the resource, or waits for the Readers already inside it to leave) the Reader parks on the state word
+///		(WaitOnAddress) until it changes, and retries - so new Readers can't starve a waiting Writer.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome (Read lock status). Success (TRUE) or Failure (False) e.g. the wait failed</returns>
 BOOL read_lock(lock* p_lock);
 /// <summary>
-///  Description - This function describes the read lock release request routine, and consists an ownership request of the Readers Mutex in order to decrement 
-///		the Real-Time-Readers-currently-accessing-the-resource count, and in the case of a now-becoming-a-vacant-resource, the vacant resource Semaphore will be signalled ON
-///		by the lock releasing thread. Then the Readers Mutex is unlocked by the thread (thus making the current-Readers count decrement procedure uniteruptted by any other Reader thread).
+///  Description - This function attempts a reading access without waiting: it enters only if no Writer holds the turnstile right now.
 /// </summary>
-/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the resource synchronous objects and the lock's timeout components"></param>
-/// <returns>A BOOL value representing the function's outcome (Read lock release status). Success (TRUE) or Failure (False)</returns>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - the reading access was granted, or Failure (False) - the lock is busy</returns>
+BOOL try_read_lock(lock* p_lock);
+/// <summary>
+///  Description - This function requests a reading access as read_lock does, but gives up once the time limit passes.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <param name="DWORD milliseconds - The time limit (INFINITE - none, as read_lock)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - the reading access was granted, or Failure (False) - the time limit passed or the wait failed</returns>
+BOOL timed_read_lock(lock* p_lock, DWORD milliseconds);
+/// <summary>
+///  Description - This function describes the read lock release request routine: the Reader subtracts itself from the state word's Readers count
+///		atomically, and if it was the last Reader while a Writer holds the turnstile, the parked threads are woken (the Writer may enter).
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome (Read lock release status). Success (TRUE) or Failure (False) e.g. no Reader held the lock</returns>
 BOOL read_release(lock* p_lock);
 /// <summary>
-///  Description - This function describes the write lock request routine, and initially consists of owning the Turnstile Mutex. If the ownership succeeded then
-///		the thread(Writer) will wait until the Readers Semaphore is signalled ON (and by so, it will be know that all Readers exitted the resource, and the resource
-///		is vacant for accessing by a Writing thread), then the thread will signal it OFF for exclusivness. The capturing of the Turnstile mutex assists in preventing
-///		a Starvation condition.
+///  Description - This function describes the write lock request routine, and initially consists of taking the turnstile: setting the state word's
+///		Writer bit with a compare-and-swap (parking while another Writer holds it). From that moment no new Reader enters, and the Writer waits
+///		until the Readers already inside the resource leave (the Readers count drops to 0), then it accesses the resource exclusively.
+///		Holding the turnstile while the Readers drain assists in preventing a Starvation condition. An uncontended lock takes a single compare-and-swap.
 /// </summary>
-/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the resource synchronous objects and the lock's timeout components"></param>
-/// <returns>A BOOL value representing the function's outcome (Write lock status). Success (TRUE) or Failure (False)</returns>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome (Write lock status). Success (TRUE) or Failure (False) e.g. the wait failed</returns>
 BOOL write_lock(lock* p_lock);
 /// <summary>
-///  Description - This function describes the write lock release request routine, and initially consists of releasing ownership of the Turnstile Mutex. 
-///		Then the write locking thread will singal ON the Readers Semaphore and will alert that there is no more a Writer in the resource.
+///  Description - This function attempts a writing access without waiting: it takes the lock only if it is vacant (no Writer holds the turnstile
+///		& no Reader is inside) - a single compare-and-swap.
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - the writing access was granted, or Failure (False) - the lock is busy</returns>
+BOOL try_write_lock(lock* p_lock);
+/// <summary>
+///  Description - This function requests a writing access as write_lock does, but gives up once the time limit passes (releasing the turnstile
+///		if it was taken while the Readers inside drain).
+/// </summary>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <param name="DWORD milliseconds - The time limit (INFINITE - none, as write_lock)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - the writing access was granted, or Failure (False) - the time limit passed or the wait failed</returns>
+BOOL timed_write_lock(lock* p_lock, DWORD milliseconds);
+/// <summary>
+///  Description - This function describes the write lock release request routine: the Writer clears the state word's Writer bit (releasing the turnstile),
+///		and wakes the parked threads (Readers & Writers) if there are any.
 /// </summary>
-/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the resource synchronous objects and the lock's timeout components"></param>
-/// <returns>A BOOL value representing the function's outcome (Write lock release status). Success (TRUE) or Failure (False)</returns>
+/// <param name="lock* p_lock - A pointer to a resource 'lock' struct that contains the lock's state word"></param>
+/// <returns>A BOOL value representing the function's outcome (Write lock release status). Success (TRUE) or Failure (False) e.g. no Writer held the lock</returns>
 BOOL write_release(lock* p_lock);
 /// <summary>
-///  Description - This function destroys the lock by releasing any memory allocated to the "lock" struct and closing any open handles to
-///		the Synchronous Objects the lock points at.
+///  Description - This function destroys the lock by releasing any memory allocated to the "lock" struct.
 ///		It also sets the lock's pointer to point at NULL address, and returns a final status code of the operation.
 /// </summary>
 /// <param name="lock** p_p_lock - A pointer to a pointer that points at a lock struct"></param>
-/// <returns>A BOOL value representing the function's outcome (Queue mem. is released and its' pointer points at NULL). Success (TRUE) or Failure (False)</returns>
+/// <returns>A BOOL value representing the function's outcome (Lock mem. is released and its' pointer points at NULL). Success (TRUE) or Failure (False)</returns>
 BOOL DestroyLock(lock** p_p_lock);
 
 
@@ -0,0 +1,228 @@
+/* MappedFile.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for mapping files (or their
+		beginning) to read-only views in the process's address space, so their content
+		may be accessed directly as memory, with no ReadFile calls & no copies. It also
+		contains helpers for binary files: whole-buffer reading\writing & hashing.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "MappedFile.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORDLONG MAP_ENTIRE_FILE = 0;
+
+static const DWORD MAX_IO_CHUNK_SIZE = 1 << 30;		//ReadFile\WriteFile receive a DWORD number of bytes - large buffers are transferred in chunks
+
+static const DWORDLONG FNV_PRIME = 1099511628211ULL;
+
+
+
+
+// Functions definitions ------------------------------------------------------------------
+
+mappedFile* mapFileForReading(char* p_filePath, DWORDLONG numberOfBytesToMap)
+{
+	mappedFile* p_mappedFile = NULL;
+	LARGE_INTEGER fileSize;
+	//Input integrity validation
+	if (NULL == p_filePath) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Allocating dynamic memory for the mapped file struct
+	if (NULL == (p_mappedFile = (mappedFile*)calloc(sizeof(mappedFile), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for a mapped file struct.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	p_mappedFile->h_file = INVALID_HANDLE_VALUE;
+
+	//Opening the file for reading, while other handles may still write to it (e.g. solutions appended to the Tasks file)
+	p_mappedFile->h_file = CreateFile(
+		p_filePath,								// Const null - terminated string describing the file's path
+		GENERIC_READ,							// Desired Access is set to Reading mode
+		FILE_SHARE_READ | FILE_SHARE_WRITE,		// Share Mode: other handles may read from & write to the file
+		NULL,									// No Security Attributes
+		OPEN_EXISTING,							// The file must exist
+		FILE_ATTRIBUTE_NORMAL,					// General reading in files
+		NULL									// No Template
+	);
+	if (INVALID_HANDLE_VALUE == p_mappedFile->h_file) {
+		printf("Error: Failed to create a Handle to the file '%s' for mapping, with code: %d.\n", p_filePath, GetLastError());
+		unmapFile(&p_mappedFile); return NULL;
+	}
+
+	//Validating the requested number of bytes lies within the file (an empty file can't be mapped)
+	if (FALSE == GetFileSizeEx(p_mappedFile->h_file, &fileSize)) {
+		printf("Error: Failed to fetch the size of the file '%s', with code: %d.\n", p_filePath, GetLastError());
+		unmapFile(&p_mappedFile); return NULL;
+	}
+	if (MAP_ENTIRE_FILE == numberOfBytesToMap) numberOfBytesToMap = (DWORDLONG)fileSize.QuadPart;
+	if ((0 == numberOfBytesToMap) || ((DWORDLONG)fileSize.QuadPart < numberOfBytesToMap) || ((SIZE_T)numberOfBytesToMap != numberOfBytesToMap)) {
+		printf("Error: The file '%s' can't be mapped (%llu bytes requested out of %lld).\n", p_filePath, numberOfBytesToMap, fileSize.QuadPart);
+		unmapFile(&p_mappedFile); return NULL;
+	}
+	p_mappedFile->numberOfBytes = numberOfBytesToMap;
+
+	//Creating a read-only mapping object of the requested bytes & mapping all of them to a view
+	if (NULL == (p_mappedFile->h_fileMapping = CreateFileMapping(p_mappedFile->h_file, NULL, PAGE_READONLY,
+		(DWORD)(numberOfBytesToMap >> 32), (DWORD)numberOfBytesToMap, NULL))) {
+		printf("Error: Failed to create a mapping of the file '%s', with code: %d.\n", p_filePath, GetLastError());
+		unmapFile(&p_mappedFile); return NULL;
+	}
+	if (NULL == (p_mappedFile->p_view = (LPCSTR)MapViewOfFile(p_mappedFile->h_fileMapping, FILE_MAP_READ, 0, 0, (SIZE_T)numberOfBytesToMap))) {
+		printf("Error: Failed to map a view of the file '%s', with code: %d.\n", p_filePath, GetLastError());
+		unmapFile(&p_mappedFile); return NULL;
+	}
+
+	//Mapping the file was successful
+	return p_mappedFile;
+}
+
+BOOL parseNumberFromMappedFile(mappedFile* p_mappedFile, DWORDLONG offset, PDWORDLONG p_number, PDWORDLONG p_nextLineOffset)
+{
+	DWORDLONG position = offset, number = 0;
+	BOOL foundDigits = FALSE, overflow = FALSE;
+	//Input integrity validation
+	if ((NULL == p_mappedFile) || (NULL == p_number)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return FALSE;
+	}
+	if (offset >= p_mappedFile->numberOfBytes) {
+		if (NULL != p_nextLineOffset) *p_nextLineOffset = p_mappedFile->numberOfBytes;
+		return FALSE;
+	}
+
+	//Skipping leading spaces & tabs (as "%llu" would)
+	while ((position < p_mappedFile->numberOfBytes) && ((' ' == p_mappedFile->p_view[position]) || ('\t' == p_mappedFile->p_view[position]))) position++;
+
+	//Accumulating the number's digits
+	while ((position < p_mappedFile->numberOfBytes) && ('0' <= p_mappedFile->p_view[position]) && ('9' >= p_mappedFile->p_view[position])) {
+		if (number > (ULLONG_MAX - (DWORDLONG)(p_mappedFile->p_view[position] - '0')) / 10) overflow = TRUE;
+		number = number * 10 + (DWORDLONG)(p_mappedFile->p_view[position] - '0');
+		foundDigits = TRUE;
+		position++;
+	}
+
+	//Locating the following line
+	if (NULL != p_nextLineOffset) {
+		while ((position < p_mappedFile->numberOfBytes) && ('\n' != p_mappedFile->p_view[position])) position++;
+		*p_nextLineOffset = (position < p_mappedFile->numberOfBytes) ? position + 1 : p_mappedFile->numberOfBytes;
+	}
+
+	if ((FALSE == foundDigits) || (TRUE == overflow)) return FALSE;
+	*p_number = number;
+	return TRUE;
+}
+
+BOOL parseLineColumnFromMappedFile(mappedFile* p_mappedFile, DWORDLONG lineOffset, DWORD columnIndex, PDWORDLONG p_number)
+{
+	DWORDLONG position = lineOffset;
+	DWORD column = 0;
+	//Input integrity validation
+	if ((NULL == p_mappedFile) || (NULL == p_number)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return FALSE;
+	}
+
+	//Skipping the preceding columns - every one of them must be a number
+	for (column = 0; column < columnIndex; column++) {
+		while ((position < p_mappedFile->numberOfBytes) && ((' ' == p_mappedFile->p_view[position]) || ('\t' == p_mappedFile->p_view[position]))) position++;
+		if ((position >= p_mappedFile->numberOfBytes) || ('0' > p_mappedFile->p_view[position]) || ('9' < p_mappedFile->p_view[position])) return FALSE;
+		while ((position < p_mappedFile->numberOfBytes) && ('0' <= p_mappedFile->p_view[position]) && ('9' >= p_mappedFile->p_view[position])) position++;
+	}
+
+	//Parsing the column's number (the line's end, e.g. a Carriage return, means there is no such column)
+	return parseNumberFromMappedFile(p_mappedFile, position, p_number, NULL);
+}
+
+BOOL writeEntireBufferToFile(HANDLE h_file, const void* p_buffer, DWORDLONG numberOfBytes)
+{
+	DWORD numberOfBytesToWrite = 0, numberOfBytesWritten = 0;
+	const BYTE* p_position = (const BYTE*)p_buffer;
+	//Input integrity validation
+	if ((NULL == p_buffer) && (0 < numberOfBytes)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Writing chunk by chunk
+	while (0 < numberOfBytes) {
+		numberOfBytesToWrite = (numberOfBytes < MAX_IO_CHUNK_SIZE) ? (DWORD)numberOfBytes : MAX_IO_CHUNK_SIZE;
+		if ((FALSE == WriteFile(h_file, p_position, numberOfBytesToWrite, &numberOfBytesWritten, NULL)) || (numberOfBytesWritten != numberOfBytesToWrite)) {
+			printf("Error: Failed to write to a file Handle, with code: %d.\n", GetLastError());
+			return STATUS_CODE_FAILURE;
+		}
+		p_position += numberOfBytesWritten;
+		numberOfBytes -= numberOfBytesWritten;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL readEntireBufferFromFile(HANDLE h_file, void* p_buffer, DWORDLONG numberOfBytes)
+{
+	DWORD numberOfBytesToRead = 0, numberOfBytesRead = 0;
+	BYTE* p_position = (BYTE*)p_buffer;
+	//Input integrity validation
+	if ((NULL == p_buffer) && (0 < numberOfBytes)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Reading chunk by chunk (the file ending before all bytes were read is a failure)
+	while (0 < numberOfBytes) {
+		numberOfBytesToRead = (numberOfBytes < MAX_IO_CHUNK_SIZE) ? (DWORD)numberOfBytes : MAX_IO_CHUNK_SIZE;
+		if ((FALSE == ReadFile(h_file, p_position, numberOfBytesToRead, &numberOfBytesRead, NULL)) || (0 == numberOfBytesRead)) return STATUS_CODE_FAILURE;
+		p_position += numberOfBytesRead;
+		numberOfBytes -= numberOfBytesRead;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+DWORDLONG calculateBufferHash(DWORDLONG hash, const BYTE* p_buffer, DWORDLONG numberOfBytes)
+{
+	DWORDLONG byteIndex = 0;
+	//FNV-1a - xor the byte, then multiply by the FNV prime
+	for (byteIndex = 0; byteIndex < numberOfBytes; byteIndex++) {
+		hash ^= (DWORDLONG)p_buffer[byteIndex];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+BOOL unmapFile(mappedFile** p_p_mappedFile)
+{
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_p_mappedFile) || (NULL == *p_p_mappedFile)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Unmapping the view, then closing the mapping object & the file (in reverse order of creation)
+	if ((NULL != (*p_p_mappedFile)->p_view) && (FALSE == UnmapViewOfFile((*p_p_mappedFile)->p_view))) {
+		printf("Error: Failed to unmap a file view with code: %d.\n", GetLastError()); retVal = STATUS_CODE_FAILURE;
+	}
+	if ((NULL != (*p_p_mappedFile)->h_fileMapping) && (FALSE == CloseHandle((*p_p_mappedFile)->h_fileMapping))) {
+		printf("Error: Failed to close a file mapping handle with code: %d.\n", GetLastError()); retVal = STATUS_CODE_FAILURE;
+	}
+	if ((INVALID_HANDLE_VALUE != (*p_p_mappedFile)->h_file) && (FALSE == CloseHandle((*p_p_mappedFile)->h_file))) {
+		printf("Error: Failed to close a mapped file handle with code: %d.\n", GetLastError()); retVal = STATUS_CODE_FAILURE;
+	}
+
+	//Freeing the mapped file struct
+	free(*p_p_mappedFile);
+	*p_p_mappedFile = NULL;
+	return retVal;
+}
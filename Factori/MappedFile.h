@@ -0,0 +1,91 @@
+/* MappedFile.h
+--------------------------------------------------------
+	Module Description - header module for MappedFile.c
+--------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+// Constants ---------------------------------------------------
+	//calculateBufferHash(.)'s initial hash value (FNV-1a 64-bit offset basis)
+#define BUFFER_HASH_INITIAL_VALUE 14695981039346656037ULL
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function opens an existing file for reading (shared for reading & writing, so other threads may still
+///		append to the file) and maps its' first 'numberOfBytesToMap' bytes (or all of it, if 0 is given) to a read-only view.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the file's path (absolute\relative)"></param>
+/// <param name="DWORDLONG numberOfBytesToMap - The number of bytes to map from the beginning of the file, or 0 for the entire file"></param>
+/// <returns>A pointer to an updated, dynamically allocated 'mappedFile' struct if successful, or NULL if failed (e.g. an empty file)</returns>
+mappedFile* mapFileForReading(char* p_filePath, DWORDLONG numberOfBytesToMap);
+/// <summary>
+///	 Description - This function parses the decimal number written at byte offset 'offset' of a mapped view (leading spaces & tabs
+///		are skipped, the number ends at the first non-digit character), and locates the beginning of the following line (the byte after
+///		the next Newline character, or the end of the view). The following line is located even if no number is written at the offset.
+/// </summary>
+/// <param name="mappedFile* p_mappedFile - A pointer to a 'mappedFile' struct"></param>
+/// <param name="DWORDLONG offset - The byte offset (within the view) the number begins at"></param>
+/// <param name="PDWORDLONG p_number - A pointer to the variable that will be updated with the parsed number"></param>
+/// <param name="PDWORDLONG p_nextLineOffset - A pointer to the variable that will be updated with the following line's byte offset (may be NULL)"></param>
+/// <returns>TRUE if a number was parsed, FALSE if there is no number at the offset (or it overflows 64 bits, or the offset is outside of the view)</returns>
+BOOL parseNumberFromMappedFile(mappedFile* p_mappedFile, DWORDLONG offset, PDWORDLONG p_number, PDWORDLONG p_nextLineOffset);
+/// <summary>
+///	 Description - This function parses the decimal number of a line's column 'columnIndex' (0 is the first column), where the columns
+///		are numbers separated by spaces or tabs, e.g. the optional deadline following a byte-offset in the Tasks Priorities list file.
+/// </summary>
+/// <param name="mappedFile* p_mappedFile - A pointer to a 'mappedFile' struct"></param>
+/// <param name="DWORDLONG lineOffset - The byte offset (within the view) the line begins at"></param>
+/// <param name="DWORD columnIndex - The (0-based) index of the column to parse"></param>
+/// <param name="PDWORDLONG p_number - A pointer to the variable that will be updated with the parsed number"></param>
+/// <returns>TRUE if a number was parsed, FALSE if the line has no such column (or its' number overflows 64 bits)</returns>
+BOOL parseLineColumnFromMappedFile(mappedFile* p_mappedFile, DWORDLONG lineOffset, DWORD columnIndex, PDWORDLONG p_number);
+/// <summary>
+///	 Description - This function writes a buffer of any size to a file handle, at the handle's current position (in chunks, since
+///		WriteFile receives a DWORD number of bytes).
+/// </summary>
+/// <param name="HANDLE h_file - A handle to a file opened for writing"></param>
+/// <param name="const void* p_buffer - A pointer to the buffer"></param>
+/// <param name="DWORDLONG numberOfBytes - The number of bytes to write"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL writeEntireBufferToFile(HANDLE h_file, const void* p_buffer, DWORDLONG numberOfBytes);
+/// <summary>
+///	 Description - This function reads exactly 'numberOfBytes' bytes from a file handle's current position into a buffer (in chunks).
+/// </summary>
+/// <param name="HANDLE h_file - A handle to a file opened for reading"></param>
+/// <param name="void* p_buffer - A pointer to a buffer of at least 'numberOfBytes' bytes"></param>
+/// <param name="DWORDLONG numberOfBytes - The number of bytes to read"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. the file ended before</returns>
+BOOL readEntireBufferFromFile(HANDLE h_file, void* p_buffer, DWORDLONG numberOfBytes);
+/// <summary>
+///	 Description - This function calculates the FNV-1a 64-bit hash of a buffer, continuing from a previous hash value
+///		(BUFFER_HASH_INITIAL_VALUE for a new hash), so a hash may be calculated over several buffers.
+/// </summary>
+/// <param name="DWORDLONG hash - The previous hash value"></param>
+/// <param name="const BYTE* p_buffer - A pointer to the buffer"></param>
+/// <param name="DWORDLONG numberOfBytes - The number of bytes in the buffer"></param>
+/// <returns>The updated hash value</returns>
+DWORDLONG calculateBufferHash(DWORDLONG hash, const BYTE* p_buffer, DWORDLONG numberOfBytes);
+/// <summary>
+///	 Description - This function unmaps the file's view, closes the mapping & file handles, frees the 'mappedFile' struct and sets its' pointer to NULL.
+/// </summary>
+/// <param name="mappedFile** p_p_mappedFile - A pointer to a pointer to a 'mappedFile' struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL unmapFile(mappedFile** p_p_mappedFile);
+
+
+#endif //__MAPPED_FILE_H__
@@ -23,12 +23,6 @@ static const BOOL STATUS_CODE_SUCCESS = TRUE;
 
 // Functions declerations ------------------------------------------------------------------
 /// <summary>
-///  Description - This function receives a "line" struct which is a nested-list
-///		and frees all elements in the list.
-/// </summary>
-/// <param name="line* p_topLine - A pointer to the head of the nested-list('line' struct)"></param>
-static void freeTheLines(line* p_topLine);
-/// <summary>
 ///  Description - This function receives a "factor" struct which is a nested-list
 ///		and frees all elements in the list.
 /// </summary>
@@ -81,30 +75,19 @@ void closeThreadsProcedure(HANDLE* p_h_threadsHandlesArray, LPDWORD p_threadIds,
 //......................................file struct................................
 void freeTheFile(file* p_file)
 {
-	//Freeing the Nested-List line structs in the file
-	if (p_file->p_firstLineInFile != NULL)  freeTheLines(p_file->p_firstLineInFile);
+	//Input integrity validation
+	if (NULL == p_file) return;
+	//Freeing the lines array in the file
+	if (NULL != p_file->p_lines)  free(p_file->p_lines);
+	//Freeing the lines' values array
+	if (NULL != p_file->p_linesValues)  free(p_file->p_linesValues);
+	//Freeing the compressed lines' offsets index
+	if (NULL != p_file->p_compressedLinesOffsets)  DestroyEliasFanoIndex(&(p_file->p_compressedLinesOffsets));
 	//Freeing the file struct
-	if (p_file != NULL)  free(p_file);
+	free(p_file);
 	//For future use: It is possible to define file** p_p_file = &p_file, then, before free(p_file), place p_p_file=&p_file -> free -> *p_p_file= NULL
 }
 
-static void freeTheLines(line* p_topLine)
-{
-	line* p_currentLine = NULL;
-	//Assert
-	assert(p_topLine != NULL);
-	//Freeing all the Nested-List of line-data cells
-	while (p_topLine != NULL) {
-		//Updating the current cell(line) to be the top line
-		p_currentLine = p_topLine;
-		//If the Nested-List still has line structures in it, the top pointer is updated to next line struct(cell)
-		if (p_topLine->p_nextLine != NULL)  p_topLine = p_topLine->p_nextLine;
-		else p_topLine = NULL;
-		//Freeing the current top line struct(cell)
-		free(p_currentLine);
-	}
-}
-
 
 
 
@@ -165,6 +148,31 @@ void freeTheThreadPackage(threadPackage* p_threadParameters)
 			printf("Tasks list file resource Lock destruction succeeded!!!\n\n");
 	//Destroying Tasks list file Data resource
 	if (NULL != p_threadParameters->p_tasksFileData)		freeTheFile(p_threadParameters->p_tasksFileData);
+	//Unmapping the Tasks list file's view resource
+	if (NULL != p_threadParameters->p_mappedTasksFile)		unmapFile(&(p_threadParameters->p_mappedTasksFile));
+	//Destroying the distinct tasks resource
+	if (NULL != p_threadParameters->p_deduplicatedTasks)	destroyDeduplicatedTasks(&(p_threadParameters->p_deduplicatedTasks));
+	//Unloading the tasks container resource
+	if (NULL != p_threadParameters->p_tasksContainer)		unloadTasksContainer(&(p_threadParameters->p_tasksContainer));
+	//Destroying the work stealing scheduler resource
+	if (NULL != p_threadParameters->p_workStealingScheduler)	destroyWorkStealingScheduler(&(p_threadParameters->p_workStealingScheduler));
+	//Destroying the runtime tasks feed resource
+	if (NULL != p_threadParameters->p_tasksFeed)			destroyTasksFeed(&(p_threadParameters->p_tasksFeed));
+	//Destroying the ordered output's reorder buffer resource
+	if (NULL != p_threadParameters->p_reorderBuffer)		destroyReorderBuffer(&(p_threadParameters->p_reorderBuffer));
+	//Destroying the deferred writes' policy
+	if (NULL != p_threadParameters->p_deferredWrites)		destroyDeferredWrites(&(p_threadParameters->p_deferredWrites));
+	//Destroying the output buffers' policy
+	if (NULL != p_threadParameters->p_outputBuffering)		destroyOutputBuffering(&(p_threadParameters->p_outputBuffering));
+	//Destroying the reserved appends' end of the output
+	if (NULL != p_threadParameters->p_appendReservations)	destroyAppendReservations(&(p_threadParameters->p_appendReservations));
+	//Stopping the writer thread & destroying its' ring
+	if (NULL != p_threadParameters->p_writerRing)			destroyWriterRing(&(p_threadParameters->p_writerRing));
+	//Destroying the job tail's in-flight tasks' slots
+	if (NULL != p_threadParameters->p_speculativeTail)		destroySpeculativeTail(&(p_threadParameters->p_speculativeTail));
+	if (NULL != p_threadParameters->p_deadlineSchedule)		destroyDeadlineSchedule(&(p_threadParameters->p_deadlineSchedule));
+	if (NULL != p_threadParameters->p_sizeClassLanes)		destroySizeClassLanes(&(p_threadParameters->p_sizeClassLanes));
+	if (NULL != p_threadParameters->p_progressWatchdog)		destroyProgressWatchdog(&(p_threadParameters->p_progressWatchdog));
 
 	//Free the thread parameters struct (threadPackage)
 	free(p_threadParameters);
@@ -18,6 +18,21 @@
 #include "HardCodedData.h"
 #include "Queue.h"
 #include "Lock.h"
+#include "EliasFanoIndex.h"
+#include "TasksContainer.h"
+#include "MappedFile.h"
+#include "TasksDeduplication.h"
+#include "WorkStealing.h"
+#include "TasksFeed.h"
+#include "ReorderBuffer.h"
+#include "SpeculativeTail.h"
+#include "DeadlineScheduling.h"
+#include "SizeClassLanes.h"
+#include "ProgressWatchdog.h"
+#include "DeferredWrites.h"
+#include "OutputBuffer.h"
+#include "AppendReservations.h"
+#include "WriterThread.h"
 
 
 //Functions Declarations
@@ -39,7 +54,7 @@ void closeThreadsProcedure(HANDLE* p_h_threadsHandlesArray, LPDWORD p_threadIds,
 
 
 /// <summary>
-/// Description - This function receives a "file" struct and frees the "line" struct nested list within it, and then it frees the "file" struct itself.
+/// Description - This function receives a "file" struct and frees the "line" structs array (or the Elias-Fano lines' offsets index) within it, and then it frees the "file" struct itself.
 /// </summary>
 /// <param name="file* p_file - A pointer to a 'file' datatype (struct) that was used to frame some file's lines with byte-offsets"></param>
 void freeTheFile(file* p_file);
@@ -0,0 +1,156 @@
+/* OutputBuffer.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling the output
+		buffers: every worker copies its' solutions' lines to a private buffer, which is
+		appended to the Tasks file in a single write (a single lock acquisition) once
+		it is full, once its' oldest line is due, or once no tasks remain
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "OutputBuffer.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+outputBuffering* buildOutputBuffering(DWORD bufferSize, DWORD flushIntervalMilliseconds)
+{
+	outputBuffering* p_outputBuffering = NULL;
+	//Input integrity validation
+	if (0 == bufferSize) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the policy (zeroed statistics)
+	if (NULL == (p_outputBuffering = (outputBuffering*)calloc(sizeof(outputBuffering), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the output buffers.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+	p_outputBuffering->bufferSize = bufferSize;
+	p_outputBuffering->flushIntervalMilliseconds = flushIntervalMilliseconds;
+	return p_outputBuffering;
+}
+
+outputBuffer* createOutputBuffer(outputBuffering* p_outputBuffering)
+{
+	outputBuffer* p_outputBuffer = NULL;
+	//Input integrity validation
+	if (NULL == p_outputBuffering) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the buffer & its' bytes
+	if ((NULL == (p_outputBuffer = (outputBuffer*)calloc(sizeof(outputBuffer), SINGLE_OBJECT))) ||
+		(NULL == (p_outputBuffer->p_bytes = (LPTSTR)malloc(p_outputBuffering->bufferSize)))) {
+		printf("Error: Failed to allocate memory for an output buffer of %lu bytes.\n", (unsigned long)p_outputBuffering->bufferSize);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		destroyOutputBuffer(&p_outputBuffer);
+		return NULL;
+	}
+	p_outputBuffer->capacity = p_outputBuffering->bufferSize;
+	p_outputBuffer->flushIntervalMilliseconds = p_outputBuffering->flushIntervalMilliseconds;
+	return p_outputBuffer;
+}
+
+BOOL appendToOutputBuffer(outputBuffer* p_outputBuffer, LPTSTR p_line, DWORD lineLength)
+{
+	//Input integrity validation
+	if ((NULL == p_outputBuffer) || (NULL == p_line)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The line is appended whole or not at all
+	if (lineLength > p_outputBuffer->capacity - p_outputBuffer->numberOfBytes) return OUTPUT_BUFFER_FULL;
+
+	//The first line of an empty buffer starts the flush interval
+	if (0 == p_outputBuffer->numberOfLines) p_outputBuffer->oldestLineTick = GetTickCount64();
+	memcpy(p_outputBuffer->p_bytes + p_outputBuffer->numberOfBytes, p_line, lineLength);
+	p_outputBuffer->numberOfBytes += lineLength;
+	p_outputBuffer->numberOfLines++;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL isOutputBufferFlushDue(outputBuffer* p_outputBuffer)
+{
+	//Input integrity validation
+	if ((NULL == p_outputBuffer) || (0 == p_outputBuffer->numberOfLines) || (0 == p_outputBuffer->flushIntervalMilliseconds)) return FALSE;
+
+	return (GetTickCount64() - p_outputBuffer->oldestLineTick >= p_outputBuffer->flushIntervalMilliseconds) ? TRUE : FALSE;
+}
+
+void recordOutputBufferFlush(outputBuffering* p_outputBuffering, outputBuffer* p_outputBuffer, DWORD reason)
+{
+	//Input integrity validation
+	if ((NULL == p_outputBuffering) || (NULL == p_outputBuffer) || (0 == p_outputBuffer->numberOfLines)) return;
+
+	if (OUTPUT_BUFFER_FLUSH_FULL == reason) InterlockedIncrement(&(p_outputBuffering->numberOfFullFlushes));
+	else if (OUTPUT_BUFFER_FLUSH_TIMED == reason) InterlockedIncrement(&(p_outputBuffering->numberOfTimedFlushes));
+	else InterlockedIncrement(&(p_outputBuffering->numberOfFinalFlushes));
+	InterlockedExchangeAdd64(&(p_outputBuffering->numberOfFlushedBytes), (LONGLONG)p_outputBuffer->numberOfBytes);
+	InterlockedExchangeAdd64(&(p_outputBuffering->numberOfFlushedLines), (LONGLONG)p_outputBuffer->numberOfLines);
+
+	//Emptying the buffer (the worker's own - no lock)
+	p_outputBuffer->numberOfBytes = 0;
+	p_outputBuffer->numberOfLines = 0;
+}
+
+void recordOversizedOutputLine(outputBuffering* p_outputBuffering)
+{
+	//Input integrity validation
+	if (NULL == p_outputBuffering) return;
+
+	InterlockedIncrement(&(p_outputBuffering->numberOfOversizedLines));
+}
+
+void printOutputBufferingStatistics(outputBuffering* p_outputBuffering)
+{
+	LONG numberOfFlushes = 0;
+	//Input integrity validation
+	if (NULL == p_outputBuffering) return;
+
+	numberOfFlushes = p_outputBuffering->numberOfFullFlushes + p_outputBuffering->numberOfTimedFlushes + p_outputBuffering->numberOfFinalFlushes;
+	printf("Output buffers: %lu bytes per thread, %ld writes of a full buffer, %ld timed writes, %ld final writes, %ld oversized lines written alone\n",
+		(unsigned long)p_outputBuffering->bufferSize, (long)p_outputBuffering->numberOfFullFlushes, (long)p_outputBuffering->numberOfTimedFlushes,
+		(long)p_outputBuffering->numberOfFinalFlushes, (long)p_outputBuffering->numberOfOversizedLines);
+	if (0 < numberOfFlushes)
+		printf("\t%lld lines (%lld bytes) written, %.2f lines & %.0f bytes per write on average\n",
+			p_outputBuffering->numberOfFlushedLines, p_outputBuffering->numberOfFlushedBytes,
+			(double)p_outputBuffering->numberOfFlushedLines / numberOfFlushes, (double)p_outputBuffering->numberOfFlushedBytes / numberOfFlushes);
+	printf("\n");
+}
+
+void destroyOutputBuffer(outputBuffer** p_p_outputBuffer)
+{
+	//Input integrity validation
+	if ((NULL == p_p_outputBuffer) || (NULL == *p_p_outputBuffer)) return;
+
+	free((*p_p_outputBuffer)->p_bytes);
+	free(*p_p_outputBuffer);
+	*p_p_outputBuffer = NULL;
+}
+
+void destroyOutputBuffering(outputBuffering** p_p_outputBuffering)
+{
+	//Input integrity validation
+	if ((NULL == p_p_outputBuffering) || (NULL == *p_p_outputBuffering)) return;
+
+	free(*p_p_outputBuffering);
+	*p_p_outputBuffering = NULL;
+}
@@ -0,0 +1,87 @@
+/* OutputBuffer.h
+--------------------------------------------------------
+	Module Description - header module for OutputBuffer.c
+--------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __OUTPUT_BUFFER_H__
+#define __OUTPUT_BUFFER_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+// Constants ---------------------------------------------------
+#define OUTPUT_BUFFER_FULL 2			// appendToOutputBuffer(.)'s outcome when the line doesn't fit in the buffer's free bytes (nothing was appended)
+
+#define OUTPUT_BUFFER_FLUSH_FULL 0		// The buffer was written since the next line didn't fit
+#define OUTPUT_BUFFER_FLUSH_TIMED 1		// The buffer was written since its' oldest line stayed buffered for the flush interval
+#define OUTPUT_BUFFER_FLUSH_FINAL 2		// The buffer was written since no tasks remained
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the output buffers' policy, with zeroed statistics.
+/// </summary>
+/// <param name="DWORD bufferSize - The # of bytes in every worker's buffer (at least 1)"></param>
+/// <param name="DWORD flushIntervalMilliseconds - The longest time a line may stay buffered (0 - until the buffer is full)"></param>
+/// <returns>A pointer to a dynamically allocated 'outputBuffering' struct if successful, or NULL if failed</returns>
+outputBuffering* buildOutputBuffering(DWORD bufferSize, DWORD flushIntervalMilliseconds);
+/// <summary>
+///	 Description - This function creates an empty buffer for a worker, of the policy's size.
+/// </summary>
+/// <param name="outputBuffering* p_outputBuffering - A pointer to the output buffers' policy"></param>
+/// <returns>A pointer to a dynamically allocated 'outputBuffer' struct if successful, or NULL if failed</returns>
+outputBuffer* createOutputBuffer(outputBuffering* p_outputBuffering);
+/// <summary>
+///	 Description - This function copies a solution's line to the end of the worker's buffer, if it fits in the buffer's free bytes.
+/// </summary>
+/// <param name="outputBuffer* p_outputBuffer - A pointer to the worker's buffer"></param>
+/// <param name="LPTSTR p_line - A pointer to the line's characters"></param>
+/// <param name="DWORD lineLength - The # of bytes in the line"></param>
+/// <returns>Appended (TRUE), the line doesn't fit (OUTPUT_BUFFER_FULL) or Failure (FALSE)</returns>
+BOOL appendToOutputBuffer(outputBuffer* p_outputBuffer, LPTSTR p_line, DWORD lineLength);
+/// <summary>
+///	 Description - This function checks whether the buffer's oldest line stayed buffered for the flush interval (if there is one).
+/// </summary>
+/// <param name="outputBuffer* p_outputBuffer - A pointer to the worker's buffer"></param>
+/// <returns>TRUE if the buffer is due to be written, FALSE otherwise</returns>
+BOOL isOutputBufferFlushDue(outputBuffer* p_outputBuffer);
+/// <summary>
+///	 Description - This function records a written buffer in the policy's statistics (atomic increments) & empties the buffer.
+/// </summary>
+/// <param name="outputBuffering* p_outputBuffering - A pointer to the output buffers' policy"></param>
+/// <param name="outputBuffer* p_outputBuffer - A pointer to the worker's buffer, which was written"></param>
+/// <param name="DWORD reason - Why the buffer was written (OUTPUT_BUFFER_FLUSH_*)"></param>
+void recordOutputBufferFlush(outputBuffering* p_outputBuffering, outputBuffer* p_outputBuffer, DWORD reason);
+/// <summary>
+///	 Description - This function records a line longer than a whole buffer, which is written on its' own.
+/// </summary>
+/// <param name="outputBuffering* p_outputBuffering - A pointer to the output buffers' policy"></param>
+void recordOversizedOutputLine(outputBuffering* p_outputBuffering);
+/// <summary>
+///	 Description - This function prints the output buffers' statistics - the writes by reason & their average size.
+/// </summary>
+/// <param name="outputBuffering* p_outputBuffering - A pointer to the output buffers' policy (NULL - nothing is printed)"></param>
+void printOutputBufferingStatistics(outputBuffering* p_outputBuffering);
+/// <summary>
+///	 Description - This function frees a worker's buffer (with any lines left in it) & sets its' pointer to NULL.
+/// </summary>
+/// <param name="outputBuffer** p_p_outputBuffer - A pointer to a pointer to an 'outputBuffer' struct"></param>
+void destroyOutputBuffer(outputBuffer** p_p_outputBuffer);
+/// <summary>
+///	 Description - This function frees the output buffers' policy & sets its' pointer to NULL.
+/// </summary>
+/// <param name="outputBuffering** p_p_outputBuffering - A pointer to a pointer to an 'outputBuffering' struct"></param>
+void destroyOutputBuffering(outputBuffering** p_p_outputBuffering);
+
+
+#endif //__OUTPUT_BUFFER_H__
@@ -0,0 +1,266 @@
+/* PriorityHeap.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling a priority
+		heap of tasks: a binary min-heap, indexed by the tasks' identifiers so a waiting
+		task can be reprioritized or canceled
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "PriorityHeap.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function returns whether an entry is more urgent than another: a lower priority, or an equal priority & a lower identifier.
+/// </summary>
+/// <param name="heapEntry* p_entry - A pointer to an entry"></param>
+/// <param name="heapEntry* p_otherEntry - A pointer to the other entry"></param>
+/// <returns>TRUE if p_entry is more urgent, FALSE otherwise</returns>
+static BOOL isMoreUrgent(heapEntry* p_entry, heapEntry* p_otherEntry);
+/// <summary>
+///  Description - This function places an entry at an index of the heap's entries array & records the index for the entry's identifier.
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG entryIndex - The entry's index"></param>
+/// <param name="heapEntry entry - The entry"></param>
+static void placeEntry(priorityHeap* p_heap, DWORDLONG entryIndex, heapEntry entry);
+/// <summary>
+///  Description - This function moves an entry towards the root while it is more urgent than its' parent.
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG entryIndex - The entry's index"></param>
+static void siftUp(priorityHeap* p_heap, DWORDLONG entryIndex);
+/// <summary>
+///  Description - This function moves an entry towards the leaves while any of its' children is more urgent than it.
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG entryIndex - The entry's index"></param>
+static void siftDown(priorityHeap* p_heap, DWORDLONG entryIndex);
+/// <summary>
+///  Description - This function removes the entry at an index: the last entry takes its' place & is sifted up or down.
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG entryIndex - The entry's index"></param>
+static void removeEntry(priorityHeap* p_heap, DWORDLONG entryIndex);
+/// <summary>
+///  Description - This function doubles the heap's entries array or identifiers' indexes array (realloc), if it is full.
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL growPriorityHeapCapacity(priorityHeap* p_heap);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+priorityHeap* InitializePriorityHeap(DWORDLONG initialCapacity)
+{
+	priorityHeap* p_heap = NULL;
+	//At least a single entry is allocated
+	if (0 == initialCapacity) initialCapacity = 1;
+
+	//Heap struct & arrays dynamic memory allocation
+	if ((NULL == (p_heap = (priorityHeap*)calloc(sizeof(priorityHeap), SINGLE_OBJECT))) ||
+		(NULL == (p_heap->p_entries = (heapEntry*)calloc(sizeof(heapEntry), (size_t)initialCapacity))) ||
+		(NULL == (p_heap->p_entryIndexes = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)initialCapacity)))) {
+		printf("Error: Failed to allocate memory for a priority heap.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		DestroyPriorityHeap(&p_heap);
+		return NULL;
+	}
+	p_heap->capacity = initialCapacity;
+	p_heap->indexesCapacity = initialCapacity;
+
+	//Memory allocation for the heap has been successful
+	return p_heap;
+}
+
+BOOL HeapInsert(priorityHeap* p_heap, DWORDLONG value, LONGLONG priority, PDWORDLONG p_id)
+{
+	heapEntry entry;
+	//Input integrity validation
+	if (NULL == p_heap) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	//Room for the entry & its' identifier
+	if (STATUS_CODE_SUCCESS != growPriorityHeapCapacity(p_heap)) return STATUS_CODE_FAILURE;
+
+	//Appending the entry as the last leaf & sifting it up
+	entry.priority = priority;
+	entry.id = p_heap->nextId++;
+	entry.value = value;
+	placeEntry(p_heap, p_heap->numberOfEntries++, entry);
+	siftUp(p_heap, p_heap->numberOfEntries - 1);
+
+	if (NULL != p_id) *p_id = entry.id;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL HeapPop(priorityHeap* p_heap, PDWORDLONG p_value)
+{
+	//Input integrity validation
+	if ((NULL == p_heap) || (NULL == p_value)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	if (0 == p_heap->numberOfEntries) return HEAP_WAS_EMPTY;
+
+	//The root is the most urgent entry
+	*p_value = p_heap->p_entries->value;
+	removeEntry(p_heap, 0);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL HeapReprioritize(priorityHeap* p_heap, DWORDLONG id, LONGLONG priority)
+{
+	DWORDLONG entryIndex = 0;
+	LONGLONG previousPriority = 0;
+	//Input integrity validation
+	if (NULL == p_heap) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	if ((id >= p_heap->nextId) || (HEAP_NO_ENTRY == (entryIndex = *(p_heap->p_entryIndexes + id)))) return HEAP_ENTRY_NOT_FOUND;
+
+	//A more urgent priority moves the entry towards the root, a less urgent one - towards the leaves
+	previousPriority = (p_heap->p_entries + entryIndex)->priority;
+	(p_heap->p_entries + entryIndex)->priority = priority;
+	if (priority < previousPriority) siftUp(p_heap, entryIndex);
+	else siftDown(p_heap, entryIndex);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL HeapCancel(priorityHeap* p_heap, DWORDLONG id)
+{
+	DWORDLONG entryIndex = 0;
+	//Input integrity validation
+	if (NULL == p_heap) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+	if ((id >= p_heap->nextId) || (HEAP_NO_ENTRY == (entryIndex = *(p_heap->p_entryIndexes + id)))) return HEAP_ENTRY_NOT_FOUND;
+
+	removeEntry(p_heap, entryIndex);
+	return STATUS_CODE_SUCCESS;
+}
+
+void DestroyPriorityHeap(priorityHeap** p_p_heap)
+{
+	//Input integrity validation
+	if ((NULL == p_p_heap) || (NULL == *p_p_heap)) return;
+
+	//Free the arrays & the heap struct
+	free((*p_p_heap)->p_entries);
+	free((*p_p_heap)->p_entryIndexes);
+	free(*p_p_heap);
+	*p_p_heap = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static BOOL isMoreUrgent(heapEntry* p_entry, heapEntry* p_otherEntry)
+{
+	if (p_entry->priority != p_otherEntry->priority) return (p_entry->priority < p_otherEntry->priority);
+	return (p_entry->id < p_otherEntry->id);
+}
+
+static void placeEntry(priorityHeap* p_heap, DWORDLONG entryIndex, heapEntry entry)
+{
+	*(p_heap->p_entries + entryIndex) = entry;
+	*(p_heap->p_entryIndexes + entry.id) = entryIndex;
+}
+
+static void siftUp(priorityHeap* p_heap, DWORDLONG entryIndex)
+{
+	heapEntry entry = *(p_heap->p_entries + entryIndex);
+	DWORDLONG parentIndex = 0;
+	//Moving the less urgent parents down until the entry's place is found
+	while (0 < entryIndex) {
+		parentIndex = (entryIndex - 1) / 2;
+		if (!isMoreUrgent(&entry, p_heap->p_entries + parentIndex)) break;
+		placeEntry(p_heap, entryIndex, *(p_heap->p_entries + parentIndex));
+		entryIndex = parentIndex;
+	}
+	placeEntry(p_heap, entryIndex, entry);
+}
+
+static void siftDown(priorityHeap* p_heap, DWORDLONG entryIndex)
+{
+	heapEntry entry = *(p_heap->p_entries + entryIndex);
+	DWORDLONG childIndex = 0;
+	//Moving the more urgent children up until the entry's place is found
+	while ((childIndex = 2 * entryIndex + 1) < p_heap->numberOfEntries) {
+		if ((childIndex + 1 < p_heap->numberOfEntries) && isMoreUrgent(p_heap->p_entries + childIndex + 1, p_heap->p_entries + childIndex)) childIndex++;
+		if (!isMoreUrgent(p_heap->p_entries + childIndex, &entry)) break;
+		placeEntry(p_heap, entryIndex, *(p_heap->p_entries + childIndex));
+		entryIndex = childIndex;
+	}
+	placeEntry(p_heap, entryIndex, entry);
+}
+
+static void removeEntry(priorityHeap* p_heap, DWORDLONG entryIndex)
+{
+	heapEntry removedEntry = *(p_heap->p_entries + entryIndex);
+	//Asserts
+	assert(NULL != p_heap);
+	assert(entryIndex < p_heap->numberOfEntries);
+
+	//The removed entry's identifier no longer has an entry
+	*(p_heap->p_entryIndexes + removedEntry.id) = HEAP_NO_ENTRY;
+	if (entryIndex == --(p_heap->numberOfEntries)) return;
+
+	//The last entry fills the hole & is sifted to its' place (either direction)
+	placeEntry(p_heap, entryIndex, *(p_heap->p_entries + p_heap->numberOfEntries));
+	if (isMoreUrgent(p_heap->p_entries + entryIndex, &removedEntry)) siftUp(p_heap, entryIndex);
+	else siftDown(p_heap, entryIndex);
+}
+
+static BOOL growPriorityHeapCapacity(priorityHeap* p_heap)
+{
+	heapEntry* p_grownEntries = NULL;
+	PDWORDLONG p_grownEntryIndexes = NULL;
+	//Assert
+	assert(NULL != p_heap);
+
+	//Doubling the entries array if it is full
+	if (p_heap->numberOfEntries == p_heap->capacity) {
+		if (NULL == (p_grownEntries = (heapEntry*)realloc(p_heap->p_entries, sizeof(heapEntry) * (size_t)(2 * p_heap->capacity)))) {
+			printf("Error: Failed to grow the priority heap to %llu entries.\n", 2 * p_heap->capacity);
+			return STATUS_CODE_FAILURE;
+		}
+		p_heap->p_entries = p_grownEntries;
+		p_heap->capacity *= 2;
+	}
+
+	//Doubling the identifiers' indexes array if it is full (identifiers are never reused)
+	if (p_heap->nextId == p_heap->indexesCapacity) {
+		if (NULL == (p_grownEntryIndexes = (PDWORDLONG)realloc(p_heap->p_entryIndexes, sizeof(DWORDLONG) * (size_t)(2 * p_heap->indexesCapacity)))) {
+			printf("Error: Failed to grow the priority heap to %llu identifiers.\n", 2 * p_heap->indexesCapacity);
+			return STATUS_CODE_FAILURE;
+		}
+		p_heap->p_entryIndexes = p_grownEntryIndexes;
+		p_heap->indexesCapacity *= 2;
+	}
+
+	return STATUS_CODE_SUCCESS;
+}
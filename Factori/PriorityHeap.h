@@ -0,0 +1,75 @@
+/* PriorityHeap.h
+----------------------------------------------------------
+	Module Description - header module for PriorityHeap.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __PRIORITY_HEAP_H__
+#define __PRIORITY_HEAP_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+// Constants ---------------------------------------------------
+#define HEAP_WAS_EMPTY 2			// HeapPop(.)'s outcome when the heap has no entries
+#define HEAP_ENTRY_NOT_FOUND 3		// HeapReprioritize(.) & HeapCancel(.)'s outcome when the identifier's task was popped or canceled
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function allocates memory (on the Heap) for a "priorityHeap" struct, its' entries array & its' identifiers' indexes
+///		array, with room for 'initialCapacity' tasks (at least one), and returns a pointer to it (calloc)
+/// </summary>
+/// <param name="DWORDLONG initialCapacity - The number of tasks expected to be inserted (more may be inserted - the arrays grow by doubling)"></param>
+/// <returns>A pointer to an initiated 'priorityHeap' struct if successful, or NULL if failed.</returns>
+priorityHeap* InitializePriorityHeap(DWORDLONG initialCapacity);
+/// <summary>
+///  Description - This function inserts a task to the heap with the next identifier, and sifts it up to its' place (O(log n)).
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG value - The task's value"></param>
+/// <param name="LONGLONG priority - The task's priority (the lower - the more urgent)"></param>
+/// <param name="PDWORDLONG p_id - A pointer to the variable that will be updated with the task's identifier (may be NULL)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL HeapInsert(priorityHeap* p_heap, DWORDLONG value, LONGLONG priority, PDWORDLONG p_id);
+/// <summary>
+///  Description - This function removes the most urgent task (the lowest priority, then the lowest identifier) from the heap (O(log n)).
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="PDWORDLONG p_value - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>Popped a task (TRUE), the heap was empty (HEAP_WAS_EMPTY) or Failure (FALSE)</returns>
+BOOL HeapPop(priorityHeap* p_heap, PDWORDLONG p_value);
+/// <summary>
+///  Description - This function changes the priority of a task that is still in the heap - lowering it (decrease-key) sifts the task up,
+///		raising it sifts the task down (O(log n)).
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG id - The task's identifier"></param>
+/// <param name="LONGLONG priority - The task's new priority"></param>
+/// <returns>Reprioritized (TRUE), the task isn't in the heap (HEAP_ENTRY_NOT_FOUND) or Failure (FALSE)</returns>
+BOOL HeapReprioritize(priorityHeap* p_heap, DWORDLONG id, LONGLONG priority);
+/// <summary>
+///  Description - This function removes a task that is still in the heap, by moving the last entry to its' place (O(log n)).
+/// </summary>
+/// <param name="priorityHeap* p_heap - A pointer to a priorityHeap struct"></param>
+/// <param name="DWORDLONG id - The task's identifier"></param>
+/// <returns>Canceled (TRUE), the task isn't in the heap (HEAP_ENTRY_NOT_FOUND) or Failure (FALSE)</returns>
+BOOL HeapCancel(priorityHeap* p_heap, DWORDLONG id);
+/// <summary>
+///  Description - This function destroys the heap by releasing any memory allocated to the "priorityHeap" struct or its' arrays.
+///		It also sets the heap's pointer to point at NULL address.
+/// </summary>
+/// <param name="priorityHeap** p_p_heap - A pointer to a pointer that points at a priorityHeap struct"></param>
+void DestroyPriorityHeap(priorityHeap** p_p_heap);
+
+
+#endif //__PRIORITY_HEAP_H__
@@ -0,0 +1,259 @@
+/* ProgressWatchdog.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for watching the solving's
+		progress instead of capping it with fixed timeouts: the workers publish what
+		they do & count their completed tasks, while a watchdog thread waits for them
+		with no time cap and fails the solving only once no task was completed within
+		a (configurable) stall window - printing what every worker was doing.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "ProgressWatchdog.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const BOOL  WAIT_FOR_ALL_OBJECTS = TRUE;
+static const int   DEFAULT_THREAD_STACK_SIZE = 0;
+
+static const DWORD WATCHDOG_DEFAULT_STALL_WINDOW_SECONDS = 60;
+static const DWORD WATCHDOG_POLLS_PER_STALL_WINDOW = 4;			//The stall is detected within a quarter of the window past it
+static const DWORD WATCHDOG_MAXIMAL_POLL_INTERVAL_MS = 1000;
+static const ULONGLONG MILLISECONDS_PER_SECOND = 1000;
+
+	//The workers' activities' names (indexed by WORKER_ACTIVITY_*)
+static const char* WORKER_ACTIVITIES_NAMES[NUMBER_OF_WORKER_ACTIVITIES] = {
+	"starting", "fetching a task", "solving", "waiting for the Tasks file lock", "writing the solution", "done" };
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function is the watchdog thread's routine: it waits for the workers in polls, restarts the stall window whenever the
+///		progress counter moved (or while the tasks feed is open - the workers may wait for it), and reports a stall once the window passed.
+/// </summary>
+/// <param name="LPVOID lpParam - A pointer to the threads' parameters struct"></param>
+/// <returns>STATUS_CODE_SUCCESS if all the workers terminated, or STATUS_CODE_FAILURE if a stall was detected or the wait failed</returns>
+static DWORD WINAPI progressWatchdogThread(LPVOID lpParam);
+/// <summary>
+///  Description - This function prints the stall's diagnostics: every worker's activity, its' task & for how long, its' completed tasks,
+///		and the locks' state words.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+static void printWatchdogDiagnostics(threadPackage* p_params);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+BOOL createProgressWatchdog(threadPackage* p_params, DWORD numberOfWorkers, DWORD stallWindowSeconds)
+{
+	progressWatchdog* p_watchdog = NULL;
+	//Input integrity validation
+	if ((NULL == p_params) || (0 == numberOfWorkers)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Watchdog struct & progress slots dynamic memory allocation (a zeroed slot - a starting worker)
+	if (NULL == (p_watchdog = (progressWatchdog*)calloc(sizeof(progressWatchdog), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the progress watchdog.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	if (NULL == (p_watchdog->p_workers = (workerProgress*)calloc(sizeof(workerProgress), numberOfWorkers))) {
+		printf("Error: Failed to allocate memory for the workers' progress slots.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_watchdog);
+		return STATUS_CODE_FAILURE;
+	}
+
+	p_watchdog->numberOfWorkers = numberOfWorkers;
+	p_watchdog->stallWindowMilliseconds = MILLISECONDS_PER_SECOND * ((0 == stallWindowSeconds) ? WATCHDOG_DEFAULT_STALL_WINDOW_SECONDS : stallWindowSeconds);
+	p_params->p_progressWatchdog = p_watchdog;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL registerWatchdogWorker(progressWatchdog* p_watchdog, workerProgress** p_p_progress)
+{
+	DWORD workerIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_watchdog) || (NULL == p_p_progress)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The workers take the slots in registration order
+	workerIndex = (DWORD)InterlockedIncrement(&(p_watchdog->numberOfRegisteredWorkers)) - 1;
+	if (workerIndex >= p_watchdog->numberOfWorkers) {
+		printf("Error: More workers registered than the progress watchdog has slots for.\n");
+		return STATUS_CODE_FAILURE;
+	}
+	*p_p_progress = p_watchdog->p_workers + workerIndex;
+	(*p_p_progress)->threadId = GetCurrentThreadId();
+	reportWorkerActivity(*p_p_progress, WORKER_ACTIVITY_STARTING, 0);
+	return STATUS_CODE_SUCCESS;
+}
+
+void reportWorkerActivity(workerProgress* p_progress, LONG activity, DWORDLONG task)
+{
+	//Input integrity validation
+	if (NULL == p_progress) return;
+
+	//Plain stores - only the worker writes its' slot, the watchdog's diagnostics read a snapshot
+	p_progress->task = task;
+	p_progress->activityStartTick = GetTickCount64();
+	p_progress->activity = activity;
+}
+
+void reportWorkerTaskCompleted(progressWatchdog* p_watchdog, workerProgress* p_progress)
+{
+	//Input integrity validation
+	if ((NULL == p_watchdog) || (NULL == p_progress)) return;
+
+	p_progress->numberOfCompletedTasks++;
+	InterlockedIncrement64(&(p_watchdog->numberOfCompletedTasks));
+}
+
+BOOL startProgressWatchdog(threadPackage* p_params, HANDLE* p_workerHandles)
+{
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_progressWatchdog) || (NULL == p_workerHandles)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	p_params->p_progressWatchdog->p_workerHandles = p_workerHandles;
+	p_params->p_progressWatchdog->h_watchdogThread = CreateThread(NULL, DEFAULT_THREAD_STACK_SIZE, progressWatchdogThread, p_params, 0, NULL);
+	if (NULL == p_params->p_progressWatchdog->h_watchdogThread) {
+		printf("Error: Failed to create the progress watchdog thread, with code: %d.\n", GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL waitForProgressWatchdog(progressWatchdog* p_watchdog)
+{
+	DWORD exitCode = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_watchdog) || (NULL == p_watchdog->h_watchdogThread)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//No time cap - the watchdog returns once the workers terminated, or once they stalled
+	if (WAIT_OBJECT_0 != WaitForSingleObject(p_watchdog->h_watchdogThread, INFINITE)) {
+		printf("Error: Failed to wait for the progress watchdog thread, with code: %d.\n", GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	if (FALSE == GetExitCodeThread(p_watchdog->h_watchdogThread, &exitCode)) {
+		printf("Error when getting the progress watchdog thread's exit code, with code: %d\n", GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+	return (STATUS_CODE_SUCCESS == (BOOL)exitCode) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE;
+}
+
+void destroyProgressWatchdog(progressWatchdog** p_p_watchdog)
+{
+	//Input integrity validation
+	if ((NULL == p_p_watchdog) || (NULL == *p_p_watchdog)) return;
+
+	//The workers' Handles belong to the caller - only the watchdog thread's Handle is closed
+	if (NULL != (*p_p_watchdog)->h_watchdogThread) CloseHandle((*p_p_watchdog)->h_watchdogThread);
+	free((*p_p_watchdog)->p_workers);
+	free(*p_p_watchdog);
+	*p_p_watchdog = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static DWORD WINAPI progressWatchdogThread(LPVOID lpParam)
+{
+	threadPackage* p_params = (threadPackage*)lpParam;
+	progressWatchdog* p_watchdog = NULL;
+	LONGLONG numberOfCompletedTasks = 0, lastNumberOfCompletedTasks = -1;
+	ULONGLONG lastProgressTick = 0, now = 0;
+	DWORD pollIntervalMs = 0, waitCode = 0;
+	//Assert
+	assert((NULL != p_params) && (NULL != p_params->p_progressWatchdog));
+	p_watchdog = p_params->p_progressWatchdog;
+
+	pollIntervalMs = p_watchdog->stallWindowMilliseconds / WATCHDOG_POLLS_PER_STALL_WINDOW;
+	if (WATCHDOG_MAXIMAL_POLL_INTERVAL_MS < pollIntervalMs) pollIntervalMs = WATCHDOG_MAXIMAL_POLL_INTERVAL_MS;
+
+	lastProgressTick = GetTickCount64();
+	while (TRUE) {
+		waitCode = WaitForMultipleObjects(p_watchdog->numberOfWorkers, p_watchdog->p_workerHandles, WAIT_FOR_ALL_OBJECTS, pollIntervalMs);
+		if (WAIT_OBJECT_0 == waitCode) {
+			printf("\nAll threads terminated.\nProceed to validate correctness of the exit codes of the threads...\n");
+			return STATUS_CODE_SUCCESS;
+		}
+		if (WAIT_TIMEOUT != waitCode) {
+			printf("Error: Progress watchdog failed to wait for the threads: 0x%x\nExtended error code: %d\n", waitCode, GetLastError());
+			return STATUS_CODE_FAILURE;
+		}
+
+		//A completed task (or an open feed - the workers may be waiting for it, not stuck) restarts the stall window
+		numberOfCompletedTasks = p_watchdog->numberOfCompletedTasks;
+		now = GetTickCount64();
+		if ((numberOfCompletedTasks != lastNumberOfCompletedTasks) || ((NULL != p_params->p_tasksFeed) && (FALSE == p_params->p_tasksFeed->closed))) {
+			lastNumberOfCompletedTasks = numberOfCompletedTasks;
+			lastProgressTick = now;
+			continue;
+		}
+		if (now - lastProgressTick < p_watchdog->stallWindowMilliseconds) continue;
+
+		//Stall - no task was completed within the whole window
+		printf("\nSTALL: No task was completed for %llu milli-seconds (%lld tasks were completed)... \nSolving various tasks may have failed.\n",
+			now - lastProgressTick, numberOfCompletedTasks);
+		printWatchdogDiagnostics(p_params);
+		return STATUS_CODE_FAILURE;
+	}
+}
+
+static void printWatchdogDiagnostics(threadPackage* p_params)
+{
+	progressWatchdog* p_watchdog = NULL;
+	workerProgress* p_progress = NULL;
+	ULONGLONG now = GetTickCount64();
+	LONG activity = 0;
+	DWORD workerIndex = 0;
+	//Assert
+	assert((NULL != p_params) && (NULL != p_params->p_progressWatchdog));
+	p_watchdog = p_params->p_progressWatchdog;
+
+	printf("%-8s %-12s %-34s %-12s %-12s %s\n", "Worker", "Thread id", "Activity", "Task", "For (ms)", "Completed");
+	for (workerIndex = 0; workerIndex < p_watchdog->numberOfWorkers; workerIndex++) {
+		p_progress = p_watchdog->p_workers + workerIndex;
+		if (workerIndex >= (DWORD)p_watchdog->numberOfRegisteredWorkers) {
+			printf("%-8lu %-12s %s\n", (unsigned long)workerIndex, "-", "not registered");
+			continue;
+		}
+		activity = p_progress->activity;
+		printf("%-8lu %-12lu %-34s %-12llu %-12llu %ld\n", (unsigned long)workerIndex, (unsigned long)p_progress->threadId,
+			((0 <= activity) && (NUMBER_OF_WORKER_ACTIVITIES > activity)) ? WORKER_ACTIVITIES_NAMES[activity] : "unknown",
+			p_progress->task, now - p_progress->activityStartTick, (long)p_progress->numberOfCompletedTasks);
+	}
+
+	//The locks' state words - bit 0: a Writer holds the turnstile, bits 1..31: # Readers inside
+	if (NULL != p_params->p_tasksFileLock)
+		printf("%s lock: state 0x%lx, %ld parked waiters\n", p_params->p_tasksFileLock->p_name, (unsigned long)(ULONG)p_params->p_tasksFileLock->state, (long)p_params->p_tasksFileLock->numberOfWaiters);
+	if (NULL != p_params->p_prioritiesQueueLock)
+		printf("%s lock: state 0x%lx, %ld parked waiters\n", p_params->p_prioritiesQueueLock->p_name, (unsigned long)(ULONG)p_params->p_prioritiesQueueLock->state, (long)p_params->p_prioritiesQueueLock->numberOfWaiters);
+	printf("\n");
+}
@@ -0,0 +1,75 @@
+/* ProgressWatchdog.h
+------------------------------------------------------------
+	Module Description - header module for ProgressWatchdog.c
+------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __PROGRESS_WATCHDOG_H__
+#define __PROGRESS_WATCHDOG_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function creates the progress watchdog of the threads' parameters struct: a progress slot per worker & the stall window.
+///		The watchdog's thread is created later, once the workers exist (startProgressWatchdog).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <param name="DWORD numberOfWorkers - The number of threads that will solve the tasks"></param>
+/// <param name="DWORD stallWindowSeconds - The longest time no task may be completed in, while tasks are in progress (0 - the default window)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL createProgressWatchdog(threadPackage* p_params, DWORD numberOfWorkers, DWORD stallWindowSeconds);
+/// <summary>
+///	 Description - This function gives a starting worker its' progress slot (in registration order).
+/// </summary>
+/// <param name="progressWatchdog* p_watchdog - A pointer to the progress watchdog"></param>
+/// <param name="workerProgress** p_p_progress - A pointer to the variable that will be updated with the worker's progress slot"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. more workers than slots</returns>
+BOOL registerWatchdogWorker(progressWatchdog* p_watchdog, workerProgress** p_p_progress);
+/// <summary>
+///	 Description - This function publishes what the worker is doing now (read by the watchdog's diagnostics). A NULL slot is ignored.
+/// </summary>
+/// <param name="workerProgress* p_progress - A pointer to the worker's progress slot"></param>
+/// <param name="LONG activity - The worker's activity (WORKER_ACTIVITY_*)"></param>
+/// <param name="DWORDLONG task - The task the activity concerns (0 - none)"></param>
+void reportWorkerActivity(workerProgress* p_progress, LONG activity, DWORDLONG task);
+/// <summary>
+///	 Description - This function counts a completed task (its' solution was written, or passed to the ordered output) - the watchdog's
+///		progress counter. A NULL watchdog is ignored.
+/// </summary>
+/// <param name="progressWatchdog* p_watchdog - A pointer to the progress watchdog"></param>
+/// <param name="workerProgress* p_progress - A pointer to the completing worker's progress slot"></param>
+void reportWorkerTaskCompleted(progressWatchdog* p_watchdog, workerProgress* p_progress);
+/// <summary>
+///	 Description - This function creates the watchdog's thread. It waits for the workers with no time cap, and every poll it checks the progress
+///		counter: once no task was completed within the stall window while tasks are in progress (the tasks feed is closed), it prints what every
+///		worker is doing & the locks' states, and terminates with a failure exit code.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (its' progress watchdog was created)"></param>
+/// <param name="HANDLE* p_workerHandles - A pointer to the workers' Handles array"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL startProgressWatchdog(threadPackage* p_params, HANDLE* p_workerHandles);
+/// <summary>
+///	 Description - This function waits (no time cap) for the watchdog's thread, i.e. until all the workers terminated or the watchdog detected a stall.
+/// </summary>
+/// <param name="progressWatchdog* p_watchdog - A pointer to the started progress watchdog"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) - all the workers terminated, or Failure (FALSE) e.g. a stall</returns>
+BOOL waitForProgressWatchdog(progressWatchdog* p_watchdog);
+/// <summary>
+///	 Description - This function destroys the progress watchdog (the watchdog's thread already terminated) & sets its' pointer to NULL.
+/// </summary>
+/// <param name="progressWatchdog** p_p_watchdog - A pointer to a pointer that points at a progressWatchdog struct"></param>
+void destroyProgressWatchdog(progressWatchdog** p_p_watchdog);
+
+
+#endif //__PROGRESS_WATCHDOG_H__
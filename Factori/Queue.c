@@ -7,6 +7,8 @@
 // Library includes ----------------------------------------------------------------------
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 #include <Windows.h>
 #include <assert.h>
 
@@ -27,11 +29,11 @@ static const BOOL QUEUE_IS_NOT_EMPTY = 1;
 // initials-position-byte-offsets won't be able to receive (no task will receive them either because
 // tasks' values are upper bounded by 999,999,999). The reason for that is that
 // the there has to be an empty line in the end of the Tasks list file, which means the last two
-// characters whould have to be Carriage Return and Newline, so the Tasks Priorities list file,
-// even if the Tasks list file is upper bounded by a size of 4GB, won't have an initial-position-byte-offset
-// value greater than 4,294,967,294 which is ULONG_MAX-1, so ULONG_MAX-1 & ULONG_MAX are free for use as indicators.
-static const DWORD TOP_SPECIAL_FAILURE_STATUS_CODE = ULONG_MAX;
-static const DWORD TOP_QUEUE_WAS_EMPTY = ULONG_MAX-1;
+// characters whould have to be Carriage Return and Newline, so the Tasks Priorities list file
+// won't have an initial-position-byte-offset value greater than ULLONG_MAX-2 (64-bit offsets),
+// so ULLONG_MAX-1 & ULLONG_MAX are free for use as indicators.
+static const DWORDLONG TOP_SPECIAL_FAILURE_STATUS_CODE = ULLONG_MAX;
+static const DWORDLONG TOP_QUEUE_WAS_EMPTY = ULLONG_MAX-1;
 
 
 static const BOOL POP_QUEUE_WAS_EMPTY = -2;
@@ -40,12 +42,12 @@ static const BOOL POP_QUEUE_WAS_EMPTY = -2;
 
 // Functions declerations ------------------------------------------------------------------
 /// <summary>
-///  Description - This function allocates memory (on the Heap) for a "cell" struct and returns a pointer to it, after
-///		setting its' fields with the input cell value.
+///  Description - This function doubles the capacity of a full queue's cells array (realloc). The cells that wrapped around the
+///		array's end are moved to the new half, so the queue's cells remain contiguous (modulo the new capacity) from the top cell.
 /// </summary>
-/// <param name="DWORD value - An unsigned integer value"></param>
-/// <returns>A pointer to an initiated 'cell' struct with an updated fields if successful, or NULL if failed.</returns>
-static cell* cellStructMemoryAllocation(DWORD value);
+/// <param name="queue* p_queue - A pointer to a full queue struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL growQueueCapacity(queue* p_queue);
 
 
 
@@ -55,7 +57,7 @@ static cell* cellStructMemoryAllocation(DWORD value);
 
 
 // Functions definitions ------------------------------------------------------------------
-queue* InitializeQueue()
+queue* InitializeQueue(DWORDLONG initialCapacity)
 {
 	queue* p_queue = NULL;
 	//Queue struct dynamic memory allocation
@@ -65,6 +67,15 @@ queue* InitializeQueue()
 		return NULL;
 	}
 
+	//Cells array dynamic memory allocation (all the expected cells at once)
+	p_queue->capacity = (0 < initialCapacity) ? initialCapacity : SINGLE_OBJECT;
+	if (NULL == (p_queue->p_cells = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)p_queue->capacity))) {
+		printf("Error: Failed to allocate memory for a Queue's cells array.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s", __FILE__, __LINE__, __func__);
+		free(p_queue);
+		return NULL;
+	}
+
 	//Memory allocation for the Queue struct has been successful
 	return p_queue;
 }
@@ -72,61 +83,50 @@ queue* InitializeQueue()
 
 
 
-DWORD Top(queue* p_queue)
+DWORDLONG Top(queue* p_queue)
 {
 	//Input integrity validation
 	if (NULL == p_queue) {
 		printf("Error: Bad input to function: %s\n", __func__);  return TOP_SPECIAL_FAILURE_STATUS_CODE;
 	}
 	//Returning the Top element's value in the queue
-	if(QUEUE_IS_NOT_EMPTY == Empty(p_queue)) return (p_queue->firstCell)->value;
+	if(QUEUE_IS_NOT_EMPTY == Empty(p_queue)) return *(p_queue->p_cells + p_queue->topCell);
 	else {
-		printf("Thread no. %lu: Queue is already empty(TOP)!!\n\n", GetCurrentThreadId()); 
+		printf("Thread no. %lu: Queue is already empty(TOP)!!\n\n", (unsigned long)GetCurrentThreadId()); 
 		return TOP_QUEUE_WAS_EMPTY; //Consider erasing the message to prevent overloading CMD
 	}
 }
 
 BOOL Pop(queue* p_queue)
 {
-	cell* p_newFirstCell = NULL;
 	//Input integrity validation
 	if (NULL == p_queue) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 	//Poping the top element in queue
 	if (QUEUE_IS_NOT_EMPTY == Empty(p_queue)) {
-		//Save the second-top element in the queue (might be NULL but its' okay)
-		p_newFirstCell = (p_queue->firstCell)->p_next;
-		//Free the top element in the queue
-		free(p_queue->firstCell);
-		//Define (connect) the queue's top element to be the second-top element
-		p_queue->firstCell = p_newFirstCell;
-		//if p_newFirstCell == NULL, then it sets the queue's state to QUEUE_IS_EMPTY according to Empty's definition
+		//The second-top element (wrapping around the array's end) becomes the top element
+		p_queue->topCell = (p_queue->topCell + 1) % p_queue->capacity;
+		//if the queue had a single cell, then it sets the queue's state to QUEUE_IS_EMPTY according to Empty's definition
+		p_queue->numberOfCells--;
 		return STATUS_CODE_SUCCESS;
 	}
 	else {//No need to validate Empty(p_queue) returns QUEUE_IS_EMPTY rather than STATUS_CODE_FAILURE,
 		  // because the same input integrity validation was examined in the current function as well
-		printf("Thread no. %lu: Queue is already empty(POP)!!\n\n", GetCurrentThreadId()); 
+		printf("Thread no. %lu: Queue is already empty(POP)!!\n\n", (unsigned long)GetCurrentThreadId()); 
 		return POP_QUEUE_WAS_EMPTY;			//Consider erasing the message to prevent overloading CMD
 	}
 }
 
-BOOL Push(queue* p_queue, DWORD value)
+BOOL Push(queue* p_queue, DWORDLONG value)
 {
-	cell* p_currentCellInQueue = NULL;
 	//Input integrity validation
-	if ((NULL == p_queue) || (0 > value)) {
+	if (NULL == p_queue) {
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
-	//Pushing another element to the end of the queue
-	if (QUEUE_IS_NOT_EMPTY == Empty(p_queue)) {
-		p_currentCellInQueue = p_queue->firstCell;
-		//Search for last cell in the queue to append the new element to it
-		while (NULL != p_currentCellInQueue->p_next) {
-			//Continue searching for the last cell in the queue
-			p_currentCellInQueue = p_currentCellInQueue->p_next;
-		}
-		if (NULL == (p_currentCellInQueue->p_next = cellStructMemoryAllocation(value))) {
+	//A full cells array is doubled first
+	if (p_queue->numberOfCells == p_queue->capacity) {
+		if (STATUS_CODE_FAILURE == growQueueCapacity(p_queue)) {
 			printf("Releasing the Queue & Exiting...\n");
 			if (STATUS_CODE_SUCCESS == DestroyQueue(&p_queue))
 				printf("Destroying queue succeeded...\n");
@@ -134,15 +134,10 @@ BOOL Push(queue* p_queue, DWORD value)
 			return STATUS_CODE_FAILURE;
 		}
 	}
-	else //No need to validate Empty(p_queue) returns QUEUE_IS_EMPTY rather than STATUS_CODE_FAILURE,
-		 // because the same input integrity validation was examined in the current function as well
-		if (NULL == (p_queue->firstCell = cellStructMemoryAllocation(value))) {
-			printf("Releasing the Queue & Exiting...\n");
-			if (STATUS_CODE_SUCCESS == DestroyQueue(&p_queue))
-				printf("Destroying queue succeeded...\n");
-			else printf("Destroying queue failed...\n");
-			return STATUS_CODE_FAILURE;
-		}
+	//Writing the new element to the cell following the last cell in the queue (wrapping around the array's end)
+	*(p_queue->p_cells + (p_queue->topCell + p_queue->numberOfCells) % p_queue->capacity) = value;
+	p_queue->numberOfCells++;
+
 	//Inserting a new element to the end of the queue succeeded
 	return STATUS_CODE_SUCCESS;
 }
@@ -157,72 +152,68 @@ BOOL Empty(queue* p_queue)
 		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
 	//Return the emptiness state of the queue
-	return (NULL == p_queue->firstCell) ? QUEUE_IS_EMPTY : QUEUE_IS_NOT_EMPTY;
+	return (0 == p_queue->numberOfCells) ? QUEUE_IS_EMPTY : QUEUE_IS_NOT_EMPTY;
 }
 
 
 
 
 
-BOOL DestroyQueue(queue** p_p_queue)
+DWORDLONG At(queue* p_queue, DWORDLONG position)
 {
-	queue* p_queue = NULL;
-	cell* p_cell = NULL, *p_next = NULL;
 	//Input integrity validation
-	if (NULL == p_p_queue) {
-		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	if (NULL == p_queue) {
+		printf("Error: Bad input to function: %s\n", __func__);  return TOP_SPECIAL_FAILURE_STATUS_CODE;
 	}
-	//Receive the queue's address
-	p_queue = *p_p_queue;
+	//No cell at that position (no message - this is the usual end of a dispatch by positions)
+	if (position >= p_queue->numberOfCells) return TOP_QUEUE_WAS_EMPTY;
+	//Returning the value 'position' cells after the top cell (wrapping around the array's end)
+	return *(p_queue->p_cells + (p_queue->topCell + position) % p_queue->capacity);
+}
 
-	printf("Beginning Queue destruction...\n");
-	//Destroy Queue according to its' state: empty\not empty\queue address not legal
-	switch (Empty(p_queue)) {
-	case 1:  // Not Empty Queue
-		p_cell = p_queue->firstCell;
-		while (p_cell != NULL) {
-			p_next = p_cell->p_next;
-			free(p_cell);
-			//Continue to next cell - it might be NULL which will end the loop & will set the queue's state to empty
-			p_cell = p_next;
-		}
-		//Free queue
-		free(p_queue);
-		//Set the address pointed by the queue to NULL
-		*p_p_queue = NULL;
-		//Queue destruction succeeded
-		return STATUS_CODE_SUCCESS;
 
-	case 2:  // Empty Queue
-		//Free queue
-		free(p_queue);
-		//Set the address pointed by the queue to NULL
-		*p_p_queue = NULL;
-		//Queue destruction succeeded
-		return STATUS_CODE_SUCCESS;
 
-	default:
-		//Queue's address isn't legal...
-		return STATUS_CODE_FAILURE;
+
+
+BOOL DestroyQueue(queue** p_p_queue)
+{
+	//Input integrity validation
+	if ((NULL == p_p_queue) || (NULL == *p_p_queue)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
 	}
+
+	printf("Beginning Queue destruction...\n");
+	//Free the cells array & the queue (a single allocation each, whether the queue is empty or not)
+	free((*p_p_queue)->p_cells);
+	free(*p_p_queue);
+	//Set the address pointed by the queue to NULL
+	*p_p_queue = NULL;
+	//Queue destruction succeeded
+	return STATUS_CODE_SUCCESS;
 }
 
 
 //......................................Static functions..........................................
-static cell* cellStructMemoryAllocation(DWORD value)
+static BOOL growQueueCapacity(queue* p_queue)
 {
-	cell* p_cell = NULL;
+	PDWORDLONG p_cells = NULL;
+	DWORDLONG wrappedCells = 0;
 	//Assert
-	assert(0 <= value);
-	//First cell (struct) in queue dynamic memory allocation
-	if (NULL == (p_cell = (cell*)calloc(sizeof(cell), SINGLE_OBJECT))) {
-		printf("Error: Failed to allocate memory for a cell struct.\n");
+	assert(NULL != p_queue);
+
+	//Doubling the cells array
+	if (NULL == (p_cells = (PDWORDLONG)realloc(p_queue->p_cells, sizeof(DWORDLONG) * (size_t)(p_queue->capacity * 2)))) {
+		printf("Error: Failed to reallocate memory for a Queue's cells array.\n");
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
-		return NULL;
+		return STATUS_CODE_FAILURE;
 	}
-	//Updating cell with value
-	p_cell->value = value;
+	p_queue->p_cells = p_cells;
+
+	//Moving the cells that wrapped around the old array's end right after it
+	wrappedCells = (p_queue->topCell + p_queue->numberOfCells > p_queue->capacity) ? (p_queue->topCell + p_queue->numberOfCells - p_queue->capacity) : 0;
+	if (0 < wrappedCells) memcpy(p_queue->p_cells + p_queue->capacity, p_queue->p_cells, sizeof(DWORDLONG) * (size_t)wrappedCells);
+	p_queue->capacity *= 2;
 
-	//Memory allocation for a cell struct has been successful
-	return p_cell;
-}
\ No newline at end of file
+	//Growing the cells array succeeded
+	return STATUS_CODE_SUCCESS;
+}
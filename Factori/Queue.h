@@ -11,6 +11,7 @@
 
 
 // Library includes --------------------------------------------
+#include <limits.h>
 #include <Windows.h>
 
 
@@ -18,37 +19,44 @@
 #include "HardCodedData.h"
 
 
+// Constants ---------------------------------------------------
+	//Top(.)'s return value when the queue is empty (a value no byte offset can reach - see Queue.c)
+#define QUEUE_EMPTY_TOP_VALUE (ULLONG_MAX - 1)
+
 
 //Functions Declarations
 
 /// <summary>
-///	 Description - This function allocates memory (on the Heap) for a "queue" struct and returns a pointer to it (calloc)
+///	 Description - This function allocates memory (on the Heap) for a "queue" struct and its' cells array, with room for
+///		'initialCapacity' cells (at least one), and returns a pointer to it (calloc)
 /// </summary>
+/// <param name="DWORDLONG initialCapacity - The number of cells expected to be pushed (more may be pushed - the array grows by doubling)"></param>
 /// <returns>A pointer to an initiated 'queue' struct if successful, or NULL if failed.</returns>
-queue* InitializeQueue();
+queue* InitializeQueue(DWORDLONG initialCapacity);
 /// <summary>
 ///  Description - This function implements the abstract utility to "take a look" at a queue's top value. The function returns
-///		the top value of the nested-list implementing the queue. It also may return a status code if the queue is empty..
+///		the top value of the ring buffer implementing the queue (O(1)). It also may return a status code if the queue is empty..
 /// </summary>
 /// <param name="queue* p_queue - A pointer to a queue struct"></param>
-/// <returns>An unsigned integer of the value stored in the top 'cell' in the queue. Also in the case of an empty queue, the value ULONG_MAX-1 is returned, and in the case of failure, the value ULONG_MAX is returned (explanation is noted in near constants definitions)</returns>
-DWORD Top(queue* p_queue);
+/// <returns>An unsigned 64-bit integer of the value stored in the top 'cell' in the queue. Also in the case of an empty queue, the value ULLONG_MAX-1 (QUEUE_EMPTY_TOP_VALUE) is returned, and in the case of failure, the value ULLONG_MAX is returned (explanation is noted in near constants definitions)</returns>
+DWORDLONG Top(queue* p_queue);
 /// <summary>
-///  Description - This function implements the abstract utility to remove a queue's top value. The function removes the top cell of the nested-list
-///		that implements the queue if the queue isn't empty, and does nothing if the queue is empty (besides printing a relevant message to the screen 
+///  Description - This function implements the abstract utility to remove a queue's top value. The function advances the top cell of the ring buffer
+///		that implements the queue if the queue isn't empty (O(1)), and does nothing if the queue is empty (besides printing a relevant message to the screen 
 ///		returning a relevant status code).
 /// </summary>
 /// <param name="queue* p_queue - A pointer to a queue struct"></param>
 /// <returns>A BOOL value representing the function's outcome (Either pop removed the top cell or didn't). Popped the top cell (1), queue was empty (-2) or Failure (0)</returns>
 BOOL Pop(queue* p_queue);
 /// <summary>
-///  Description - This function implements the abstract utility to append a cell to a queue. The function appends a cell to the end of the nested-list
-///		containing the inputted value. Also the function might destroy the queue if any memory allocation error has occured.
+///  Description - This function implements the abstract utility to append a cell to a queue. The function writes the inputted value to the cell
+///		following the last cell of the ring buffer (O(1)), after doubling the cells array if it is full. Also the function might destroy the queue
+///		if any memory allocation error has occured.
 /// </summary>
 /// <param name="queue* p_queue - A pointer to a queue struct"></param>
-/// <param name="DWORD value - An unsigned integer value to be inserted at the bottom of the queue"></param>
+/// <param name="DWORDLONG value - An unsigned 64-bit integer value to be inserted at the bottom of the queue"></param>
 /// <returns>A BOOL value representing the function's outcome (The function managed to append additional cell to the end of the queue). Success (TRUE) or Failure (False)</returns>
-BOOL Push(queue* p_queue, DWORD value);
+BOOL Push(queue* p_queue, DWORDLONG value);
 /// <summary>
 ///  Description - This function implements the abstract utility to check a queue emptiness status. 
 ///		The function returns a status code
@@ -57,7 +65,16 @@ BOOL Push(queue* p_queue, DWORD value);
 /// <returns>A BOOL value representing the function's outcome (Queue is empty or not). Empty (2), Not empty (1) or Failure (0)</returns>
 BOOL Empty(queue* p_queue);
 /// <summary>
-///  Description - This function destroys the queue by releasing any memory allocated to the "queue" struct or its' "cell"s structs.
+///  Description - This function returns the value of the cell at a given position from the queue's top cell (position 0 is the top cell),
+///		without modifying the queue (O(1)). Since it doesn't modify the queue, any number of threads may call it simultaneously on a
+///		queue that is no longer pushed or popped.
+/// </summary>
+/// <param name="queue* p_queue - A pointer to a queue struct"></param>
+/// <param name="DWORDLONG position - The cell's position from the top of the queue"></param>
+/// <returns>An unsigned 64-bit integer of the value stored in the cell. In the case the queue has no cell at that position, QUEUE_EMPTY_TOP_VALUE is returned, and in the case of failure, the value ULLONG_MAX is returned</returns>
+DWORDLONG At(queue* p_queue, DWORDLONG position);
+/// <summary>
+///  Description - This function destroys the queue by releasing any memory allocated to the "queue" struct or its' cells array.
 ///		It also sets the queue's pointer to point at NULL address, and returns a final status code of the operation.
 /// </summary>
 /// <param name="queue** p_p_queue - A pointer to a pointer that points at a queue struct"></param>
@@ -32,6 +32,12 @@ static const DWORD SINGLE_OBJECT = 1;
 
 static const DWORD NUMBER_OF_TEXT_CHARACTERS_BESIDES_THE_PRIME_FACTORS_CHARACTERS = 20/*words*/ + 5/*spaces*/ + 1/*colon*/ +2/*newline*/;
 
+static const BOOL  PRIME_FACTORS_CALCULATION_CANCELLED = (BOOL)-2;
+static const DWORD CANCELLATION_POLLING_INTERVAL = 1024; //Iterations between two polls of the cancellation token
+
+//A 32-bit number has at most 32 prime factors (2^32 is the largest power of 2)
+#define MAXIMAL_NUMBER_OF_PRIME_FACTORS 32
+
 
 
 // Functions decleraitions ---------------------------------------------------------------
@@ -67,8 +73,42 @@ static DWORD calculateSquareRootBinary(DWORD splittedNumber);
 /// </summary>
 /// <param name="DWORD number - An unsigned integer number which is a task's value"></param>
 /// <param name="primeFactors* p_numberFactors - A pointer to a previously allocated (dynamic memory) 'primeFactors' struct"></param>
-/// <returns>A BOOL value representing the function's outcome (The number was dissolved correctly to the prime factors combining it and the values were inserted to p_numberFactors in order for lowest to highest). Success (TRUE) or Failure (False)</returns>
-static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors);
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token polled every CANCELLATION_POLLING_INTERVAL divisions (NULL - never cancelled)"></param>
+/// <returns>A BOOL value representing the function's outcome (The number was dissolved correctly to the prime factors combining it and the values were inserted to p_numberFactors in order for lowest to highest). Success (TRUE), PRIME_FACTORS_CALCULATION_CANCELLED or Failure (False)</returns>
+static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors, cancellationToken* p_cancellationToken);
+/// <summary>
+///  Description - This function computes (a * b) mod modulus without overflowing - the operands are smaller than 2^32, so their product fits 64 bits.
+/// </summary>
+/// <param name="DWORDLONG a - The first operand (smaller than the modulus)"></param>
+/// <param name="DWORDLONG b - The second operand (smaller than the modulus)"></param>
+/// <param name="DWORDLONG modulus - The modulus (smaller than 2^32)"></param>
+/// <returns>An unsigned 64-bit integer representing (a * b) mod modulus</returns>
+static DWORDLONG multiplyModulo(DWORDLONG a, DWORDLONG b, DWORDLONG modulus);
+/// <summary>
+///  Description - This function tests whether a number is a prime with the Miller-Rabin test. The bases 2, 7 & 61 make the test deterministic
+///		for every number smaller than 4,759,123,141 (thus every 32-bit number).
+/// </summary>
+/// <param name="DWORD number - An unsigned integer number"></param>
+/// <returns>TRUE if the number is a prime, FALSE otherwise</returns>
+static BOOL isPrimeByMillerRabin(DWORD number);
+/// <summary>
+///  Description - This function finds a non-trivial divisor of an odd composite number with Pollard's rho (Floyd's cycle detection over
+///		x -> x^2 + c mod number). A failed walk is retried with the next constant c.
+/// </summary>
+/// <param name="DWORD number - An odd composite number"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token polled every CANCELLATION_POLLING_INTERVAL steps (NULL - never cancelled)"></param>
+/// <param name="PDWORD p_divisor - A pointer to the variable that will be updated with the divisor found"></param>
+/// <returns>Success (TRUE) or PRIME_FACTORS_CALCULATION_CANCELLED</returns>
+static BOOL findDivisorByPollardRho(DWORD number, cancellationToken* p_cancellationToken, PDWORD p_divisor);
+/// <summary>
+///  Description - This function computes the same nested-list as calculatePrimeFactors(.), by splitting the number with Pollard's rho until
+///		all its' parts are primes, and sorting the primes from lowest to greatest.
+/// </summary>
+/// <param name="DWORD number - An unsigned integer number which is a task's value"></param>
+/// <param name="primeFactors* p_numberFactors - A pointer to a previously allocated (dynamic memory) 'primeFactors' struct"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token polled while splitting (NULL - never cancelled)"></param>
+/// <returns>Success (TRUE), PRIME_FACTORS_CALCULATION_CANCELLED or Failure (False)</returns>
+static BOOL calculatePrimeFactorsByPollardRho(DWORD number, primeFactors* p_numberFactors, cancellationToken* p_cancellationToken);
 /// <summary>
 ///	 Description - This function allocates memory (on the Heap) for a "factorizedString" struct and returns a pointer to it, after
 ///		setting its' fields with the inputs - a pointer to the string itself, and the string's length.
@@ -90,9 +130,18 @@ static factorizedString* changeFactorsListToFactorsCharacterString(primeFactors*
 // Functions definitions ---------------------------------------------------------------
 
 factorizedString* receivePrimeFactorizedListString(DWORD number)
+{
+	//Trial division, never cancelled
+	return receiveCancelablePrimeFactorizedListString(number, FALSE, NULL);
+}
+
+
+
+factorizedString* receiveCancelablePrimeFactorizedListString(DWORD number, BOOL usePollardRho, cancellationToken* p_cancellationToken)
 {
 	primeFactors* p_numberFactors = NULL;
 	factorizedString* p_taskPrimeFactorsString = NULL;
+	BOOL retVal = STATUS_CODE_FAILURE;
 	
 	//Input integrity validation
 	if (0 >= number) {
@@ -111,7 +160,14 @@ factorizedString* receivePrimeFactorizedListString(DWORD number)
 
 
 	//Calculate the prime factors the task(number) is comprised of & insert them to the prime factors' nested-list
-	if (STATUS_CODE_FAILURE == calculatePrimeFactors(number, p_numberFactors)) {
+	retVal = (TRUE == usePollardRho) ?
+		calculatePrimeFactorsByPollardRho(number, p_numberFactors, p_cancellationToken) :
+		calculatePrimeFactors(number, p_numberFactors, p_cancellationToken);
+	if (PRIME_FACTORS_CALCULATION_CANCELLED == retVal) {
+		freeThePrimeFactors(p_numberFactors);
+		return NULL;
+	}
+	if (STATUS_CODE_FAILURE == retVal) {
 		freeThePrimeFactors(p_numberFactors);
 		printf("Error: Failed to calculate the number's factors & arrange them from small to big.\n");
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
@@ -141,6 +197,15 @@ factorizedString* receivePrimeFactorizedListString(DWORD number)
 
 
 
+BOOL isCancellationRequested(cancellationToken* p_cancellationToken)
+{
+	//No token - the solution is always wanted
+	if (NULL == p_cancellationToken) return FALSE;
+	return (p_cancellationToken->expectedValue != *(p_cancellationToken->p_watchedValue)) ? TRUE : FALSE;
+}
+
+
+
 //......................................Static functions..........................................
 
 
@@ -233,7 +298,7 @@ static DWORD calculateSquareRootBinary(DWORD splittedNumber)
 	}
 	return (DWORD)floorSqrt;
 }
-static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors)
+static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors, cancellationToken* p_cancellationToken)
 {
 	DWORD i = 3, squareRootOfNumber = 0; 
 	factor* p_prevFactor = NULL, * p_currentFactor = NULL;
@@ -267,6 +332,8 @@ static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors)
 	squareRootOfNumber = calculateSquareRootBinary(number);
 	//Continue to find further factors of the number, which are greater than '2', and are primal numbers themselves
 	while (i <= squareRootOfNumber) {
+		//Another solver may have already finished the task (the list built so far is freed by the caller)
+		if ((0 == ((i >> 1) % CANCELLATION_POLLING_INTERVAL)) && (TRUE == isCancellationRequested(p_cancellationToken))) return PRIME_FACTORS_CALCULATION_CANCELLED;
 		//Beginning stripping from number its' 'i'ths factors 
 		while ((number % i) == 0) {
 			//Update number after dividing it with 'i' to remove 'i' from number as a prime factor 
@@ -302,6 +369,126 @@ static BOOL calculatePrimeFactors(DWORD number, primeFactors* p_numberFactors)
 	//The number's factors computation & arranging them in order from smallest to biggest was successful
 	return STATUS_CODE_SUCCESS;
 }
+static DWORDLONG multiplyModulo(DWORDLONG a, DWORDLONG b, DWORDLONG modulus)
+{
+	//Assert
+	assert(0 < modulus);
+	return (a * b) % modulus;
+}
+static BOOL isPrimeByMillerRabin(DWORD number)
+{
+	static const DWORD bases[] = { 2, 7, 61 };
+	DWORDLONG power = 0, oddPart = 0, exponent = 0, base = 0;
+	DWORD baseIndex = 0, squaringsCount = 0, exponentTwos = 0;
+
+	//Small numbers & even numbers
+	if (2 > number) return FALSE;
+	if ((2 == number) || (3 == number)) return TRUE;
+	if (0 == number % 2) return FALSE;
+
+	//number - 1 = oddPart * 2^exponentTwos
+	for (oddPart = (DWORDLONG)number - 1; 0 == oddPart % 2; oddPart /= 2) exponentTwos++;
+
+	for (baseIndex = 0; baseIndex < sizeof(bases) / sizeof(bases[0]); baseIndex++) {
+		if (0 == bases[baseIndex] % number) continue;
+		//power = base^oddPart mod number (square & multiply)
+		power = 1;
+		base = bases[baseIndex] % number;
+		for (exponent = oddPart; 0 < exponent; exponent >>= 1) {
+			if (exponent & 1) power = multiplyModulo(power, base, number);
+			base = multiplyModulo(base, base, number);
+		}
+		if ((1 == power) || ((DWORDLONG)number - 1 == power)) continue;
+		//Squaring must reach number - 1 before the exponent reaches number - 1
+		for (squaringsCount = 1; squaringsCount < exponentTwos; squaringsCount++) {
+			power = multiplyModulo(power, power, number);
+			if ((DWORDLONG)number - 1 == power) break;
+		}
+		if (squaringsCount == exponentTwos) return FALSE; //The base witnesses that the number is composite
+	}
+
+	//No base witnessed a composite
+	return TRUE;
+}
+static BOOL findDivisorByPollardRho(DWORD number, cancellationToken* p_cancellationToken, PDWORD p_divisor)
+{
+	DWORDLONG tortoise = 0, hare = 0, constant = 0, difference = 0, a = 0, b = 0, remainder = 0;
+	DWORD steps = 0;
+	//Asserts
+	assert(1 == number % 2);
+	assert(NULL != p_divisor);
+
+	for (constant = 1; constant < number; constant++) {
+		tortoise = hare = 2;
+		*p_divisor = 1;
+		while (1 == *p_divisor) {
+			//Another solver may have already finished the task
+			if ((0 == (++steps % CANCELLATION_POLLING_INTERVAL)) && (TRUE == isCancellationRequested(p_cancellationToken))) return PRIME_FACTORS_CALCULATION_CANCELLED;
+			//The tortoise advances one step, the hare two steps
+			tortoise = (multiplyModulo(tortoise, tortoise, number) + constant) % number;
+			hare = (multiplyModulo(hare, hare, number) + constant) % number;
+			hare = (multiplyModulo(hare, hare, number) + constant) % number;
+			//The divisor is gcd(|tortoise - hare|, number) (Euclid)
+			difference = (tortoise > hare) ? tortoise - hare : hare - tortoise;
+			for (a = difference, b = number; 0 != b; a = b, b = remainder) remainder = a % b;
+			*p_divisor = (DWORD)a;
+		}
+		//The walk met its' cycle on number itself - retry with the next constant
+		if (number != *p_divisor) return STATUS_CODE_SUCCESS;
+	}
+
+	//Unreachable for an odd composite number
+	*p_divisor = number;
+	return STATUS_CODE_SUCCESS;
+}
+static BOOL calculatePrimeFactorsByPollardRho(DWORD number, primeFactors* p_numberFactors, cancellationToken* p_cancellationToken)
+{
+	DWORD factors[MAXIMAL_NUMBER_OF_PRIME_FACTORS], composites[MAXIMAL_NUMBER_OF_PRIME_FACTORS];
+	DWORD numberOfFactors = 0, numberOfComposites = 0, part = 0, divisor = 0, i = 0, j = 0, swap = 0;
+	factor* p_currentFactor = NULL;
+	//Asserts
+	assert(0 < number);
+	assert(NULL != p_numberFactors);
+
+	//The factors '2's are stripped by shifting
+	for (; 0 == number % 2; number /= 2) factors[numberOfFactors++] = 2;
+
+	//Splitting the parts until all of them are primes
+	if (1 < number) composites[numberOfComposites++] = number;
+	while (0 < numberOfComposites) {
+		part = composites[--numberOfComposites];
+		if (TRUE == isPrimeByMillerRabin(part)) {
+			factors[numberOfFactors++] = part;
+			continue;
+		}
+		if (PRIME_FACTORS_CALCULATION_CANCELLED == findDivisorByPollardRho(part, p_cancellationToken, &divisor)) return PRIME_FACTORS_CALCULATION_CANCELLED;
+		composites[numberOfComposites++] = divisor;
+		composites[numberOfComposites++] = part / divisor;
+	}
+
+	//Sorting the primes from lowest to greatest (insertion sort - at most 32 primes)
+	for (i = 1; i < numberOfFactors; i++) {
+		for (j = i; (0 < j) && (factors[j - 1] > factors[j]); j--) {
+			swap = factors[j]; factors[j] = factors[j - 1]; factors[j - 1] = swap;
+		}
+	}
+
+	//Inserting the primes to the nested-list (the first cell is already allocated)
+	p_currentFactor = p_numberFactors->p_firstFactor;
+	for (i = 0; i < numberOfFactors; i++) {
+		if (0 < i) {
+			if (NULL == (p_currentFactor->p_nextFactor = factorStructMemoryAllocation())) return STATUS_CODE_FAILURE;
+			p_currentFactor = p_currentFactor->p_nextFactor;
+		}
+		p_currentFactor->factor = factors[i];
+		//Update the primeFactors struct with additional factor count & additional characters to the repersentation string
+		p_numberFactors->numberOfPrimeFactors += 1;
+		p_numberFactors->numberOfCharacters += numberOfCharactersInNumber(factors[i]);
+	}
+
+	//The number's factors computation & arranging them in order from smallest to biggest was successful
+	return STATUS_CODE_SUCCESS;
+}
 
 
 
@@ -31,6 +31,21 @@
 /// <param name="DWORD number - An unsgined integer representing a task's value"></param>
 /// <returns>A pointer to a 'factorizedString' containing the solution of the inputted task if successful, or NULL if anything failed (mainly mem. alloc.)</returns>
 factorizedString* receivePrimeFactorizedListString(DWORD number);
+/// <summary>
+/// Description - This function solves a task exactly as receivePrimeFactorizedListString(.) does (the same string), either by trial division
+///		or by Pollard's rho, while polling the cancellation token - the solving stops as soon as the token's watched value changes.
+/// </summary>
+/// <param name="DWORD number - An unsgined integer representing a task's value"></param>
+/// <param name="BOOL usePollardRho - TRUE to split the number with Pollard's rho (& Miller-Rabin primality tests) instead of trial division"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token polled while solving (NULL - never cancelled)"></param>
+/// <returns>A pointer to a 'factorizedString' containing the solution of the inputted task if successful, or NULL if cancelled (isCancellationRequested(.)) or failed</returns>
+factorizedString* receiveCancelablePrimeFactorizedListString(DWORD number, BOOL usePollardRho, cancellationToken* p_cancellationToken);
+/// <summary>
+/// Description - This function checks whether the token's watched value changed, i.e. whether the solution is no longer wanted.
+/// </summary>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to a cancellation token (NULL - never cancelled)"></param>
+/// <returns>TRUE if the solving should be cancelled, FALSE otherwise</returns>
+BOOL isCancellationRequested(cancellationToken* p_cancellationToken);
 
 
 #endif //__RECEIVE_PRIME_FACTORIZED_LIST_STRING_H__
@@ -0,0 +1,246 @@
+/* ReorderBuffer.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling a reorder
+		buffer: the threads solve tasks out of order, & the solutions are written to
+		the Tasks file in priority order through a bounded window
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "ReorderBuffer.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const BOOL  INITIALLY_NOT_OWNED = FALSE;
+static const BOOL  AUTO_RESET_EVENT = FALSE;
+static const BOOL  INITIALLY_NON_SIGNALLED = FALSE;
+static const BOOL  RELEASE_SYNCHRONOUS_OBJECT_FAILED = 0;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function waits for the ownership of the reorder buffer's mutex.
+/// </summary>
+/// <param name="reorderBuffer* p_reorderBuffer - A pointer to a reorderBuffer struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. an abandoned mutex</returns>
+static BOOL lockReorderBuffer(reorderBuffer* p_reorderBuffer);
+/// <summary>
+///  Description - This function releases the ownership of the reorder buffer's mutex.
+/// </summary>
+/// <param name="reorderBuffer* p_reorderBuffer - A pointer to a reorderBuffer struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL releaseReorderBuffer(reorderBuffer* p_reorderBuffer);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+reorderBuffer* buildReorderBuffer(DWORDLONG windowSize, DWORD numberOfThreads)
+{
+	reorderBuffer* p_reorderBuffer = NULL;
+	DWORD waiterIndex = 0;
+	//Input integrity validation
+	if ((0 == windowSize) || (0 == numberOfThreads)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the buffer, its' slots & its' synchronous objects' handles
+	if ((NULL == (p_reorderBuffer = (reorderBuffer*)calloc(sizeof(reorderBuffer), SINGLE_OBJECT))) ||
+		(NULL == (p_reorderBuffer->p_slots = (reorderedResult*)calloc(sizeof(reorderedResult), (size_t)windowSize))) ||
+		(NULL == (p_reorderBuffer->p_h_reorderMutex = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT))) ||
+		(NULL == (p_reorderBuffer->p_waiters = (reorderWaiter*)calloc(sizeof(reorderWaiter), numberOfThreads)))) {
+		printf("Error: Failed to allocate memory for the reorder buffer.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		destroyReorderBuffer(&p_reorderBuffer);
+		return NULL;
+	}
+	p_reorderBuffer->windowSize = windowSize;
+	p_reorderBuffer->numberOfWaiters = numberOfThreads;
+
+	//Creating the mutex guarding the buffer & every waiter entry's event
+	if (NULL == (*(p_reorderBuffer->p_h_reorderMutex) = CreateMutex(NULL, INITIALLY_NOT_OWNED, NULL))) {
+		printf("Error: Failed to create the reorder buffer's mutex with code: %d.\n", GetLastError());
+		destroyReorderBuffer(&p_reorderBuffer);
+		return NULL;
+	}
+	for (waiterIndex = 0; waiterIndex < numberOfThreads; waiterIndex++) {
+		if (NULL == ((p_reorderBuffer->p_waiters + waiterIndex)->h_wakeUpEvent = CreateEvent(NULL, AUTO_RESET_EVENT, INITIALLY_NON_SIGNALLED, NULL))) {
+			printf("Error: Failed to create the reorder buffer's waiters' events with code: %d.\n", GetLastError());
+			destroyReorderBuffer(&p_reorderBuffer);
+			return NULL;
+		}
+	}
+
+	return p_reorderBuffer;
+}
+
+BOOL depositReorderedResult(reorderBuffer* p_reorderBuffer, DWORDLONG sequence, factorizedString* p_solution, DWORDLONG numberOfOccurrences)
+{
+	reorderedResult* p_slot = NULL;
+	reorderWaiter* p_waiter = NULL;
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_reorderBuffer) || (NULL == p_solution)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+	//------------------locked
+
+	//Waiting while the position is beyond the window - the thread takes a vacant waiter entry (a thread takes one at most) with the position,
+	// & the drainer signals the entry's event once the window reaches it. The event keeps the signal until waited on, & the entry isn't
+	// handed to another thread before its' owner woke up - no wake-up is lost or taken by another thread
+	while (sequence >= p_reorderBuffer->nextSequence + p_reorderBuffer->windowSize) {
+		for (p_waiter = p_reorderBuffer->p_waiters; TRUE == p_waiter->taken; p_waiter++);
+		p_waiter->taken = TRUE;
+		p_waiter->waiting = TRUE;
+		p_waiter->sequence = sequence;
+		p_reorderBuffer->numberOfStalls++;
+		if (STATUS_CODE_SUCCESS != releaseReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+		if (WAIT_OBJECT_0 != WaitForSingleObject(p_waiter->h_wakeUpEvent, INFINITE)) {
+			printf("Error: Thread no. %lu failed waiting for the reorder window with code: %d.\n", (unsigned long)GetCurrentThreadId(), GetLastError());
+			return STATUS_CODE_FAILURE;
+		}
+		if (STATUS_CODE_SUCCESS != lockReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+		p_waiter->taken = FALSE;
+	}
+
+	//Placing the solution in its' slot
+	p_slot = p_reorderBuffer->p_slots + sequence % p_reorderBuffer->windowSize;
+	p_slot->p_solution = p_solution;
+	p_slot->numberOfOccurrences = numberOfOccurrences;
+	if (++(p_reorderBuffer->numberOfBufferedResults) > p_reorderBuffer->maximalBufferedResults)
+		p_reorderBuffer->maximalBufferedResults = p_reorderBuffer->numberOfBufferedResults;
+
+	//The next solution to write, with no thread writing - this thread drains
+	if ((sequence == p_reorderBuffer->nextSequence) && (FALSE == p_reorderBuffer->draining)) {
+		p_reorderBuffer->draining = TRUE;
+		retVal = REORDER_BUFFER_DRAIN;
+	}
+
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+	return retVal;
+}
+
+BOOL takeNextReorderedResult(reorderBuffer* p_reorderBuffer, reorderedResult* p_result)
+{
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_reorderBuffer) || (NULL == p_result)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+	//------------------locked
+	*p_result = *(p_reorderBuffer->p_slots + p_reorderBuffer->nextSequence % p_reorderBuffer->windowSize);
+	//Not ready yet - whoever deposits it will drain
+	if (NULL == p_result->p_solution) {
+		p_reorderBuffer->draining = FALSE;
+		retVal = REORDER_BUFFER_DRAINED;
+	}
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+	return retVal;
+}
+
+BOOL advanceReorderWindow(reorderBuffer* p_reorderBuffer)
+{
+	reorderedResult* p_slot = NULL;
+	factorizedString* p_writtenSolution = NULL;
+	DWORD waiterIndex = 0;
+	//Input integrity validation
+	if (NULL == p_reorderBuffer) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+	//------------------locked
+	p_slot = p_reorderBuffer->p_slots + p_reorderBuffer->nextSequence % p_reorderBuffer->windowSize;
+	p_writtenSolution = p_slot->p_solution;
+	p_slot->p_solution = NULL;
+	p_reorderBuffer->numberOfBufferedResults--;
+
+	p_reorderBuffer->nextSequence++;
+
+	//Waking the blocked thread whose position the window reached (the one a window past the written solution)
+	for (waiterIndex = 0; waiterIndex < p_reorderBuffer->numberOfWaiters; waiterIndex++) {
+		if ((FALSE == (p_reorderBuffer->p_waiters + waiterIndex)->waiting) ||
+			((p_reorderBuffer->p_waiters + waiterIndex)->sequence >= p_reorderBuffer->nextSequence + p_reorderBuffer->windowSize)) continue;
+		(p_reorderBuffer->p_waiters + waiterIndex)->waiting = FALSE;
+		if (FALSE == SetEvent((p_reorderBuffer->p_waiters + waiterIndex)->h_wakeUpEvent))
+			printf("Error: Failed to wake a thread blocked beyond the reorder window with code: %d.\n", GetLastError());
+	}
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseReorderBuffer(p_reorderBuffer)) return STATUS_CODE_FAILURE;
+
+	freeTheString(p_writtenSolution);
+	return STATUS_CODE_SUCCESS;
+}
+
+void destroyReorderBuffer(reorderBuffer** p_p_reorderBuffer)
+{
+	DWORDLONG slotIndex = 0;
+	DWORD waiterIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_p_reorderBuffer) || (NULL == *p_p_reorderBuffer)) return;
+
+	//Free the solutions that were never written (a thread failed), the slots, the synchronous objects & the buffer (a failed build leaves NULL handles)
+	if (NULL != (*p_p_reorderBuffer)->p_slots)
+		for (slotIndex = 0; slotIndex < (*p_p_reorderBuffer)->windowSize; slotIndex++)
+			if (NULL != ((*p_p_reorderBuffer)->p_slots + slotIndex)->p_solution) freeTheString(((*p_p_reorderBuffer)->p_slots + slotIndex)->p_solution);
+	free((*p_p_reorderBuffer)->p_slots);
+	if ((NULL != (*p_p_reorderBuffer)->p_h_reorderMutex) && (NULL != *((*p_p_reorderBuffer)->p_h_reorderMutex)))
+		closeHandleProcedure((*p_p_reorderBuffer)->p_h_reorderMutex);
+	else free((*p_p_reorderBuffer)->p_h_reorderMutex);
+	if (NULL != (*p_p_reorderBuffer)->p_waiters)
+		for (waiterIndex = 0; waiterIndex < (*p_p_reorderBuffer)->numberOfWaiters; waiterIndex++)
+			if (NULL != ((*p_p_reorderBuffer)->p_waiters + waiterIndex)->h_wakeUpEvent) CloseHandle(((*p_p_reorderBuffer)->p_waiters + waiterIndex)->h_wakeUpEvent);
+	free((*p_p_reorderBuffer)->p_waiters);
+	free(*p_p_reorderBuffer);
+	*p_p_reorderBuffer = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static BOOL lockReorderBuffer(reorderBuffer* p_reorderBuffer)
+{
+	//Assert
+	assert(NULL != p_reorderBuffer);
+
+	if (WAIT_OBJECT_0 != WaitForSingleObject(*(p_reorderBuffer->p_h_reorderMutex), INFINITE)) {
+		printf("Error: Thread no. %lu failed to own the reorder buffer's mutex with code: %d.\n", (unsigned long)GetCurrentThreadId(), GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL releaseReorderBuffer(reorderBuffer* p_reorderBuffer)
+{
+	//Assert
+	assert(NULL != p_reorderBuffer);
+
+	if (RELEASE_SYNCHRONOUS_OBJECT_FAILED == ReleaseMutex(*(p_reorderBuffer->p_h_reorderMutex))) {
+		printf("Error: Thread no. %lu failed to release the reorder buffer's mutex with code: %d.\n", (unsigned long)GetCurrentThreadId(), GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
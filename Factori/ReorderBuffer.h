@@ -0,0 +1,69 @@
+/* ReorderBuffer.h
+----------------------------------------------------------
+	Module Description - header module for ReorderBuffer.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __REORDER_BUFFER_H__
+#define __REORDER_BUFFER_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MemoryHandling.h"
+
+
+// Constants ---------------------------------------------------
+#define REORDER_BUFFER_DRAIN 2			// depositReorderedResult(.)'s outcome when the depositing thread became the drainer (it must write the ready solutions)
+#define REORDER_BUFFER_DRAINED 3		// takeNextReorderedResult(.)'s outcome when the next solution isn't ready - the thread is no longer the drainer
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds a reorder buffer with a window of 'windowSize' solutions, beginning at position 0.
+/// </summary>
+/// <param name="DWORDLONG windowSize - The furthest a solution may get ahead of the next solution to write (at least 1)"></param>
+/// <param name="DWORD numberOfThreads - The number of threads that may wait for the window to advance at once"></param>
+/// <returns>A pointer to a dynamically allocated 'reorderBuffer' struct if successful, or NULL if failed</returns>
+reorderBuffer* buildReorderBuffer(DWORDLONG windowSize, DWORD numberOfThreads);
+/// <summary>
+///	 Description - This function deposits a solved task's solution at its' position. While the position is beyond the window, the thread
+///		waits on its' own event until the window reaches the position. If the solution is the next one to write & no thread is writing, the depositing thread becomes the
+///		drainer & must write the ready solutions (takeNextReorderedResult(.) & advanceReorderWindow(.)) until none is ready.
+/// </summary>
+/// <param name="reorderBuffer* p_reorderBuffer - A pointer to a reorderBuffer struct"></param>
+/// <param name="DWORDLONG sequence - The solved task's position (dispatch order)"></param>
+/// <param name="factorizedString* p_solution - A pointer to the task's solution (owned by the buffer from now on)"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the solution is written"></param>
+/// <returns>Deposited (TRUE), deposited & the thread must drain (REORDER_BUFFER_DRAIN) or Failure (FALSE)</returns>
+BOOL depositReorderedResult(reorderBuffer* p_reorderBuffer, DWORDLONG sequence, factorizedString* p_solution, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function hands the drainer the next solution to write, if it is ready. Otherwise, the thread stops draining (the
+///		thread depositing the next solution will drain).
+/// </summary>
+/// <param name="reorderBuffer* p_reorderBuffer - A pointer to a reorderBuffer struct"></param>
+/// <param name="reorderedResult* p_result - A pointer to the struct that will be updated with the next solution (still owned by the buffer)"></param>
+/// <returns>A solution is ready (TRUE), no solution is ready (REORDER_BUFFER_DRAINED) or Failure (FALSE)</returns>
+BOOL takeNextReorderedResult(reorderBuffer* p_reorderBuffer, reorderedResult* p_result);
+/// <summary>
+///	 Description - This function advances the window past the solution the drainer has written: it frees the solution, vacates its' slot &
+///		wakes the blocked thread whose position the window reached.
+/// </summary>
+/// <param name="reorderBuffer* p_reorderBuffer - A pointer to a reorderBuffer struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL advanceReorderWindow(reorderBuffer* p_reorderBuffer);
+/// <summary>
+///	 Description - This function frees a reorder buffer with any solutions left in it, closes its' synchronous objects & sets its' pointer to NULL.
+/// </summary>
+/// <param name="reorderBuffer** p_p_reorderBuffer - A pointer to a pointer to a 'reorderBuffer' struct"></param>
+void destroyReorderBuffer(reorderBuffer** p_p_reorderBuffer);
+
+
+#endif //__REORDER_BUFFER_H__
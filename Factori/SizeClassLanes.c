@@ -0,0 +1,243 @@
+/* SizeClassLanes.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for dispatching the
+		positions of the priority order from size-class lanes: the tasks are split by
+		their magnitude (# of decimal digits) into lanes, each lane has a reserved
+		share of the workers, and a worker whose lane is empty borrows from the other
+		lanes - so the cheap tasks aren't blocked behind the expensive ones.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "SizeClassLanes.h"
+#include "DeadlineScheduling.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORD     DECIMAL_BASE = 10;
+static const double    MICROSECONDS_PER_MILLISECOND = 1000.0;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function counts a task's decimal digits (0 has a single digit).
+/// </summary>
+/// <param name="DWORDLONG value - The task's value"></param>
+/// <returns>The # of the value's decimal digits</returns>
+static DWORD countDecimalDigits(DWORDLONG value);
+/// <summary>
+///  Description - This function claims the next position of a lane & records the claimed task's start delay.
+/// </summary>
+/// <param name="sizeClassLanes* p_lanes - A pointer to a sizeClassLanes struct"></param>
+/// <param name="sizeClassLane* p_lane - A pointer to the lane to claim from"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the claimed position"></param>
+/// <returns>TRUE if a position was claimed, or FALSE if the lane is empty</returns>
+static BOOL claimLanePosition(sizeClassLanes* p_lanes, sizeClassLane* p_lane, PDWORDLONG p_position);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+BOOL buildSizeClassLanes(threadPackage* p_params, const int* p_digitsBounds, DWORD numberOfBounds, const int* p_shares, DWORD numberOfThreads)
+{
+	sizeClassLanes* p_lanes = NULL;
+	PDWORDLONG p_values = NULL;
+	DWORDLONG position = 0;
+	DWORD laneIndex = 0, numberOfDigits = 0;
+	//Input integrity validation
+	if ((NULL == p_params) || (MAX_SIZE_CLASS_LANES <= numberOfBounds) || ((0 < numberOfBounds) && (NULL == p_digitsBounds))) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Fetching all the tasks' values in priority order (before the lanes exist) - the positions cursor (and its' counters) is rewound
+	if (NULL == (p_values = fetchAllTasksInPriorityOrder(p_params))) return STATUS_CODE_FAILURE;
+	p_params->nextTaskPosition = 0;
+	memset((void*)p_params->chunkSizesHistogram, 0, sizeof(p_params->chunkSizesHistogram));
+
+	//Memory allocation for the lanes
+	if (NULL == (p_params->p_sizeClassLanes = p_lanes = (sizeClassLanes*)calloc(sizeof(sizeClassLanes), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for the size-class lanes.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_values);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Every lane's size class & reserved workers (by default a worker per lane while workers remain, cheapest lane first - the rest of
+	// the lanes reserve none, & their tasks are borrowed)
+	p_lanes->numberOfLanes = numberOfBounds + 1;
+	for (laneIndex = 0; laneIndex < p_lanes->numberOfLanes; laneIndex++) {
+		p_lanes->lanes[laneIndex].maximalNumberOfDigits = (laneIndex < numberOfBounds) ? (DWORD)p_digitsBounds[laneIndex] : MAXDWORD;
+		if (NULL != p_shares) p_lanes->lanes[laneIndex].numberOfReservedWorkers = (DWORD)p_shares[laneIndex];
+		else p_lanes->lanes[laneIndex].numberOfReservedWorkers = (p_lanes->numberOfReservedWorkers < numberOfThreads) ? 1 : 0;
+		p_lanes->numberOfReservedWorkers += p_lanes->lanes[laneIndex].numberOfReservedWorkers;
+	}
+	//Explicit shares must fit in the threads
+	if (p_lanes->numberOfReservedWorkers > numberOfThreads) {
+		printf("Error: The size-class lanes reserve %lu workers, but only %lu threads solve the tasks.\n", (unsigned long)p_lanes->numberOfReservedWorkers, (unsigned long)numberOfThreads);
+		free(p_values);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Memory allocation for the lanes' positions (a lane may hold every position)
+	for (laneIndex = 0; laneIndex < p_lanes->numberOfLanes; laneIndex++) {
+		if (NULL == (p_lanes->lanes[laneIndex].p_positions = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)p_params->numberOfTasks + 1))) {
+			printf("Error: Failed to allocate memory for a size-class lane's positions.\n");
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			free(p_values);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Appending every position to its' task's lane - the lanes keep the priority order
+	for (position = 0; position < p_params->numberOfTasks; position++) {
+		numberOfDigits = countDecimalDigits(p_values[position]);
+		for (laneIndex = 0; numberOfDigits > p_lanes->lanes[laneIndex].maximalNumberOfDigits; laneIndex++);
+		p_lanes->lanes[laneIndex].p_positions[p_lanes->lanes[laneIndex].numberOfPositions++] = position;
+	}
+	free(p_values);
+
+	printf("Size-class lanes built: %lu lanes, %lu reserved workers.\n", (unsigned long)p_lanes->numberOfLanes, (unsigned long)p_lanes->numberOfReservedWorkers);
+	return STATUS_CODE_SUCCESS;
+}
+
+void startSizeClassLanesClock(sizeClassLanes* p_lanes)
+{
+	//Input integrity validation
+	if (NULL == p_lanes) return;
+
+	QueryPerformanceFrequency(&(p_lanes->counterFrequency));
+	QueryPerformanceCounter(&(p_lanes->startCounter));
+}
+
+BOOL registerSizeClassLaneWorker(sizeClassLanes* p_lanes, taskPositionsRange* p_dispatchState)
+{
+	DWORD workerIndex = 0, laneIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_lanes) || (NULL == p_dispatchState)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The workers take the lanes' shares in registration order - the first shares go to the cheapest lane
+	workerIndex = (DWORD)InterlockedIncrement(&(p_lanes->numberOfRegisteredWorkers)) - 1;
+	p_dispatchState->laneIndex = SIZE_CLASS_LANE_NONE;
+	for (laneIndex = 0; laneIndex < p_lanes->numberOfLanes; laneIndex++) {
+		if (workerIndex < p_lanes->lanes[laneIndex].numberOfReservedWorkers) {
+			p_dispatchState->laneIndex = laneIndex;
+			break;
+		}
+		workerIndex -= p_lanes->lanes[laneIndex].numberOfReservedWorkers;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL takeSizeClassLanePosition(sizeClassLanes* p_lanes, taskPositionsRange* p_dispatchState, PDWORDLONG p_position)
+{
+	DWORD laneIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_lanes) || (NULL == p_dispatchState) || (NULL == p_position)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The home lane first - its' reserved workers never wait behind other lanes' tasks
+	if ((SIZE_CLASS_LANE_NONE != p_dispatchState->laneIndex) && (TRUE == claimLanePosition(p_lanes, p_lanes->lanes + p_dispatchState->laneIndex, p_position)))
+		return STATUS_CODE_SUCCESS;
+
+	//Borrowing from the other lanes, cheapest first (the lanes aren't refilled - an empty lane stays empty)
+	for (laneIndex = 0; laneIndex < p_lanes->numberOfLanes; laneIndex++) {
+		if (laneIndex == p_dispatchState->laneIndex) continue;
+		if (TRUE == claimLanePosition(p_lanes, p_lanes->lanes + laneIndex, p_position)) {
+			InterlockedIncrement(&(p_lanes->lanes[laneIndex].numberOfBorrowedTasks));
+			return STATUS_CODE_SUCCESS;
+		}
+	}
+	return SIZE_CLASS_LANES_EXHAUSTED;
+}
+
+void printSizeClassLanesReport(sizeClassLanes* p_lanes)
+{
+	DWORD laneIndex = 0;
+	sizeClassLane* p_lane = NULL;
+	//Input integrity validation
+	if (NULL == p_lanes) return;
+
+	printf("Size-class lanes (start delays since solving began):\n");
+	for (laneIndex = 0; laneIndex < p_lanes->numberOfLanes; laneIndex++) {
+		p_lane = p_lanes->lanes + laneIndex;
+		if (MAXDWORD == p_lane->maximalNumberOfDigits) printf("\tLane %lu (any digits):", (unsigned long)laneIndex);
+		else printf("\tLane %lu (up to %lu digits):", (unsigned long)laneIndex, (unsigned long)p_lane->maximalNumberOfDigits);
+		printf(" %lu reserved workers, %llu tasks, %ld borrowed", (unsigned long)p_lane->numberOfReservedWorkers, p_lane->numberOfPositions, (long)p_lane->numberOfBorrowedTasks);
+		if (0 < p_lane->numberOfPositions)
+			printf(", average start delay %.3f ms, maximal %.3f ms", (double)p_lane->totalStartDelay / (LONGLONG)p_lane->numberOfPositions / MICROSECONDS_PER_MILLISECOND,
+				(double)p_lane->maximalStartDelay / MICROSECONDS_PER_MILLISECOND);
+		printf("\n");
+	}
+	printf("\n");
+}
+
+void destroySizeClassLanes(sizeClassLanes** p_p_lanes)
+{
+	DWORD laneIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_p_lanes) || (NULL == *p_p_lanes)) return;
+
+	//Free the lanes' positions (a failed build leaves some of them NULL) & the struct
+	for (laneIndex = 0; laneIndex < MAX_SIZE_CLASS_LANES; laneIndex++) free((*p_p_lanes)->lanes[laneIndex].p_positions);
+	free(*p_p_lanes);
+	*p_p_lanes = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static DWORD countDecimalDigits(DWORDLONG value)
+{
+	DWORD numberOfDigits = 1;
+
+	while (DECIMAL_BASE <= value) {
+		value /= DECIMAL_BASE;
+		numberOfDigits++;
+	}
+	return numberOfDigits;
+}
+
+static BOOL claimLanePosition(sizeClassLanes* p_lanes, sizeClassLane* p_lane, PDWORDLONG p_position)
+{
+	LARGE_INTEGER now;
+	LONGLONG claimedIndex = 0, startDelay = 0, maximalStartDelay = 0;
+	//Asserts
+	assert(NULL != p_lanes);
+	assert(NULL != p_lane);
+	assert(NULL != p_position);
+
+	//A single atomic fetch-and-add claims a position (the cursor keeps growing past the end by one per claim - harmless)
+	if ((DWORDLONG)(claimedIndex = InterlockedExchangeAdd64(&(p_lane->nextPosition), 1)) >= p_lane->numberOfPositions) return FALSE;
+	*p_position = p_lane->p_positions[claimedIndex];
+
+	//The task's start delay
+	QueryPerformanceCounter(&now);
+	startDelay = counterTicksToMicroseconds(now.QuadPart - p_lanes->startCounter.QuadPart, p_lanes->counterFrequency.QuadPart);
+	InterlockedExchangeAdd64(&(p_lane->totalStartDelay), startDelay);
+	do {
+		maximalStartDelay = InterlockedCompareExchange64(&(p_lane->maximalStartDelay), 0, 0); //Atomic 64-bit read (also on 32-bit builds)
+		if (startDelay <= maximalStartDelay) break;
+	} while (maximalStartDelay != InterlockedCompareExchange64(&(p_lane->maximalStartDelay), startDelay, maximalStartDelay));
+	return TRUE;
+}
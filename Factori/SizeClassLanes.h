@@ -0,0 +1,74 @@
+/* SizeClassLanes.h
+----------------------------------------------------------
+	Module Description - header module for SizeClassLanes.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __SIZE_CLASS_LANES_H__
+#define __SIZE_CLASS_LANES_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "TasksSolverThread.h"
+
+
+// Constants ---------------------------------------------------
+#define SIZE_CLASS_LANES_EXHAUSTED 2		// takeSizeClassLanePosition(.)'s outcome when no lane has positions left to claim
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the size-class lanes: it fetches the values of all the tasks to solve (the cursor is rewound
+///		afterwards) & appends every position, in priority order, to the lane of its' task's # of decimal digits. Workers are reserved to the
+///		lanes by their shares, in the order the workers register.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <param name="const int* p_digitsBounds - A pointer to the most decimal digits of every lane but the last (strictly ascending)"></param>
+/// <param name="DWORD numberOfBounds - The number of bounds (# of lanes - 1)"></param>
+/// <param name="const int* p_shares - A pointer to the # of workers reserved to every lane (NULL - a single worker per lane, while workers remain)"></param>
+/// <param name="DWORD numberOfThreads - The number of threads that will solve the tasks (at least the sum of the shares)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL buildSizeClassLanes(threadPackage* p_params, const int* p_digitsBounds, DWORD numberOfBounds, const int* p_shares, DWORD numberOfThreads);
+/// <summary>
+///	 Description - This function starts the size-class lanes' clock - the tasks' start delays are measured from this moment.
+/// </summary>
+/// <param name="sizeClassLanes* p_lanes - A pointer to a sizeClassLanes struct (NULL - nothing is done)"></param>
+void startSizeClassLanesClock(sizeClassLanes* p_lanes);
+/// <summary>
+///	 Description - This function hands a starting thread its' home lane: the lane whose reserved share the thread's registration falls in,
+///		or none (a floating worker) once all the shares were taken.
+/// </summary>
+/// <param name="sizeClassLanes* p_lanes - A pointer to a sizeClassLanes struct"></param>
+/// <param name="taskPositionsRange* p_dispatchState - A pointer to the thread's private dispatch state"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL registerSizeClassLaneWorker(sizeClassLanes* p_lanes, taskPositionsRange* p_dispatchState);
+/// <summary>
+///	 Description - This function claims the next position for a thread: from its' home lane, and once it is empty, borrowed from the other
+///		lanes, cheapest lane first. Every claim is a single atomic fetch-and-add on the lane's cursor.
+/// </summary>
+/// <param name="sizeClassLanes* p_lanes - A pointer to a sizeClassLanes struct"></param>
+/// <param name="taskPositionsRange* p_dispatchState - A pointer to the thread's private dispatch state (registered)"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the claimed position"></param>
+/// <returns>Success (TRUE), SIZE_CLASS_LANES_EXHAUSTED if all the lanes' positions were claimed, or Failure (FALSE)</returns>
+BOOL takeSizeClassLanePosition(sizeClassLanes* p_lanes, taskPositionsRange* p_dispatchState, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function prints every lane's size class, reserved workers, tasks, borrowed tasks & its' tasks' start delays.
+/// </summary>
+/// <param name="sizeClassLanes* p_lanes - A pointer to a sizeClassLanes struct (NULL - nothing is printed)"></param>
+void printSizeClassLanesReport(sizeClassLanes* p_lanes);
+/// <summary>
+///	 Description - This function frees the size-class lanes with their positions and sets its' pointer to NULL.
+/// </summary>
+/// <param name="sizeClassLanes** p_p_lanes - A pointer to a pointer to a 'sizeClassLanes' struct"></param>
+void destroySizeClassLanes(sizeClassLanes** p_p_lanes);
+
+
+#endif //__SIZE_CLASS_LANES_H__
@@ -30,14 +30,10 @@ static const DWORD SINGLE_OBJECT = 1;
 
 static const BOOL STATUS_FILE_READING_FAILED = (BOOL)0;
 
-static const BOOL WRITERS_ONLY = 1;
+static const DWORD NUMBER_OF_LOCKS = 2;		//The Tasks file lock & the Priorities Queue lock
 
 static const int   DEFAULT_THREAD_STACK_SIZE = 0;
 
-	//WaitForMultipleObjects
-static const BOOL  WAIT_FOR_ALL_OBJECTS = TRUE;
-static const DWORD TIMEOUT_BASE_CONSTANT_MS = 10; //10 milli-seconds
-
 	//Recive exit codes
 static const BOOL  GET_EXIT_CODE_FAILURE = 0;
 static const BOOL  THREAD_PROCESSED_SUCCESSFULY = TRUE;
@@ -65,16 +61,15 @@ static HANDLE* openTasksPrioritiesFileForReading(char* p_filePath);
 /// <returns>A pointer to a filled Queue struct with no. of  "cell"s equals #Tasks, each holds a task's initial byte-position within the Tasks file, if successful, or NULL if failed</returns>
 static queue* buildTasksPrioritiesQueue(char* p_tasksPrioritiesListFilePath, file* p_tasksPrioritiesFileData, int numberOfTasks);
 /// <summary>
-///	 Description - This function creates all of a resource's lock's Synchronous Objects by firstly allocating memory (on the Heap) for every Handle to every object,
-///		and then, creates the objects with CreateMutex and CreateSemaphore WINAPI functions and attaches them to the their Handles. 
-///		Also the function makes a descision based on the a Writers-ONLY flag indicating whether the resource will be accessed only by Writers (In the case
-///		of the resource accessed by Readers only, the resource WOULDN'T NEED A LOCK) - If the bit is '1', then only a Turnstile Mutex is created and attached
-///		to a Handle pointed to by the Turnstil Mutex handle pointer field in the lock struct. 
+///	 Description - This function constructs the Tasks Priorities "queue" struct without framing the Tasks Priorities list file: the file is
+///		mapped to a read-only view & only its' first 'numberOfTasks' lines are parsed, one after the other, so the cost is proportional to
+///		the number of tasks rather than to the file's size. As in the framed construction, if the file has fewer lines than tasks, the last
+///		line's byte-offset is pushed for the remaining tasks.
 /// </summary>
-/// <param name="lock* p_lock - A pointer to 'lock' struct"></param>
-/// <param name="int writersOnlyFlag - An integer indicating whether the resource associated with the lock is a Writers-ONLY resource or not"></param>
-/// <returns>A BOOL value representing the function's outcome (Lock struct's fields were updated with Synchronous objects). Success (TRUE) or Failure (FALSE)</returns>
-static BOOL createSynchronousObjects(lock* p_lock, int writersOnlyFlag);
+/// <param name="char* p_tasksPrioritiesListFilePath - A pointer to the commandline argument (string) that represents the Tasks Priorities list file's path (absolute\relative)"></param>
+/// <param name="int numberOfTasks - An integer that represents the number of tasks the program needs to solve"></param>
+/// <returns>A pointer to a filled Queue struct with no. of  "cell"s equals #Tasks, each holds a task's initial byte-position within the Tasks file, if successful, or NULL if failed</returns>
+static queue* buildTasksPrioritiesQueueLazily(char* p_tasksPrioritiesListFilePath, int numberOfTasks);
 /// <summary>
 ///  Description - This function allocates memory (on the Heap) for a "threadPackage" struct that contains pointers to all relevant resources and pointers to these
 ///		resources' locks. It also allocates memory for these "lock"s structs. This function updates all relevant fields of the "threadPackage" struct with the input
@@ -84,11 +79,13 @@ static BOOL createSynchronousObjects(lock* p_lock, int writersOnlyFlag);
 /// <param name="char* p_tasksListFilePath - A pointer to the commandline argument (string) that represents the Tasks list file's path (absolute\relative)"></param>
 /// <param name="p_tasksPrioritiesQueue"></param>
 /// <param name="p_tasksFileData"></param>
+/// <param name="tasksContainer* p_tasksContainer - A pointer to a loaded tasks container, or NULL when solving from the text files (Queue & file data)"></param>
+/// <param name="mappedFile* p_mappedTasksFile - A pointer to a mapped view of the Tasks list file that replaces the file data (lazy subset mode), or NULL"></param>
 /// <param name="int numberOfTasks - An integer that represents the number of tasks the program needs to solve"></param>
 /// <param name="int numberOfThreads - An integer that represents the number of threads the program will use for the tasks solving procedure."></param>
 /// <returns>A pointer to a filled "threadPackage" struct, if successful, or NULL if failed</returns>
 static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePath, queue* p_tasksPrioritiesQueue,
-	file* p_tasksFileData, int numberOfTasks, int numberOfThreads);
+	file* p_tasksFileData, tasksContainer* p_tasksContainer, mappedFile* p_mappedTasksFile, int numberOfTasks, int numberOfThreads);
 /// <summary>
 /// Description - This function creates a new thread and attaches a Handle to it. It channels the thread a unique "threadPackage" struct
 ///		and a unique ID from the threadIds array.The threads are set to have a default stack size(code - 0)
@@ -100,22 +97,32 @@ static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePat
 /// <returns>A Handle to the thread if successful, or NULL if failed (validated outside of this function)</returns>
 static HANDLE createThreadSimple(LPTHREAD_START_ROUTINE p_startRoutine, LPVOID p_threadParameters, LPDWORD p_threadId);
 /// <summary>
-///  Description - This function receives a pointer to a Handles array and activates WaitForMultipleObjects. It validates
-///		whether all threads terminated on time(According to the time cap), or if anything else failed.
+///  Description - This function fetches the values of all the tasks to solve (exhausting the Queue or the container's cursor) and
+///		replaces them in the threads' parameters struct with the distinct tasks, which the threads dispatch instead.
 /// </summary>
-/// <param name="HANDLE* p_threadHandles - A pointer the threads Handles array."></param>
-/// <param name="int numberOfThreads - The number of threads that will assist in calculating the waiting timeout"></param>
-/// <param name="int numberOfTasks - An integer that represents the number of tasks that will assist in calculating the waiting timeout"></param>
-/// <returns>A BOOL value representing the function's outcome (wait code is WAIT_OBJECT_0). Success (TRUE) or Failure (FALSE)</returns>
-static BOOL validateThreadsWaitCode(HANDLE* p_threadHandles, int numberOfThreads, int numberOfTasks);
+/// <param name="threadPackage* p_allThreadsParam - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL deduplicateTasksBeforeSolving(threadPackage* p_allThreadsParam);
+/// <summary>
+///  Description - This function prints the number of chunks of positions claimed per chunk size bucket (guided batch claiming).
+/// </summary>
+/// <param name="threadPackage* p_allThreadsParam - A pointer to the threads' parameters struct (after all threads terminated)"></param>
+static void printChunkSizesHistogram(threadPackage* p_allThreadsParam);
+/// <summary>
+///  Description - This function returns the number of positions the threads dispatch: the distinct tasks (de-duplication), the
+///		container's tasks, or the Queue's cells.
+/// </summary>
+/// <param name="threadPackage* p_allThreadsParam - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <returns>The number of positions</returns>
+static DWORDLONG countTaskPositions(threadPackage* p_allThreadsParam);
 /// <summary>
 ///  Description - This function receives a pointer to a Handles array and validates whether the threads terminated
-///		on time(meaning, before WaitForMultipleObject's time cap reached) and that their exit codes are as expected of
+///		(meaning, the progress watchdog saw them all terminate, with no stall) and that their exit codes are as expected of
 /// 	threads that have completed successfuly their processing and printing operations of the Tasks they fetched.
 /// </summary>
 /// <param name="HANDLE* p_threadHandles - A pointer the threads Handles array."></param>
 /// <param name="int numberOfThreads - The number of threads is also the size of the Handles array"></param>
-/// <returns>A BOOL value representing the function's outcome (All exit codes are legitimate and all threads terminated on time). Success(TRUE) or Failure(FALSE) </returns>
+/// <returns>A BOOL value representing the function's outcome (All exit codes are legitimate and all threads terminated). Success(TRUE) or Failure(FALSE) </returns>
 static BOOL validateThreadsExitCodes(HANDLE* p_threadHandles, int numberOfThreads);
 
 
@@ -127,36 +134,54 @@ static BOOL validateThreadsExitCodes(HANDLE* p_threadHandles, int numberOfThread
 
 // Functions definitions ---------------------------------------------------------------
 
-BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, int numberOfTasks, int numberOfThreads)
+BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, int numberOfTasks, int numberOfThreads, solverOptions* p_options)
 {
-	file* p_tasksPrioritiesFileData, *p_tasksFileData;
-	queue* p_tasksPrioritiesQueue;
+	file* p_tasksPrioritiesFileData = NULL, *p_tasksFileData = NULL;
+	queue* p_tasksPrioritiesQueue = NULL;
+	tasksContainer* p_tasksContainer = NULL;
+	mappedFile* p_mappedTasksFile = NULL;
 	HANDLE* p_threadHandles = NULL; //for WaitForMultipleObjects this handle array should be a constant, but it's size can't be constant.... - evantually it works fine - don't know why!
 	LPDWORD p_threadIds = NULL;
 	threadPackage* p_allThreadsParam = NULL;
 	int th = 0;
+	BOOL feedRetVal = STATUS_CODE_SUCCESS;
 	//Input integrity validation
-	if ((NULL == p_tasksListFilePath) || (NULL == p_tasksPrioritiesListFilePath) || (0 > numberOfTasks) || (0 >= numberOfThreads)) { 
+	if ((NULL == p_tasksListFilePath) || (NULL == p_tasksPrioritiesListFilePath) || (0 > numberOfTasks) || (0 >= numberOfThreads) || (NULL == p_options)) { 
 		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
 	}
 	
-	//Frame the Tasks Priorities List file into lines structures of bytes boundries, named tasksPrioritiesFileStruct, by performing a single initial run
-	if (NULL == (p_tasksPrioritiesFileData = frameFileLines(p_tasksPrioritiesListFilePath)))  		return STATUS_CODE_FAILURE;
+	//A tasks container replaces both text files - it is mapped & the threads begin dispatching its' tasks immediately (no framing & no Queue)
+	if (TRUE == isTasksContainerFile(p_tasksListFilePath)) {
+		if (NULL == (p_tasksContainer = loadTasksContainer(p_tasksListFilePath, p_options->verifyContainerChecksum))) return STATUS_CODE_FAILURE;
+	}
+	//Lazy subset - only the prioritized lines are parsed from mapped views of the text files (no framing of either file)
+	else if (TRUE == p_options->lazySubset) {
+		if (NULL == (p_tasksPrioritiesQueue = buildTasksPrioritiesQueueLazily(p_tasksPrioritiesListFilePath, numberOfTasks))) return STATUS_CODE_FAILURE;
 
-	//Use tasksPrioritiesFileStruct to read all offsets into Queue (in later steps), or read one-by-one for step 1
-	if (NULL == (p_tasksPrioritiesQueue = buildTasksPrioritiesQueue(p_tasksPrioritiesListFilePath, p_tasksPrioritiesFileData, numberOfTasks))) return STATUS_CODE_FAILURE;
+		//Mapping the Tasks list file as it is before solving - the solutions appended by the threads are beyond the view
+		if (NULL == (p_mappedTasksFile = mapFileForReading(p_tasksListFilePath, 0))) { DestroyQueue(&p_tasksPrioritiesQueue); return STATUS_CODE_FAILURE; }
+	}
+	else {
+		//Frame the Tasks Priorities List file into lines structures of bytes boundries, named tasksPrioritiesFileStruct, by performing a single initial run
+		if (NULL == (p_tasksPrioritiesFileData = frameFileLines(p_tasksPrioritiesListFilePath, p_options->compressedLinesIndex, p_options->useLinesIndexCache)))  		return STATUS_CODE_FAILURE;
+
+		//Use tasksPrioritiesFileStruct to read all offsets into Queue (in later steps), or read one-by-one for step 1
+		if (NULL == (p_tasksPrioritiesQueue = buildTasksPrioritiesQueue(p_tasksPrioritiesListFilePath, p_tasksPrioritiesFileData, numberOfTasks))) return STATUS_CODE_FAILURE;
 
-	//Frame the Tasks List file into lines structures of bytes boundries, named tasksFileStruct, by performing a single initial run
-	if (NULL == (p_tasksFileData = frameFileLines(p_tasksListFilePath))) { DestroyQueue(&p_tasksPrioritiesQueue); return STATUS_CODE_FAILURE; }
+		//Frame the Tasks List file into lines structures of bytes boundries, named tasksFileStruct, by performing a single initial run
+		if (NULL == (p_tasksFileData = frameFileLines(p_tasksListFilePath, p_options->compressedLinesIndex, p_options->useLinesIndexCache))) { DestroyQueue(&p_tasksPrioritiesQueue); return STATUS_CODE_FAILURE; }
+	}
 
 
 	//Allocate memory for threads handles - #Handles = #Threads
 	if (NULL == (p_threadHandles = (HANDLE*)malloc(sizeof(HANDLE) * numberOfThreads))) {
 		printf("Error: Failed to allocate memory for a Handle array.\n");
 		printf("At file: %s\n at line number: %d\n at function: %s\n\n", __FILE__, __LINE__, __func__);
-		//Add cleanup for Queue & Tasks file Data struct
+		//Add cleanup for Queue & Tasks file Data struct (or the tasks container, or the Tasks file's view)
 		freeTheFile(p_tasksFileData);
-		DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksPrioritiesQueue) DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksContainer) unloadTasksContainer(&p_tasksContainer);
+		if (NULL != p_mappedTasksFile) unmapFile(&p_mappedTasksFile);
 		return STATUS_CODE_FAILURE;
 	}
 
@@ -165,9 +190,11 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 		printf("Error: Failed to allocate memory for a Handles' IDs.\n");
 		printf("At file: %s\n at line number: %d\n at function: %s\n\n", __FILE__, __LINE__, __func__);
 		free(p_threadHandles);
-		//Add cleanup for Queue & Tasks file Data struct
+		//Add cleanup for Queue & Tasks file Data struct (or the tasks container, or the Tasks file's view)
 		freeTheFile(p_tasksFileData);
-		DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksPrioritiesQueue) DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksContainer) unloadTasksContainer(&p_tasksContainer);
+		if (NULL != p_mappedTasksFile) unmapFile(&p_mappedTasksFile);
 		return STATUS_CODE_FAILURE;
 	}
 	
@@ -176,6 +203,8 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 		p_tasksListFilePath,				/* pointer to the Tasks list text file path */
 		p_tasksPrioritiesQueue,				/* pointer to the constructed Tasks Priorities Queue */
 		p_tasksFileData,					/* pointer to a file data struct describing the Tasks list file */
+		p_tasksContainer,					/* pointer to the mapped tasks container (replaces the Queue & the file data struct) */
+		p_mappedTasksFile,					/* pointer to the mapped Tasks list file (replaces the file data struct) */
 		numberOfTasks,						/* # Tasks to solve */
 		numberOfThreads						/* # Threads to use for solving tasks */
 	))) {
@@ -185,6 +214,156 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 		//Add cleanup for Queue & Tasks file Data struct -> Added inside
 		return STATUS_CODE_FAILURE;
 	}
+
+	//Guided batch claiming - runs of consecutive positions are claimed at once (single positions by default)
+	if (0 < p_options->minimalChunkSize) p_allThreadsParam->minimalChunkSize = (DWORDLONG)p_options->minimalChunkSize;
+	if (0 < p_options->maximalChunkSize) p_allThreadsParam->maximalChunkSize = (DWORDLONG)p_options->maximalChunkSize;
+
+	//Adaptive spinning - the locks' waiters spin briefly before parking, unless the host is oversubscribed
+	p_allThreadsParam->p_tasksFileLock->spinningDisabled = p_options->disableSpinning;
+	p_allThreadsParam->p_prioritiesQueueLock->spinningDisabled = p_options->disableSpinning;
+
+	//Locks profiling - only the profiled locks pay for the recording (an unprofiled lock checks a NULL pointer)
+	if (NULL != p_options->p_lockProfilePath) {
+		if ((STATUS_CODE_FAILURE == enableLockProfiling(p_allThreadsParam->p_tasksFileLock)) ||
+			(STATUS_CODE_FAILURE == enableLockProfiling(p_allThreadsParam->p_prioritiesQueueLock))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Progress watchdog - the waits have no time cap, the solving is failed only once no task is completed within the stall window
+	if (STATUS_CODE_FAILURE == createProgressWatchdog(p_allThreadsParam, (DWORD)numberOfThreads, (DWORD)p_options->stallWindowSeconds)) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		freeTheThreadPackage(p_allThreadsParam);
+		free(p_threadHandles);
+		free(p_threadIds);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//De-duplication - all tasks are fetched up front & grouped by value, so the threads solve every distinct value once
+	if (TRUE == p_options->deduplicateTasks) {
+		if (STATUS_CODE_FAILURE == deduplicateTasksBeforeSolving(p_allThreadsParam)) {
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Deadline schedule (EDF) - all tasks are fetched up front & ordered by their latest start times, which the threads dispatch instead of the priority order
+	if (TRUE == p_options->earliestDeadlineFirst) {
+		if (STATUS_CODE_FAILURE == buildDeadlineSchedule(p_allThreadsParam, p_tasksPrioritiesListFilePath, p_options->skipPastDeadlineTasks)) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Size-class lanes - all tasks are fetched up front & split by magnitude into lanes, each with its' own cursor & reserved workers
+	if (0 < p_options->numberOfLaneDigitsBounds) {
+		if (STATUS_CODE_FAILURE == buildSizeClassLanes(p_allThreadsParam, p_options->laneDigitsBounds, (DWORD)p_options->numberOfLaneDigitsBounds,
+			(0 < p_options->numberOfLaneShares) ? p_options->laneShares : NULL, (DWORD)numberOfThreads)) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Work stealing - the positions are dealt up front to a deque per thread, which the threads pop & steal from
+	if (TRUE == p_options->workStealing) {
+		if (NULL == (p_allThreadsParam->p_workStealingScheduler = buildWorkStealingScheduler((DWORD)numberOfThreads, countTaskPositions(p_allThreadsParam)))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Ordered output - the solutions are written in priority order, through a bounded reorder window
+	if (0 < p_options->orderedOutputWindow) {
+		if (NULL == (p_allThreadsParam->p_reorderBuffer = buildReorderBuffer((DWORDLONG)p_options->orderedOutputWindow, (DWORD)numberOfThreads))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Deferred writes - every thread keeps its' solutions in a backlog, written whenever the Tasks file's lock is vacant
+	if (0 < p_options->deferredWritesThreshold) {
+		if (NULL == (p_allThreadsParam->p_deferredWrites = buildDeferredWrites((DWORD)p_options->deferredWritesThreshold))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Output buffering - every thread appends its' solutions' lines to a buffer, written to the Tasks file in a single append
+	if (0 < p_options->outputBufferSize) {
+		if (NULL == (p_allThreadsParam->p_outputBuffering = buildOutputBuffering((DWORD)p_options->outputBufferSize, (DWORD)p_options->outputFlushMilliseconds))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Reserved appends - the threads reserve their solutions' ranges of the output & write them positionally, with no lock
+	if (0 < p_options->appendExtensionSize) {
+		if (NULL == (p_allThreadsParam->p_appendReservations = buildAppendReservations(p_tasksListFilePath, (DWORDLONG)p_options->appendExtensionSize))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Writer thread - the threads push their solutions to a bounded ring, & a single writer thread appends them (started before the threads)
+	if (0 < p_options->writerRingCapacity) {
+		if ((NULL == (p_allThreadsParam->p_writerRing = buildWriterRing(p_tasksListFilePath, (LONG)p_options->writerRingCapacity))) ||
+			(STATUS_CODE_FAILURE == startWriterThread(p_allThreadsParam->p_writerRing))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Job tail mitigation - every thread publishes its' in-flight task, for idle threads to re-execute once no tasks remain
+	if (TRUE == p_options->speculateTail) {
+		if (NULL == (p_allThreadsParam->p_speculativeTail = buildSpeculativeTail((DWORD)numberOfThreads))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+
+	//Runtime tasks feed - all tasks are fetched up front into a priority heap, which is modified by the feed file's commands while solving
+	if (NULL != p_options->p_tasksFeedPath) {
+		if (STATUS_CODE_FAILURE == buildTasksFeed(p_allThreadsParam)) {
+			freeTheThreadPackage(p_allThreadsParam);
+			free(p_threadHandles);
+			free(p_threadIds);
+			return STATUS_CODE_FAILURE;
+		}
+	}
 	
 	
 
@@ -199,6 +378,8 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 
 	
 	printf("\nCommence Tasks solving......\n");
+	startDeadlineClock(p_allThreadsParam->p_deadlineSchedule); //The deadlines are measured from here
+	startSizeClassLanesClock(p_allThreadsParam->p_sizeClassLanes);
 	//Begin threads creation loop...
 	for (th; th < numberOfThreads; th++) {
 
@@ -220,11 +401,26 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 			return STATUS_CODE_FAILURE;
 		}
 	}
+	if (STATUS_CODE_FAILURE == startProgressWatchdog(p_allThreadsParam, p_threadHandles)) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		freeTheThreadPackage(p_allThreadsParam);
+		closeThreadsProcedure(p_threadHandles, p_threadIds, numberOfThreads);
+		return STATUS_CODE_FAILURE;
+	}
+
+
+
+	//Feeding the threads with the feed file's commands, then closing the feed (the threads terminate once the heap is empty).
+	// A failed feed still closes it, so the threads solve the tasks fed so far
+	if (NULL != p_allThreadsParam->p_tasksFeed) {
+		feedRetVal = feedTasksFromFile(p_allThreadsParam, p_options->p_tasksFeedPath);
+		if (STATUS_CODE_SUCCESS != closeTasksFeed(p_allThreadsParam)) feedRetVal = STATUS_CODE_FAILURE;
+	}
 
 
 
-	//Wait for all threads to complete decrypting\encrypting & printing to the output message file
-	if (STATUS_CODE_FAILURE == validateThreadsWaitCode(p_threadHandles, numberOfThreads, numberOfTasks)) {
+	//Wait for all threads to complete solving & printing to the Tasks file (no time cap - unless the progress watchdog detects a stall)
+	if (STATUS_CODE_FAILURE == waitForProgressWatchdog(p_allThreadsParam->p_progressWatchdog)) {
 		freeTheThreadPackage(p_allThreadsParam);
 		closeThreadsProcedure(p_threadHandles, p_threadIds, numberOfThreads);
 		return STATUS_CODE_FAILURE;
@@ -233,6 +429,22 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 
 
 
+	//Writer thread - the ring is closed (no thread pushes anymore), & the writer writes the rest of it & terminates
+	if ((NULL != p_allThreadsParam->p_writerRing) && (STATUS_CODE_FAILURE == closeWriterRing(p_allThreadsParam->p_writerRing, p_allThreadsParam->p_progressWatchdog->stallWindowMilliseconds))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		freeTheThreadPackage(p_allThreadsParam);
+		closeThreadsProcedure(p_threadHandles, p_threadIds, numberOfThreads);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Reserved appends - the file's extension beyond the end of the output is cut (no thread writes anymore)
+	if ((NULL != p_allThreadsParam->p_appendReservations) && (STATUS_CODE_FAILURE == trimReservedOutput(p_allThreadsParam->p_appendReservations, p_tasksListFilePath))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		freeTheThreadPackage(p_allThreadsParam);
+		closeThreadsProcedure(p_threadHandles, p_threadIds, numberOfThreads);
+		return STATUS_CODE_FAILURE;
+	}
+
 	//Exit code validation
 	if (STATUS_CODE_FAILURE == validateThreadsExitCodes(p_threadHandles, numberOfThreads)) {
 		freeTheThreadPackage(p_allThreadsParam);
@@ -243,14 +455,42 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 
 
 	//Reaching here means the following:
-	//	All threads terminated on time
+	//	All threads terminated with no stall
 	//	All threads completed successfully solving tasks
+	printLockStatistics(p_allThreadsParam->p_tasksFileLock);
+	printLockStatistics(p_allThreadsParam->p_prioritiesQueueLock);
+	if (NULL != p_allThreadsParam->p_speculativeTail)
+		printf("Speculative tail: %ld in-flight tasks were re-executed, %ld speculative solutions finished first, %ld solutions were cancelled\n\n",
+			(long)p_allThreadsParam->p_speculativeTail->numberOfSpeculations, (long)p_allThreadsParam->p_speculativeTail->numberOfSpeculativeWins,
+			(long)p_allThreadsParam->p_speculativeTail->numberOfCanceledSolutions);
+	printDeadlineReport(p_allThreadsParam->p_deadlineSchedule);
+	if (NULL != p_allThreadsParam->p_reorderBuffer)
+		printf("Ordered output: window of %llu solutions, at most %llu buffered at once, %llu waits for the window to advance\n\n",
+			p_allThreadsParam->p_reorderBuffer->windowSize, p_allThreadsParam->p_reorderBuffer->maximalBufferedResults, p_allThreadsParam->p_reorderBuffer->numberOfStalls);
+	printDeferredWritesStatistics(p_allThreadsParam->p_deferredWrites);
+	printOutputBufferingStatistics(p_allThreadsParam->p_outputBuffering);
+	printAppendReservationsStatistics(p_allThreadsParam->p_appendReservations);
+	printWriterRingStatistics(p_allThreadsParam->p_writerRing);
+	if (NULL != p_allThreadsParam->p_tasksFeed)
+		printf("Tasks feed: %llu tasks inserted, %llu reprioritized, %llu canceled, %llu commands ignored\n\n",
+			p_allThreadsParam->p_tasksFeed->numberOfFedTasks, p_allThreadsParam->p_tasksFeed->numberOfReprioritizedTasks,
+			p_allThreadsParam->p_tasksFeed->numberOfCanceledTasks, p_allThreadsParam->p_tasksFeed->numberOfIgnoredCommands);
+	else if (NULL != p_allThreadsParam->p_workStealingScheduler)
+		printf("%lld tasks were stolen, maximal start displacement from the priority order: %lld\n\n",
+			p_allThreadsParam->p_workStealingScheduler->numberOfSteals, p_allThreadsParam->p_workStealingScheduler->maximalDisplacement);
+	else if (NULL != p_allThreadsParam->p_sizeClassLanes) printSizeClassLanesReport(p_allThreadsParam->p_sizeClassLanes);
+	else if (1 < p_allThreadsParam->maximalChunkSize) printChunkSizesHistogram(p_allThreadsParam);
+	if (NULL != p_options->p_lockProfilePath) {
+		lock* p_profiledLocks[] = { p_allThreadsParam->p_tasksFileLock, p_allThreadsParam->p_prioritiesQueueLock };
+		printLockProfilesTable(p_profiledLocks, NUMBER_OF_LOCKS);
+		writeLockProfilesJson(p_profiledLocks, NUMBER_OF_LOCKS, p_options->p_lockProfilePath);
+	}
 	freeTheThreadPackage(p_allThreadsParam);
 	closeThreadsProcedure(p_threadHandles, p_threadIds, numberOfThreads);
 
 
-	//Multi-threading operation succeeded.....
-	return STATUS_CODE_SUCCESS;
+	//Multi-threading operation succeeded..... (unless the tasks feed failed)
+	return feedRetVal;
 }
 
 
@@ -260,31 +500,24 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 //This function is placed in this module because it is used both in this module(SolveTasks.c) & in TasksSolverThread.c module
 //It is not placed in the latter because, this function is first used here, to create the Tasks Priorities Queue by reading from
 // the Tasks Prioirities list file. Following the Queue's construction, and the Threads' creation, the Threads' routing make use of it...
-BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORD initialByteOffset, DWORD numberOfBytesToRead, LPDWORD translatedNumber)
+BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORDLONG initialByteOffset, DWORD numberOfBytesToRead, PDWORDLONG translatedNumber)
 {
 	LPTSTR p_numericString = NULL;
 	errno_t retVal;
-	DWORD retValSet = 0, numberOfBytesRead = 0;
+	DWORD numberOfBytesRead = 0;
+	OVERLAPPED readPosition;
 	BOOL retValRead = FALSE;
 	//Input integrity validation
-	if ((NULL == p_h_fileHandle)  || (0 > initialByteOffset) || (0 > numberOfBytesToRead) || (NULL == translatedNumber)) {
+	if ((NULL == p_h_fileHandle) || (NULL == translatedNumber)) {
 		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
 	}
 
-	//Firstly, setting the file Handle to the initial byte position of the line
-	retValSet = SetFilePointer(
-		*p_h_fileHandle,		//Input file Handle 
-		initialByteOffset,		//Initial byte position set to be the begining of the line
-		NULL,					//Assuming there is less than 2^32 bytes in the input file -recheck
-		FILE_BEGIN				//Starting byte count is set to the start of the file (byte=0)
-	);
-	//Validate Handle pointing succeeded...
-	if (INVALID_SET_FILE_POINTER == retValSet) {
-		//Initial byte position of the line wasn't found
-		printf("Error: Failed to reset the file Handle pointer position for reading, with code: %d.\n", GetLastError());
-		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
-		return STATUS_CODE_FAILURE;
-	}
+	//Firstly, the read's position - the initial byte position of the line (64-bit - files may pass 4GB). The read is positional, so there
+	// is no separate seek. Note that on a synchronous Handle ReadFile still moves the file pointer past the bytes read - it is safe only
+	// since every worker reads through its' own read-only Handle, which no other thread (writer or reader) uses (no lock is needed)
+	memset(&readPosition, 0, sizeof(OVERLAPPED));
+	readPosition.Offset = (DWORD)initialByteOffset;
+	readPosition.OffsetHigh = (DWORD)(initialByteOffset >> 32);
 	//Secondly, Memory allocation for the string buffer containing the line's characters
 	if ((p_numericString = (LPTSTR)calloc(sizeof(TCHAR), numberOfBytesToRead + 1)) == NULL) {
 		printf("Error: Failed to allocate memory for the section's string buffer.\n");
@@ -293,11 +526,11 @@ BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORD ini
 	}
 	//Thirdly, reading from the file Handle the size of the line in bytes
 	retValRead = ReadFile(
-		*p_h_fileHandle,			//File Handle after being set at the desired byte-positions
+		*p_h_fileHandle,			//File Handle (synchronous - the read completes before ReadFile returns)
 		p_numericString,			//Task byte-offset (from priority list) or Task itself string buffer pointer
 		numberOfBytesToRead,		//Total number of bytes, needed to be read
 		&numberOfBytesRead,			//Pointer to the total number of bytes fetched 
-		NULL						//Overlapped - off
+		&readPosition				//Overlapped - only its' offset: the read's byte-position
 	);
 	if (STATUS_FILE_READING_FAILED == retValRead) {
 		//Failed to read the needed memory from the file
@@ -308,9 +541,9 @@ BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORD ini
 	}
 
 	//Lastly, translating the numeric string, representing either the task's byte-offset fetched from the Tasks Priority
-	// list file or the task itself fetch from the Tasks list file, to a DWORD (lu - unsigned long) data type number.
-	//		DWORD is taken as datatype since we are assured the Priority values & Tasks values are postive....
-	if ((retVal = sscanf_s(p_numericString, "%lu", translatedNumber)) == EOF) {
+	// list file or the task itself fetch from the Tasks list file, to a DWORDLONG (llu - unsigned long long) data type number.
+	//		DWORDLONG is taken as datatype since we are assured the Priority values & Tasks values are postive, and byte-offsets may pass 4GB....
+	if ((retVal = sscanf_s(p_numericString, "%llu", translatedNumber)) == EOF) {
 		free(p_numericString);
 		printf("Error: Failed to translate the current task's numeric string or byte offset. Exited with code: %d\n", GetLastError());
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
@@ -371,16 +604,16 @@ static queue* buildTasksPrioritiesQueue(char* p_tasksPrioritiesListFilePath, fil
 {
 	queue* p_tasksPrioritiesQueue = NULL;
 	HANDLE* p_h_tasksPrioritiesListFile = NULL;
-	line* p_currentPriorityLine = NULL;
+	line currentPriorityLine;
 	int taskCount = 0;
-	DWORD taskOffsetChosenByPriority = 0;
+	DWORDLONG taskOffsetChosenByPriority = 0;
 	//Input integrity validation
 	if ((NULL == p_tasksPrioritiesListFilePath) || (NULL == p_tasksPrioritiesFileData)) {
 		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
 	}
 
 	//Construct the Queue struct with dynamic memory allocation (Queue Initialization)
-	if (NULL == (p_tasksPrioritiesQueue = InitializeQueue())) {
+	if (NULL == (p_tasksPrioritiesQueue = InitializeQueue((DWORDLONG)numberOfTasks))) {
 		freeTheFile(p_tasksPrioritiesFileData);
 		return NULL;
 	}
@@ -395,14 +628,22 @@ static queue* buildTasksPrioritiesQueue(char* p_tasksPrioritiesListFilePath, fil
 
 
 	//Setting the most prioritized task byte-offset line data as the current analyzed line
-	p_currentPriorityLine = p_tasksPrioritiesFileData->p_firstLineInFile;
+	if (STATUS_CODE_SUCCESS != fetchLineFrame(p_tasksPrioritiesFileData, 0, &currentPriorityLine)) {
+		closeHandleProcedure(p_h_tasksPrioritiesListFile);
+		freeTheFile(p_tasksPrioritiesFileData);
+		if (STATUS_CODE_SUCCESS != DestroyQueue(&p_tasksPrioritiesQueue)) printf("Failed to destroy task priorities queue...\n");
+		return NULL;
+	}
 
 	//Begin extracting tasks' initial offsets & pusing them to the queue...
 	for (taskCount; taskCount < numberOfTasks; taskCount++) {
 
 		//Read most prioritized remaining task's byte-offset by the main thread & insert it to taskOffsetChosenByPriority
-		if (STATUS_CODE_FAILURE == fetchTaskByteOffsetByPriorityOrTaskItself(p_h_tasksPrioritiesListFile, p_currentPriorityLine->initialPositionByByte,
-			p_currentPriorityLine->numberOfBytesInLine, &taskOffsetChosenByPriority)) {
+		// (taken from the lines' values, if they were kept while framing, instead of reading the file)
+		if ((NULL != p_tasksPrioritiesFileData->p_linesValues) ?
+			(STATUS_CODE_FAILURE == fetchLineValueByInitialByteOffset(p_tasksPrioritiesFileData, currentPriorityLine.initialPositionByByte, &taskOffsetChosenByPriority)) :
+			(STATUS_CODE_FAILURE == fetchTaskByteOffsetByPriorityOrTaskItself(p_h_tasksPrioritiesListFile, currentPriorityLine.initialPositionByByte,
+			currentPriorityLine.numberOfBytesInLine, &taskOffsetChosenByPriority))) {
 			closeHandleProcedure(p_h_tasksPrioritiesListFile);
 			freeTheFile(p_tasksPrioritiesFileData);
 			if (STATUS_CODE_SUCCESS != DestroyQueue(&p_tasksPrioritiesQueue)) printf("Failed to destroy task priorities queue...\n");
@@ -420,7 +661,7 @@ static queue* buildTasksPrioritiesQueue(char* p_tasksPrioritiesListFilePath, fil
 
 
 		//Next task byte offset chosen by priority retrieval from taks priority file....
-		if (NULL != p_currentPriorityLine->p_nextLine) p_currentPriorityLine = p_currentPriorityLine->p_nextLine;
+		if ((DWORDLONG)(taskCount + 1) < p_tasksPrioritiesFileData->numberOfLines) fetchLineFrame(p_tasksPrioritiesFileData, taskCount + 1, &currentPriorityLine);
 	}
 
 	//Close file Handle & free the file-data of the Tasks Priorities list file (It has no need anymore!!!)
@@ -433,100 +674,67 @@ static queue* buildTasksPrioritiesQueue(char* p_tasksPrioritiesListFilePath, fil
 	return p_tasksPrioritiesQueue;
 }
 
+static queue* buildTasksPrioritiesQueueLazily(char* p_tasksPrioritiesListFilePath, int numberOfTasks)
+{
+	queue* p_tasksPrioritiesQueue = NULL;
+	mappedFile* p_mappedPrioritiesFile = NULL;
+	int taskCount = 0;
+	DWORDLONG currentLineOffset = 0, nextLineOffset = 0, taskOffsetChosenByPriority = 0;
+	//Asserts
+	assert(NULL != p_tasksPrioritiesListFilePath);
 
+	//Mapping the entire Tasks Priorities list file (pages that aren't touched are never read)
+	if (NULL == (p_mappedPrioritiesFile = mapFileForReading(p_tasksPrioritiesListFilePath, 0))) return NULL;
 
+	//Construct the Queue struct with dynamic memory allocation (Queue Initialization)
+	if (NULL == (p_tasksPrioritiesQueue = InitializeQueue((DWORDLONG)numberOfTasks))) {
+		unmapFile(&p_mappedPrioritiesFile);
+		return NULL;
+	}
 
+	//Begin parsing tasks' initial offsets line after line & pushing them to the queue...
+	for (taskCount; taskCount < numberOfTasks; taskCount++) {
 
-static BOOL createSynchronousObjects(lock* p_lock, int writersOnlyFlag)
-{
-	//Assert
-	assert(NULL != p_lock);
-
-
-	//Allocating dynamic memory (Heap) for a lock's Turnstile Mutex Handle 
-	if (NULL == (p_lock->p_h_turnstileMutex = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT))) {
-		printf("Error: Failed to allocate memory for a resource's lock's Turnstile Mutex handle.\n");
-		printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
-		closeHandleProcedure(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-		return  STATUS_CODE_FAILURE;
-	}
-
-	//Creating a un-named Mutex, since the pointer to the only Handle of this Mutex will be sent to all threads with the Lock
-	*(p_lock->p_h_turnstileMutex) = CreateMutex(
-		NULL,	/* default security attributes */
-		FALSE,	/* initially not owned */
-		NULL);	/* unnamed mutex */
-	if (NULL == *(p_lock->p_h_turnstileMutex)) {
-		printf("Error: Failed to create a handle to lock's Turnstile Mutex with code: %d.\n", GetLastError());
-		free(p_lock->p_h_turnstileMutex);
-		return  STATUS_CODE_FAILURE;
-	}
-
-
-	//If the resource is defined to expect only one kind of threads accessing it - writers - then we may forfeit 
-	//	the other synchronous objects (1 Mutex will do the job)
-	if (WRITERS_ONLY != writersOnlyFlag) {
-		//Allocating dynamic memory (Heap) for a lock's Readers-counting-procedure Mutex Handle 
-		if (NULL == (p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT))) {
-			printf("Error: Failed to allocate memory for a resource's lock's Readers-counting-procedure Mutex handle.\n");
-			printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
-			return  STATUS_CODE_FAILURE;
+		//Parse the current line, unless the file's lines ran out (the last line's offset is pushed again)
+		if (currentLineOffset < p_mappedPrioritiesFile->numberOfBytes) {
+			if (FALSE == parseNumberFromMappedFile(p_mappedPrioritiesFile, currentLineOffset, &taskOffsetChosenByPriority, &nextLineOffset)) {
+				printf("Error: Failed to parse the byte offset at line %d of the Tasks Priorities list file.\n", taskCount);
+				printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+				unmapFile(&p_mappedPrioritiesFile);
+				DestroyQueue(&p_tasksPrioritiesQueue);
+				return NULL;
+			}
+			currentLineOffset = nextLineOffset;
 		}
 
-		//Creating a un-named Mutex, since the pointer to the only Handle of this Mutex will be sent to all threads with the Lock
-		*(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex) = CreateMutex(
-			NULL,	/* default security attributes */
-			FALSE,	/* initially not owned */
-			NULL);	/* unnamed mutex */
-		if (NULL == *(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex)) {
-			printf("Error: Failed to create a handle to lock's Readers-counting-procedure Mutex with code: %d.\n", GetLastError());
-			closeHandleProcedure(p_lock->p_h_turnstileMutex);
-			free(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-			return  STATUS_CODE_FAILURE;
+		//Add another cell to the end of the queue (Queue Push)
+		if (STATUS_CODE_FAILURE == Push(p_tasksPrioritiesQueue, taskOffsetChosenByPriority)) {
+			unmapFile(&p_mappedPrioritiesFile);
+			//Queue already destroyed within Push(.)
+			return NULL;
 		}
+	}
 
+	//The Tasks Priorities list file has no need anymore!!!
+	unmapFile(&p_mappedPrioritiesFile);
 
+	printf("Queue created & was updated with values from the Tasks Priorities list file (lazily).\n");
+	return p_tasksPrioritiesQueue;
+}
 
 
-		//Allocating dynamic memory (Heap) for a lock's resource vacancy status Semaphore Handle 
-		if (NULL == (p_lock->p_h_vaccantResourceStatusSemphore = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT))) {
-			printf("Error: Failed to allocate memory for a resource's lock's vacancy status Semaphore handle.\n");
-			printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
-			closeHandleProcedure(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-			closeHandleProcedure(p_lock->p_h_turnstileMutex);
-			return  STATUS_CODE_FAILURE;
-		}
-
 
-		//Creating Sephamore for Readers documentation & signalling to a Write\Reader when the resource is vacanat completely
-		*(p_lock->p_h_vaccantResourceStatusSemphore) = CreateSemaphore(
-			NULL,					/*  default security attributes - no need that the thread can be inherited by child processes */
-			SINGLE_OBJECT,			/*  initial count - setting this to '1' so whatever thread (Reader\Writer) that requests access to the resource first, will be granted with approval */
-			SINGLE_OBJECT,			/*  maximum count - setting this to '1' so only one type of thread - Reader\Writer will be able to use the signal & access the resource at a time*/
-			NULL					/*  semaphore name - un-named because the Semaphore's handle is created on the Heap & is transferred to all threads */
-		);
-		if (NULL == *(p_lock->p_h_vaccantResourceStatusSemphore)) {
-			printf("Error: Failed to create a handle to lock's Readers-counting-procedure Mutex with code: %d.\n", GetLastError());
-			closeHandleProcedure(p_lock->p_h_readersCountingAtEntryOrDepartureProceduresMutex);
-			closeHandleProcedure(p_lock->p_h_turnstileMutex);
-			free(p_lock->p_h_vaccantResourceStatusSemphore);
-			return  STATUS_CODE_FAILURE;
-		}
-	}
 
-	//Lock's Synchronous objects memory allocation & creation succeeded..
-	return STATUS_CODE_SUCCESS;
-}
 
 static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePath, queue* p_tasksPrioritiesQueue,
-	file* p_tasksFileData, int numberOfTasks, int numberOfThreads)
+	file* p_tasksFileData, tasksContainer* p_tasksContainer, mappedFile* p_mappedTasksFile, int numberOfTasks, int numberOfThreads)
 {
 	threadPackage* p_allThreadsParam = NULL;
 
 	//Asserts
 	assert(NULL != p_tasksListFilePath);
-	assert(NULL != p_tasksPrioritiesQueue);
-	assert(NULL != p_tasksFileData);
+	assert((NULL != p_tasksContainer) || (NULL != p_tasksPrioritiesQueue));
+	assert((NULL != p_tasksContainer) || (NULL != p_tasksFileData) || (NULL != p_mappedTasksFile));
 
 	//Allocate dynamic memory for a threadPackage struct which will in fact be a single parameters struct, 
 	// that all threads will receive (No Duplicates!), since it contains the resources' pointers & their locks pointers,
@@ -535,7 +743,9 @@ static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePat
 		printf("Error: Failed to allocate memory for threads' parameters struct.\n");
 		printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
 		freeTheFile(p_tasksFileData);
-		DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksPrioritiesQueue) DestroyQueue(&p_tasksPrioritiesQueue);
+		if (NULL != p_tasksContainer) unloadTasksContainer(&p_tasksContainer);
+		if (NULL != p_mappedTasksFile) unmapFile(&p_mappedTasksFile);
 		return  NULL;
 	}
 
@@ -543,38 +753,27 @@ static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePat
 	p_allThreadsParam->p_tasksFilePath = p_tasksListFilePath;
 	p_allThreadsParam->p_prioritiesQueue = p_tasksPrioritiesQueue;
 	p_allThreadsParam->p_tasksFileData = p_tasksFileData;
-
-	//Allocate memory for Tasks file lock & the Priorities Queue lock
-	if (NULL == (p_allThreadsParam->p_tasksFileLock = (lock*)calloc(sizeof(lock), SINGLE_OBJECT))) {
+	p_allThreadsParam->p_tasksContainer = p_tasksContainer;
+	p_allThreadsParam->p_mappedTasksFile = p_mappedTasksFile;
+	p_allThreadsParam->numberOfTasks = (DWORDLONG)numberOfTasks;
+	p_allThreadsParam->numberOfThreads = (DWORDLONG)numberOfThreads;
+	p_allThreadsParam->minimalChunkSize = 1;
+	p_allThreadsParam->maximalChunkSize = 1;
+
+	//Allocate memory for Tasks file lock & the Priorities Queue lock (a lock is a state word - it needs no Synchronous objects)
+	if (NULL == (p_allThreadsParam->p_tasksFileLock = InitializeLock("Tasks file"))) {
 		printf("Error: Failed to allocate memory for Tasks' file lock struct.\n");
 		printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
 		freeTheThreadPackage(p_allThreadsParam);
 		return  NULL;
 	}
-	if (NULL == (p_allThreadsParam->p_prioritiesQueueLock = (lock*)calloc(sizeof(lock), SINGLE_OBJECT))) {
+	if (NULL == (p_allThreadsParam->p_prioritiesQueueLock = InitializeLock("Priorities Queue"))) {
 		printf("Error: Failed to allocate memory for Priorities Queue lock struct.\n");
 		printf("At file: %s\n at line number: %d\n at function: %s", __FILE__, __LINE__, __func__);
 		freeTheThreadPackage(p_allThreadsParam);
 		return  NULL;
 	}
 
-	//Allocate memory for Syncronous objects for every lock
-	if (STATUS_CODE_FAILURE == createSynchronousObjects(p_allThreadsParam->p_tasksFileLock, WRITERS_ONLY - 1)) { //WRITERS & READERS ARE DEFINED TO THE RESOURCE
-		printf("Error: Failed to create the Tasks' file lock with its Sync. objects\n");
-		freeTheThreadPackage(p_allThreadsParam);
-		return NULL;
-	}
-	if (STATUS_CODE_FAILURE == createSynchronousObjects(p_allThreadsParam->p_prioritiesQueueLock, WRITERS_ONLY)) { //WRITERS 
-		printf("Error: Failed to create the Priorities Queue lock with its Sync. objects\n");
-		freeTheThreadPackage(p_allThreadsParam);
-		return NULL;
-	}
-	//Update locks timeouts variables
-	p_allThreadsParam->p_tasksFileLock->numberOfTasks = numberOfTasks;
-	p_allThreadsParam->p_tasksFileLock->numberOfThreads = numberOfThreads;
-	p_allThreadsParam->p_prioritiesQueueLock->numberOfTasks = numberOfTasks;
-	p_allThreadsParam->p_prioritiesQueueLock->numberOfThreads = numberOfThreads;
-
 	//Building the threads' parameters struct was successful
 	return p_allThreadsParam;
 }
@@ -583,6 +782,49 @@ static threadPackage* initializeThreadsParametersStruct(char* p_tasksListFilePat
 
 
 
+static BOOL deduplicateTasksBeforeSolving(threadPackage* p_allThreadsParam)
+{
+	PDWORDLONG p_tasksValues = NULL;
+	//Assert
+	assert(NULL != p_allThreadsParam);
+
+	//Fetching all the tasks' values in priority order
+	if (NULL == (p_tasksValues = fetchAllTasksInPriorityOrder(p_allThreadsParam))) return STATUS_CODE_FAILURE;
+
+	//Grouping the identical values - the positions cursor (and its' counters) is rewound to dispatch the distinct tasks
+	p_allThreadsParam->p_deduplicatedTasks = deduplicateTasks(p_tasksValues, p_allThreadsParam->numberOfTasks);
+	p_allThreadsParam->nextTaskPosition = 0;
+	memset((void*)p_allThreadsParam->chunkSizesHistogram, 0, sizeof(p_allThreadsParam->chunkSizesHistogram));
+	free(p_tasksValues);
+	return (NULL != p_allThreadsParam->p_deduplicatedTasks) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE;
+}
+
+static void printChunkSizesHistogram(threadPackage* p_allThreadsParam)
+{
+	DWORD bucket = 0;
+	//Assert
+	assert(NULL != p_allThreadsParam);
+
+	printf("Chunk sizes claimed (floor %llu, ceiling %llu):\n", p_allThreadsParam->minimalChunkSize, p_allThreadsParam->maximalChunkSize);
+	for (bucket = 0; bucket < CHUNK_SIZES_HISTOGRAM_BUCKETS; bucket++) {
+		if (0 == p_allThreadsParam->chunkSizesHistogram[bucket]) continue;
+		if (0 == bucket) printf("\t1 task: %ld chunks\n", (long)p_allThreadsParam->chunkSizesHistogram[bucket]);
+		else if (bucket + 1 == CHUNK_SIZES_HISTOGRAM_BUCKETS) printf("\t%llu+ tasks: %ld chunks\n", 1ULL << bucket, (long)p_allThreadsParam->chunkSizesHistogram[bucket]);
+		else printf("\t%llu-%llu tasks: %ld chunks\n", 1ULL << bucket, (2ULL << bucket) - 1, (long)p_allThreadsParam->chunkSizesHistogram[bucket]);
+	}
+	printf("\n");
+}
+
+static DWORDLONG countTaskPositions(threadPackage* p_allThreadsParam)
+{
+	//Assert
+	assert(NULL != p_allThreadsParam);
+
+	if (NULL != p_allThreadsParam->p_deduplicatedTasks) return p_allThreadsParam->p_deduplicatedTasks->numberOfDistinctTasks;
+	if (NULL != p_allThreadsParam->p_tasksContainer) return p_allThreadsParam->numberOfTasks;
+	return p_allThreadsParam->p_prioritiesQueue->numberOfCells;
+}
+
 static HANDLE createThreadSimple(LPTHREAD_START_ROUTINE p_startRoutine,
 	LPVOID p_threadParameters,
 	LPDWORD p_threadId)
@@ -610,35 +852,6 @@ static HANDLE createThreadSimple(LPTHREAD_START_ROUTINE p_startRoutine,
 }
 
 
-static BOOL validateThreadsWaitCode(HANDLE* p_threadHandles, int numberOfThreads, int numberOfTasks)
-{
-	DWORD waitCode = 0;
-	//Asserts
-	assert(NULL != p_threadHandles);
-	assert(0 < numberOfThreads);
-
-	//Wait for 3 seconds for all threads to finish...
-	waitCode = WaitForMultipleObjects(
-		numberOfThreads,									  						// number of objects in array
-		p_threadHandles,															// array of objects
-		WAIT_FOR_ALL_OBJECTS,														// wait for any object
-		TIMEOUT_BASE_CONSTANT_MS*MAX_LENGTH_TASK*numberOfTasks/numberOfThreads);	// 0.01-second base wait  T.O.=func(#Tasks,#Threads,Max Task's length)
-	 
-	//Validating that all threads have finished....
-	switch (waitCode) {
-	case WAIT_OBJECT_0:
-		printf("\nAll threads terminated on time.\nProceed to validate correctness of the exit codes of the threads...\n"); return STATUS_CODE_SUCCESS;
-	case WAIT_TIMEOUT:
-		printf("\nTIMEOUT: Not all threads terminated on time... \nSolving various tasks may have failed.\n"); return STATUS_CODE_FAILURE;
-	case WAIT_ABANDONED_0:
-		printf("\nAt least one of the objects is an abandoned Mutex object... \nEXITING....\n"); return STATUS_CODE_FAILURE;
-	default:
-		printf("0x%x\nExtended error code: %d\n", waitCode, GetLastError());
-		return STATUS_CODE_FAILURE;
-	}
-}
-
-
 static BOOL validateThreadsExitCodes(HANDLE* p_threadHandles, int numberOfThreads)
 {
 	int t = 0;
@@ -661,7 +874,7 @@ static BOOL validateThreadsExitCodes(HANDLE* p_threadHandles, int numberOfThread
 		}
 		//Validate the thread terminated completely and no longer running
 		if (STILL_ACTIVE == exitCode) { 
-			printf("Thread no. %d is still alive after threads termination timeout... exiting.\n", t);
+			printf("Thread no. %d is still alive after the threads terminated... exiting.\n", t);
 			return STATUS_CODE_FAILURE;
 		}
 		//Validating the thread's return value(exit code) is as expected of a thread that completed its' operation successfuly...
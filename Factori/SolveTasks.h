@@ -20,6 +20,19 @@
 #include "FrameFileLines.h"
 #include "Queue.h"
 #include "TasksSolverThread.h"
+#include "TasksContainer.h"
+#include "MappedFile.h"
+#include "WorkStealing.h"
+#include "TasksFeed.h"
+#include "ReorderBuffer.h"
+#include "SpeculativeTail.h"
+#include "DeadlineScheduling.h"
+#include "SizeClassLanes.h"
+#include "ProgressWatchdog.h"
+#include "DeferredWrites.h"
+#include "OutputBuffer.h"
+#include "AppendReservations.h"
+#include "WriterThread.h"
 
 //DELETE '&'
 
@@ -27,19 +40,22 @@
 /// <summary>
 /// Description - This function receives the input Tasks list file and Tasks Priorities file, the number of threads the program should use for solving 
 ///		the tasks and the number of tasks. The function begins by "framing" the Tasks Priorities file's lines as byte offsets and lines sizes within a
-///		"line"s nested list's elements (struct) that lies within a "file" struct. Later, the "file" struct, aka file's data' is used to construct the 
+///		"line"s array's elements (struct) that lies within a "file" struct. Later, the "file" struct, aka file's data' is used to construct the 
 ///		Tasks Priorities Queue. Afterwards, another "file" struct is created to describe the Tasks list file framing. Following that, the function
 ///		allocates memory for Handles (Threads, Mutexes, Semaphores), threads IDs and constructs the threads' input parameters object by arranging the
 ///		paramters (pointers to the resources and their locks) inside a "threadPackage" struct. Then the function creates all #Threads threads that begin
 ///		solving the tasks and writing their outputs to the Tasks file. Finally, after threads termination, the function assures all threads completed their
 ///		operation and exitted with the desired exit codes ('1'), and closes all remaining handles and freeing all remaining dynamically allocated memory.   
+///		If the Tasks list file is a tasks container (binary columnar file), it is mapped instead of framing both text files & building the Queue,
+///		and the threads draw the tasks by the container's priorities column (the Tasks Priorities list file path is ignored).
 /// </summary>
 /// <param name="char* p_tasksListFilePath - A pointer to the commandline argument (string) that represents the Tasks list file's path (absolute\relative)"></param>
 /// <param name="char* p_tasksPrioritiesListFilePath - A pointer to the commandline argument (string) that represents the Tasks Priorities list file's path (absolute\relative)"></param>
 /// <param name="int numberOfTasks - An integer that represents the number of tasks the program needs to solve"></param>
 /// <param name="int numberOfThreads - An integer that represents the number of threads the program will use for the tasks solving procedure."></param>
+/// <param name="solverOptions* p_options - A pointer to the optional solving properties received from the commandline (e.g. compressed lines index)"></param>
 /// <returns>A BOOL value representing the function's outcome (All tasks were solved and documented). Success (TRUE) or Failure (FALSE)</returns>
-BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, int numberOfTasks, int numberOfThreads);
+BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, int numberOfTasks, int numberOfThreads, solverOptions* p_options);
 	/*file* p_tasksPrioritiesFileData,*//*queue* p_tasksPrioritiesQueue, file* p_tasksFileData*/
 
 /// <summary>
@@ -48,12 +64,14 @@ BOOL solveTasks(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath,
 ///		 the retrieved value in a predetermined address of an unsigned datatype variable defined outside this function.
 ///		 The function is given a pointer to a handle to the desired file, an initial byte position, number of bytes it should read from the
 ///		 file and a pointer to the variable that is meant to hold the retrieved value.
+///		 The read is positional (ReadFile with an OVERLAPPED offset) - it doesn't depend on the Handle's file pointer, but it still moves it
+///		 (a synchronous Handle), so the Handle must be the calling thread's own & never shared with a Writer. Then no lock is needed around it.
 /// </summary>
-/// <param name="HANDLE* p_h_fileHandle - A pointer to the Handle of a text file (either the Tasks list or Tasks Priorities list)"></param>
-/// <param name="DWORD initialByteOffset - An unsigned integer represeting the starting read position (initial byte poisition-offset)"></param>
+/// <param name="HANDLE* p_h_fileHandle - A pointer to a synchronous Handle of a text file opened for reading (either the Tasks list or Tasks Priorities list)"></param>
+/// <param name="DWORDLONG initialByteOffset - An unsigned 64-bit integer represeting the starting read position (initial byte poisition-offset)"></param>
 /// <param name="DWORD numberOfBytesToRead - An unsigned integer representing the number of bytes that should be read that represent either a task or a task's byte-offset"></param>
-/// <param name="LPDWORD translatedNumber - A pointer to the variable that is meant to hold the read value"></param>
+/// <param name="PDWORDLONG translatedNumber - A pointer to the (64-bit) variable that is meant to hold the read value"></param>
 /// <returns>A BOOL value representing the function's outcome (The desired value was retrieved and placed in the predetermined location). Success (TRUE) or Failure (False)</returns>
-BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORD initialByteOffset, DWORD numberOfBytesToRead, LPDWORD translatedNumber);
+BOOL fetchTaskByteOffsetByPriorityOrTaskItself(HANDLE* p_h_fileHandle, DWORDLONG initialByteOffset, DWORD numberOfBytesToRead, PDWORDLONG translatedNumber);
 
 #endif //__SOLVE_TASKS_H__
@@ -0,0 +1,200 @@
+/* SpeculativeTail.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for mitigating the job's
+		tail: every thread publishes the task it solves in its' own slot, & once no
+		tasks remain to dispatch, idle threads re-execute the oldest in-flight tasks.
+		The first solver of a task to finish writes the solution, & the others are
+		cancelled cooperatively (they poll the task's generation while solving)
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "SpeculativeTail.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORD NO_SLOT_FOUND = (DWORD)-1;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function reads a slot's generation with a full memory barrier, so the slot's fields read afterwards aren't older than it.
+/// </summary>
+/// <param name="inFlightTask* p_slot - A pointer to an in-flight task's slot"></param>
+/// <returns>The slot's generation</returns>
+static LONG readGeneration(inFlightTask* p_slot);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+speculativeTail* buildSpeculativeTail(DWORD numberOfThreads)
+{
+	speculativeTail* p_speculativeTail = NULL;
+	//Input integrity validation
+	if (0 == numberOfThreads) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the slots - a zeroed slot has an even generation (no task in flight)
+	if ((NULL == (p_speculativeTail = (speculativeTail*)calloc(sizeof(speculativeTail), SINGLE_OBJECT))) ||
+		(NULL == (p_speculativeTail->p_slots = (inFlightTask*)calloc(sizeof(inFlightTask), numberOfThreads)))) {
+		printf("Error: Failed to allocate memory for the in-flight tasks' slots.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		destroySpeculativeTail(&p_speculativeTail);
+		return NULL;
+	}
+	p_speculativeTail->numberOfSlots = numberOfThreads;
+
+	return p_speculativeTail;
+}
+
+BOOL registerSpeculativeTailSolver(speculativeTail* p_speculativeTail, PDWORD p_slotIndex)
+{
+	LONG slotIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_speculativeTail) || (NULL == p_slotIndex)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Every thread takes the next slot
+	slotIndex = InterlockedIncrement(&(p_speculativeTail->numberOfRegisteredSolvers)) - 1;
+	if ((DWORD)slotIndex >= p_speculativeTail->numberOfSlots) {
+		printf("Error: More threads registered than the %lu in-flight tasks' slots.\n", (unsigned long)p_speculativeTail->numberOfSlots);
+		return STATUS_CODE_FAILURE;
+	}
+
+	*p_slotIndex = (DWORD)slotIndex;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL publishInFlightTask(speculativeTail* p_speculativeTail, DWORD slotIndex, DWORDLONG task, DWORDLONG position, DWORDLONG numberOfOccurrences,
+	cancellationToken* p_cancellationToken)
+{
+	inFlightTask* p_slot = NULL;
+	//Input integrity validation
+	if ((NULL == p_speculativeTail) || (slotIndex >= p_speculativeTail->numberOfSlots) || (NULL == p_cancellationToken)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+	p_slot = p_speculativeTail->p_slots + slotIndex;
+
+	//The previous task of the slot was resolved - no thread adopts from an even generation
+	assert(0 == (readGeneration(p_slot) & 1));
+	p_slot->task = task;
+	p_slot->position = position;
+	p_slot->numberOfOccurrences = numberOfOccurrences;
+	p_slot->startTickCount = GetTickCount64();
+
+	//Publishing (the interlocked increment is a full barrier - the fields are visible before the odd generation)
+	p_cancellationToken->p_watchedValue = &(p_slot->generation);
+	p_cancellationToken->expectedValue = InterlockedIncrement(&(p_slot->generation));
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL adoptOldestInFlightTask(speculativeTail* p_speculativeTail, DWORD ownSlotIndex, inFlightTask* p_adoptedTask, cancellationToken* p_cancellationToken)
+{
+	inFlightTask* p_slot = NULL;
+	DWORD slotIndex = 0, oldestSlotIndex = NO_SLOT_FOUND;
+	LONG generation = 0, speculatedGeneration = 0;
+	ULONGLONG oldestStartTickCount = 0;
+	//Input integrity validation
+	if ((NULL == p_speculativeTail) || (NULL == p_adoptedTask) || (NULL == p_cancellationToken)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	while (TRUE) {
+		//Locating the oldest in-flight task that wasn't adopted yet (other threads' slots only)
+		oldestSlotIndex = NO_SLOT_FOUND;
+		for (slotIndex = 0; slotIndex < p_speculativeTail->numberOfSlots; slotIndex++) {
+			p_slot = p_speculativeTail->p_slots + slotIndex;
+			generation = readGeneration(p_slot);
+			if ((ownSlotIndex == slotIndex) || (0 == (generation & 1)) || (generation == p_slot->speculatedGeneration)) continue;
+			if ((NO_SLOT_FOUND == oldestSlotIndex) || (p_slot->startTickCount < oldestStartTickCount)) {
+				oldestSlotIndex = slotIndex;
+				oldestStartTickCount = p_slot->startTickCount;
+			}
+		}
+		if (NO_SLOT_FOUND == oldestSlotIndex) return SPECULATIVE_TAIL_NOTHING_TO_ADOPT;
+
+		//Copying the task between two reads of the generation - an unchanged odd generation means the copy is of the task in flight
+		p_slot = p_speculativeTail->p_slots + oldestSlotIndex;
+		generation = readGeneration(p_slot);
+		*p_adoptedTask = *p_slot;
+		MemoryBarrier();
+		if ((0 == (generation & 1)) || (generation != readGeneration(p_slot))) continue;
+
+		//A single speculative copy per task - the thread that marks the generation as speculated adopts the task
+		speculatedGeneration = p_slot->speculatedGeneration;
+		if (generation == speculatedGeneration) continue;
+		if (speculatedGeneration != InterlockedCompareExchange(&(p_slot->speculatedGeneration), generation, speculatedGeneration)) continue;
+		break;
+	}
+
+	//The adopted task is cancelled once its' generation changes
+	p_adoptedTask->generation = generation;
+	p_cancellationToken->p_watchedValue = &(p_slot->generation);
+	p_cancellationToken->expectedValue = generation;
+	InterlockedIncrement(&(p_speculativeTail->numberOfSpeculations));
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL resolveInFlightTask(speculativeTail* p_speculativeTail, cancellationToken* p_cancellationToken, BOOL speculativeSolver)
+{
+	//Input integrity validation
+	if ((NULL == p_speculativeTail) || (NULL == p_cancellationToken) || (NULL == p_cancellationToken->p_watchedValue)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The first solver advances the generation to even (resolved) - every other solver of the task sees it changed & is cancelled
+	if (p_cancellationToken->expectedValue != InterlockedCompareExchange(p_cancellationToken->p_watchedValue,
+		p_cancellationToken->expectedValue + 1, p_cancellationToken->expectedValue)) {
+		InterlockedIncrement(&(p_speculativeTail->numberOfCanceledSolutions));
+		return SPECULATIVE_TAIL_ALREADY_RESOLVED;
+	}
+
+	//The solver writes the task's solution
+	if (TRUE == speculativeSolver) InterlockedIncrement(&(p_speculativeTail->numberOfSpeculativeWins));
+	return STATUS_CODE_SUCCESS;
+}
+
+void destroySpeculativeTail(speculativeTail** p_p_speculativeTail)
+{
+	//Input integrity validation
+	if ((NULL == p_p_speculativeTail) || (NULL == *p_p_speculativeTail)) return;
+
+	//Free the slots & the struct
+	free((*p_p_speculativeTail)->p_slots);
+	free(*p_p_speculativeTail);
+	*p_p_speculativeTail = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static LONG readGeneration(inFlightTask* p_slot)
+{
+	LONG generation = 0;
+	//Assert
+	assert(NULL != p_slot);
+
+	generation = p_slot->generation;
+	MemoryBarrier();
+	return generation;
+}
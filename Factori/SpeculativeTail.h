@@ -0,0 +1,81 @@
+/* SpeculativeTail.h
+-----------------------------------------------------------
+	Module Description - header module for SpeculativeTail.c
+-----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __SPECULATIVE_TAIL_H__
+#define __SPECULATIVE_TAIL_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+// Constants ---------------------------------------------------
+#define SPECULATIVE_TAIL_ALREADY_RESOLVED 2		// resolveInFlightTask(.)'s outcome when another solver of the task finished first (the solution is discarded)
+#define SPECULATIVE_TAIL_NOTHING_TO_ADOPT 3		// adoptOldestInFlightTask(.)'s outcome when no other thread's task is in flight & unspeculated
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the in-flight tasks' slots of 'numberOfThreads' threads, with no task in flight.
+/// </summary>
+/// <param name="DWORD numberOfThreads - The number of threads solving the tasks (a slot per thread)"></param>
+/// <returns>A pointer to a dynamically allocated 'speculativeTail' struct if successful, or NULL if failed</returns>
+speculativeTail* buildSpeculativeTail(DWORD numberOfThreads);
+/// <summary>
+///	 Description - This function hands a thread the next vacant in-flight task's slot (atomically, without a lock).
+/// </summary>
+/// <param name="speculativeTail* p_speculativeTail - A pointer to a speculativeTail struct"></param>
+/// <param name="PDWORD p_slotIndex - A pointer to the variable that will be updated with the thread's slot's index"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) if more threads registered than slots exist</returns>
+BOOL registerSpeculativeTailSolver(speculativeTail* p_speculativeTail, PDWORD p_slotIndex);
+/// <summary>
+///	 Description - This function publishes the task a thread begins solving in the thread's slot: the task's fields are written while the
+///		slot's generation is even (idle), & the generation is then incremented to odd - other threads may adopt the task from now on.
+/// </summary>
+/// <param name="speculativeTail* p_speculativeTail - A pointer to a speculativeTail struct"></param>
+/// <param name="DWORD slotIndex - The thread's slot's index"></param>
+/// <param name="DWORDLONG task - The task's value"></param>
+/// <param name="DWORDLONG position - The task's position (dispatch order)"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the task's solution is written"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token that will be set to watch the task's generation"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL publishInFlightTask(speculativeTail* p_speculativeTail, DWORD slotIndex, DWORDLONG task, DWORDLONG position, DWORDLONG numberOfOccurrences,
+	cancellationToken* p_cancellationToken);
+/// <summary>
+///	 Description - This function adopts the oldest in-flight task of another thread, that no other thread adopted yet, for a speculative
+///		re-execution. The slot's generation is read before & after its' fields are copied, so a task that was resolved (& maybe replaced)
+///		meanwhile is never adopted.
+/// </summary>
+/// <param name="speculativeTail* p_speculativeTail - A pointer to a speculativeTail struct"></param>
+/// <param name="DWORD ownSlotIndex - The adopting thread's own slot's index (never adopted from)"></param>
+/// <param name="inFlightTask* p_adoptedTask - A pointer to the struct that will be updated with a copy of the adopted task"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token that will be set to watch the adopted task's generation"></param>
+/// <returns>Adopted (TRUE), SPECULATIVE_TAIL_NOTHING_TO_ADOPT or Failure (FALSE)</returns>
+BOOL adoptOldestInFlightTask(speculativeTail* p_speculativeTail, DWORD ownSlotIndex, inFlightTask* p_adoptedTask, cancellationToken* p_cancellationToken);
+/// <summary>
+///	 Description - This function resolves an in-flight task once one of its' solvers finished (or was cancelled): the first solver to advance
+///		the task's generation (compare-and-swap) owns the solution's writing, & every other solver of the task is cancelled.
+/// </summary>
+/// <param name="speculativeTail* p_speculativeTail - A pointer to a speculativeTail struct"></param>
+/// <param name="cancellationToken* p_cancellationToken - A pointer to the token watching the task's generation"></param>
+/// <param name="BOOL speculativeSolver - TRUE if the solver adopted the task (counted as a speculative win)"></param>
+/// <returns>The solver writes the solution (TRUE), SPECULATIVE_TAIL_ALREADY_RESOLVED or Failure (FALSE)</returns>
+BOOL resolveInFlightTask(speculativeTail* p_speculativeTail, cancellationToken* p_cancellationToken, BOOL speculativeSolver);
+/// <summary>
+///	 Description - This function frees the in-flight tasks' slots & sets their pointer to NULL.
+/// </summary>
+/// <param name="speculativeTail** p_p_speculativeTail - A pointer to a pointer to a 'speculativeTail' struct"></param>
+void destroySpeculativeTail(speculativeTail** p_p_speculativeTail);
+
+
+#endif //__SPECULATIVE_TAIL_H__
@@ -0,0 +1,484 @@
+/* TasksContainer.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for converting the Tasks &
+		Tasks Priorities text files into a tasks container - a binary columnar file that
+		holds the tasks' values & their priority order packed (no framing or parsing is
+		needed for solving), and for loading (mapping) such a container for solving.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "TasksContainer.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORDLONG INITIAL_ROWS_CAPACITY = 1024;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function parses the mapped Tasks list file line by line, and appends every line that holds a number as a row:
+///		the task's value to the tasks column & the line's initial byte position to the rows' offsets array (used for translating priorities).
+///		Both arrays grow by doubling.
+/// </summary>
+/// <param name="mappedFile* p_mappedTasksFile - A pointer to the mapped Tasks list file"></param>
+/// <param name="LPDWORD* p_p_tasksColumn - A pointer to the tasks column pointer (allocated within)"></param>
+/// <param name="PDWORDLONG* p_p_rowsOffsets - A pointer to the rows' offsets array pointer (allocated within)"></param>
+/// <param name="PDWORDLONG p_numberOfRows - A pointer to the variable that will be updated with the number of rows"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL buildTasksColumn(mappedFile* p_mappedTasksFile, LPDWORD* p_p_tasksColumn, PDWORDLONG* p_p_rowsOffsets, PDWORDLONG p_numberOfRows);
+/// <summary>
+///  Description - This function parses the mapped Tasks Priorities list file line by line, and translates every byte-offset to the row
+///		of the task it points at (binary search over the rows' offsets, which are strictly increasing). Empty lines are skipped.
+///		A line's optional second column is the task's deadline (milli-seconds) - it is kept in a deadlines column, parallel to the priorities.
+/// </summary>
+/// <param name="mappedFile* p_mappedPrioritiesFile - A pointer to the mapped Tasks Priorities list file"></param>
+/// <param name="PDWORDLONG p_rowsOffsets - A pointer to the rows' offsets array"></param>
+/// <param name="DWORDLONG numberOfRows - The number of rows in the tasks column"></param>
+/// <param name="LPDWORD* p_p_prioritiesColumn - A pointer to the priorities column pointer (allocated within)"></param>
+/// <param name="LPDWORD* p_p_deadlinesColumn - A pointer to the deadlines column pointer (allocated within, TASK_DEADLINE_NONE where a line has no deadline)"></param>
+/// <param name="PDWORDLONG p_numberOfPriorities - A pointer to the variable that will be updated with the number of priorities"></param>
+/// <param name="BOOL* p_hasDeadlines - A pointer to the variable that will be updated with whether any line has a deadline"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a byte-offset that isn't a task's line</returns>
+static BOOL buildPrioritiesColumn(mappedFile* p_mappedPrioritiesFile, PDWORDLONG p_rowsOffsets, DWORDLONG numberOfRows,
+	LPDWORD* p_p_prioritiesColumn, LPDWORD* p_p_deadlinesColumn, PDWORDLONG p_numberOfPriorities, BOOL* p_hasDeadlines);
+/// <summary>
+///  Description - This function writes the container (header & both columns) to a new file (an existing file is overwritten).
+/// </summary>
+/// <param name="char* p_containerFilePath - A pointer to the output container file's path"></param>
+/// <param name="tasksContainerHeader* p_header - A pointer to the filled container header"></param>
+/// <param name="LPDWORD p_tasksColumn - A pointer to the tasks column"></param>
+/// <param name="LPDWORD p_prioritiesColumn - A pointer to the priorities column"></param>
+/// <param name="LPDWORD p_deadlinesColumn - A pointer to the deadlines column (NULL - not written)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL writeTasksContainer(char* p_containerFilePath, tasksContainerHeader* p_header, LPDWORD p_tasksColumn, LPDWORD p_prioritiesColumn, LPDWORD p_deadlinesColumn);
+/// <summary>
+///  Description - This function reads a container's header from the beginning of a file.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the file's path"></param>
+/// <param name="tasksContainerHeader* p_header - A pointer to the header struct that will be updated"></param>
+/// <returns>TRUE if a whole header was read & it begins with TASKS_CONTAINER_MAGIC, FALSE otherwise</returns>
+static BOOL readTasksContainerHeader(char* p_filePath, tasksContainerHeader* p_header);
+/// <summary>
+///  Description - This function validates the consistency of a container's header: version, columns' bounds within the payload, etc.
+/// </summary>
+/// <param name="tasksContainerHeader* p_header - A pointer to the container header"></param>
+/// <param name="DWORDLONG fileSize - The container file's size in bytes"></param>
+/// <returns>A BOOL value representing the function's outcome. Valid (TRUE) or Invalid (FALSE)</returns>
+static BOOL validateTasksContainerHeader(tasksContainerHeader* p_header, DWORDLONG fileSize);
+
+
+
+
+// Functions definitions ------------------------------------------------------------------
+
+BOOL convertTextFilesToTasksContainer(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, char* p_containerFilePath)
+{
+	mappedFile* p_mappedTasksFile = NULL, *p_mappedPrioritiesFile = NULL;
+	LPDWORD p_tasksColumn = NULL, p_prioritiesColumn = NULL, p_deadlinesColumn = NULL;
+	PDWORDLONG p_rowsOffsets = NULL;
+	DWORDLONG numberOfRows = 0, numberOfPriorities = 0;
+	tasksContainerHeader header;
+	BOOL retVal = STATUS_CODE_FAILURE, hasDeadlines = FALSE;
+	//Input integrity validation
+	if ((NULL == p_tasksListFilePath) || (NULL == p_tasksPrioritiesListFilePath) || (NULL == p_containerFilePath)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Mapping both text files (entirely)
+	if (NULL == (p_mappedTasksFile = mapFileForReading(p_tasksListFilePath, 0))) return STATUS_CODE_FAILURE;
+	if (NULL == (p_mappedPrioritiesFile = mapFileForReading(p_tasksPrioritiesListFilePath, 0))) {
+		unmapFile(&p_mappedTasksFile); return STATUS_CODE_FAILURE;
+	}
+
+	//Building both columns, then the header, and writing the container
+	if ((STATUS_CODE_SUCCESS == buildTasksColumn(p_mappedTasksFile, &p_tasksColumn, &p_rowsOffsets, &numberOfRows)) &&
+		(STATUS_CODE_SUCCESS == buildPrioritiesColumn(p_mappedPrioritiesFile, p_rowsOffsets, numberOfRows, &p_prioritiesColumn, &p_deadlinesColumn, &numberOfPriorities, &hasDeadlines))) {
+		memset(&header, 0, sizeof(tasksContainerHeader));
+		memcpy(header.magic, TASKS_CONTAINER_MAGIC, TASKS_CONTAINER_MAGIC_LENGTH);
+		header.version = TASKS_CONTAINER_VERSION;
+		header.flags = TASKS_CONTAINER_HAS_PRIORITIES | TASKS_CONTAINER_HAS_CHECKSUM;
+		header.numberOfTasks = numberOfRows;
+		header.numberOfPriorities = numberOfPriorities;
+		header.tasksColumnOffset = sizeof(tasksContainerHeader);
+		header.prioritiesColumnOffset = header.tasksColumnOffset + numberOfRows * sizeof(DWORD);
+		header.payloadSize = header.prioritiesColumnOffset + numberOfPriorities * sizeof(DWORD);
+		header.checksum = calculateBufferHash(calculateBufferHash(BUFFER_HASH_INITIAL_VALUE, (const BYTE*)p_tasksColumn, numberOfRows * sizeof(DWORD)),
+			(const BYTE*)p_prioritiesColumn, numberOfPriorities * sizeof(DWORD));
+		//The deadlines column (only if any priority has a deadline) directly follows the priorities column
+		if (TRUE == hasDeadlines) {
+			header.flags |= TASKS_CONTAINER_HAS_DEADLINES;
+			header.payloadSize += numberOfPriorities * sizeof(DWORD);
+			header.checksum = calculateBufferHash(header.checksum, (const BYTE*)p_deadlinesColumn, numberOfPriorities * sizeof(DWORD));
+		}
+		if (STATUS_CODE_SUCCESS == (retVal = writeTasksContainer(p_containerFilePath, &header, p_tasksColumn, p_prioritiesColumn, (TRUE == hasDeadlines) ? p_deadlinesColumn : NULL)))
+			printf("Tasks container '%s' was created with %llu tasks & %llu priorities%s.\n", p_containerFilePath, numberOfRows, numberOfPriorities, (TRUE == hasDeadlines) ? " with deadlines" : "");
+	}
+
+	//Freeing the columns & unmapping the text files
+	if (NULL != p_tasksColumn) free(p_tasksColumn);
+	if (NULL != p_rowsOffsets) free(p_rowsOffsets);
+	if (NULL != p_prioritiesColumn) free(p_prioritiesColumn);
+	if (NULL != p_deadlinesColumn) free(p_deadlinesColumn);
+	unmapFile(&p_mappedPrioritiesFile);
+	unmapFile(&p_mappedTasksFile);
+	return retVal;
+}
+
+BOOL isTasksContainerFile(char* p_filePath)
+{
+	tasksContainerHeader header;
+	//Input integrity validation
+	if (NULL == p_filePath) return FALSE;
+
+	//A container is recognized by its' header's magic
+	return readTasksContainerHeader(p_filePath, &header);
+}
+
+tasksContainer* loadTasksContainer(char* p_containerFilePath, BOOL verifyChecksum)
+{
+	tasksContainer* p_container = NULL;
+	tasksContainerHeader header;
+	DWORDLONG checksum = 0;
+	//Input integrity validation
+	if (NULL == p_containerFilePath) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Reading the header first, to know how many bytes to map (anything beyond the payload isn't a part of the container)
+	if (FALSE == readTasksContainerHeader(p_containerFilePath, &header)) {
+		printf("Error: The file '%s' isn't a tasks container.\n", p_containerFilePath); return NULL;
+	}
+	if (sizeof(tasksContainerHeader) > header.payloadSize) {
+		printf("Error: The tasks container '%s' has an invalid header.\n", p_containerFilePath); return NULL;
+	}
+
+	//Allocating dynamic memory for the container struct
+	if (NULL == (p_container = (tasksContainer*)calloc(sizeof(tasksContainer), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for a tasks container struct.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+
+	//Mapping the payload (header & columns)
+	if (NULL == (p_container->p_mappedContainer = mapFileForReading(p_containerFilePath, header.payloadSize))) {
+		unloadTasksContainer(&p_container); return NULL;
+	}
+	p_container->p_header = (tasksContainerHeader*)p_container->p_mappedContainer->p_view;
+	if (STATUS_CODE_SUCCESS != validateTasksContainerHeader(p_container->p_header, p_container->p_mappedContainer->numberOfBytes)) {
+		printf("Error: The tasks container '%s' has an invalid header.\n", p_containerFilePath);
+		unloadTasksContainer(&p_container); return NULL;
+	}
+
+	//Directing the columns' pointers into the view (no copies)
+	p_container->p_tasksColumn = (const DWORD*)(p_container->p_mappedContainer->p_view + p_container->p_header->tasksColumnOffset);
+	if (p_container->p_header->flags & TASKS_CONTAINER_HAS_PRIORITIES)
+		p_container->p_prioritiesColumn = (const DWORD*)(p_container->p_mappedContainer->p_view + p_container->p_header->prioritiesColumnOffset);
+	if (p_container->p_header->flags & TASKS_CONTAINER_HAS_DEADLINES)
+		p_container->p_deadlinesColumn = p_container->p_prioritiesColumn + p_container->p_header->numberOfPriorities;
+
+	//Validating the checksum (a pass over all of the columns) only if requested
+	if ((TRUE == verifyChecksum) && (p_container->p_header->flags & TASKS_CONTAINER_HAS_CHECKSUM)) {
+		checksum = calculateBufferHash(BUFFER_HASH_INITIAL_VALUE, (const BYTE*)p_container->p_tasksColumn, p_container->p_header->numberOfTasks * sizeof(DWORD));
+		if (NULL != p_container->p_prioritiesColumn)
+			checksum = calculateBufferHash(checksum, (const BYTE*)p_container->p_prioritiesColumn, p_container->p_header->numberOfPriorities * sizeof(DWORD));
+		if (NULL != p_container->p_deadlinesColumn)
+			checksum = calculateBufferHash(checksum, (const BYTE*)p_container->p_deadlinesColumn, p_container->p_header->numberOfPriorities * sizeof(DWORD));
+		if (checksum != p_container->p_header->checksum) {
+			printf("Error: The tasks container '%s' is corrupted (checksum mismatch).\n", p_containerFilePath);
+			unloadTasksContainer(&p_container); return NULL;
+		}
+	}
+
+	//Loading the container was successful
+	printf("Tasks container loaded with %llu tasks.\n", p_container->p_header->numberOfTasks);
+	return p_container;
+}
+
+BOOL fetchContainerTaskByPriority(tasksContainer* p_container, DWORDLONG position, PDWORDLONG p_task)
+{
+	DWORDLONG row = 0;
+	//Input integrity validation
+	if ((NULL == p_container) || (NULL == p_task)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Translating the position to a row (by the priorities column, or directly), repeating the last position beyond the order
+	if (NULL != p_container->p_prioritiesColumn) {
+		if (position >= p_container->p_header->numberOfPriorities) position = p_container->p_header->numberOfPriorities - 1;
+		row = p_container->p_prioritiesColumn[position];
+	}
+	else row = (position < p_container->p_header->numberOfTasks) ? position : p_container->p_header->numberOfTasks - 1;
+
+	//Validating the row lies within the tasks column
+	if (row >= p_container->p_header->numberOfTasks) {
+		printf("Error: Priority no. %llu points at row %llu, beyond the %llu tasks in the container.\n", position, row, p_container->p_header->numberOfTasks);
+		return STATUS_CODE_FAILURE;
+	}
+	*p_task = p_container->p_tasksColumn[row];
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL fetchContainerDeadlineByPriority(tasksContainer* p_container, DWORDLONG position, LPDWORD p_deadline)
+{
+	//Input integrity validation
+	if ((NULL == p_container) || (NULL == p_deadline)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//No deadlines column - no task has a deadline
+	if (NULL == p_container->p_deadlinesColumn) {
+		*p_deadline = TASK_DEADLINE_NONE;
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//The deadlines are parallel to the priorities, repeating the last one beyond the order
+	if (position >= p_container->p_header->numberOfPriorities) position = p_container->p_header->numberOfPriorities - 1;
+	*p_deadline = p_container->p_deadlinesColumn[position];
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL unloadTasksContainer(tasksContainer** p_p_container)
+{
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_p_container) || (NULL == *p_p_container)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Unmapping the container & freeing its' struct
+	if (NULL != (*p_p_container)->p_mappedContainer) retVal = unmapFile(&((*p_p_container)->p_mappedContainer));
+	free(*p_p_container);
+	*p_p_container = NULL;
+	return retVal;
+}
+
+
+
+//......................................Static functions..........................................
+
+static BOOL buildTasksColumn(mappedFile* p_mappedTasksFile, LPDWORD* p_p_tasksColumn, PDWORDLONG* p_p_rowsOffsets, PDWORDLONG p_numberOfRows)
+{
+	DWORDLONG offset = 0, nextLineOffset = 0, task = 0, rowsCapacity = INITIAL_ROWS_CAPACITY;
+	LPDWORD p_grownTasksColumn = NULL;
+	PDWORDLONG p_grownRowsOffsets = NULL;
+	//Asserts
+	assert(NULL != p_mappedTasksFile);
+	assert(NULL != p_p_tasksColumn);
+	assert(NULL != p_p_rowsOffsets);
+	assert(NULL != p_numberOfRows);
+
+	//Initial columns allocation
+	*p_numberOfRows = 0;
+	if ((NULL == (*p_p_tasksColumn = (LPDWORD)calloc(sizeof(DWORD), (size_t)rowsCapacity))) ||
+		(NULL == (*p_p_rowsOffsets = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)rowsCapacity)))) {
+		printf("Error: Failed to allocate memory for the tasks column.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Every line that holds a number is a task (solutions' lines are skipped)
+	for (offset = 0; offset < p_mappedTasksFile->numberOfBytes; offset = nextLineOffset) {
+		if (FALSE == parseNumberFromMappedFile(p_mappedTasksFile, offset, &task, &nextLineOffset)) continue;
+		if (MAXDWORD < task) {
+			printf("Error: Task %llu at byte-offset %llu exceeds the supported tasks' range.\n", task, offset);
+			return STATUS_CODE_FAILURE;
+		}
+
+		//Doubling the columns' capacity if needed
+		if (*p_numberOfRows == rowsCapacity) {
+			rowsCapacity *= 2;
+			if (NULL == (p_grownTasksColumn = (LPDWORD)realloc(*p_p_tasksColumn, (size_t)(sizeof(DWORD) * rowsCapacity)))) {
+				printf("Error: Failed to grow the tasks column to %llu rows.\n", rowsCapacity); return STATUS_CODE_FAILURE;
+			}
+			*p_p_tasksColumn = p_grownTasksColumn;
+			if (NULL == (p_grownRowsOffsets = (PDWORDLONG)realloc(*p_p_rowsOffsets, (size_t)(sizeof(DWORDLONG) * rowsCapacity)))) {
+				printf("Error: Failed to grow the rows' offsets array to %llu rows.\n", rowsCapacity); return STATUS_CODE_FAILURE;
+			}
+			*p_p_rowsOffsets = p_grownRowsOffsets;
+		}
+
+		//Appending the row
+		(*p_p_tasksColumn)[*p_numberOfRows] = (DWORD)task;
+		(*p_p_rowsOffsets)[*p_numberOfRows] = offset;
+		*p_numberOfRows += 1;
+	}
+
+	//Validating the file has tasks at all (rows are addressed by DWORDs in the priorities column)
+	if ((0 == *p_numberOfRows) || (MAXDWORD < *p_numberOfRows)) {
+		printf("Error: The Tasks file holds %llu tasks, which can't be stored in a container.\n", *p_numberOfRows);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL buildPrioritiesColumn(mappedFile* p_mappedPrioritiesFile, PDWORDLONG p_rowsOffsets, DWORDLONG numberOfRows,
+	LPDWORD* p_p_prioritiesColumn, LPDWORD* p_p_deadlinesColumn, PDWORDLONG p_numberOfPriorities, BOOL* p_hasDeadlines)
+{
+	DWORDLONG offset = 0, nextLineOffset = 0, taskOffset = 0, deadline = 0, low = 0, high = 0, middle = 0, prioritiesCapacity = INITIAL_ROWS_CAPACITY;
+	LPDWORD p_grownPrioritiesColumn = NULL;
+	//Asserts
+	assert(NULL != p_mappedPrioritiesFile);
+	assert(NULL != p_rowsOffsets);
+	assert(NULL != p_p_prioritiesColumn);
+	assert(NULL != p_p_deadlinesColumn);
+	assert(NULL != p_numberOfPriorities);
+	assert(NULL != p_hasDeadlines);
+
+	//Initial columns allocation
+	*p_numberOfPriorities = 0;
+	*p_hasDeadlines = FALSE;
+	if ((NULL == (*p_p_prioritiesColumn = (LPDWORD)calloc(sizeof(DWORD), (size_t)prioritiesCapacity))) ||
+		(NULL == (*p_p_deadlinesColumn = (LPDWORD)calloc(sizeof(DWORD), (size_t)prioritiesCapacity)))) {
+		printf("Error: Failed to allocate memory for the priorities column.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Translating every byte-offset to a row (lines without a number, e.g. a trailing empty line, are skipped)
+	for (offset = 0; offset < p_mappedPrioritiesFile->numberOfBytes; offset = nextLineOffset) {
+		if (FALSE == parseNumberFromMappedFile(p_mappedPrioritiesFile, offset, &taskOffset, &nextLineOffset)) continue;
+
+		//Binary search over the (strictly increasing) rows' offsets
+		low = 0; high = numberOfRows;
+		while (low < high) {
+			middle = low + (high - low) / 2;
+			if (p_rowsOffsets[middle] < taskOffset) low = middle + 1;
+			else high = middle;
+		}
+		if ((low == numberOfRows) || (p_rowsOffsets[low] != taskOffset)) {
+			printf("Error: No task in the Tasks file begins at the prioritized byte-offset %llu.\n", taskOffset);
+			return STATUS_CODE_FAILURE;
+		}
+
+		//Doubling the column's capacity if needed
+		if (*p_numberOfPriorities == prioritiesCapacity) {
+			prioritiesCapacity *= 2;
+			if (NULL == (p_grownPrioritiesColumn = (LPDWORD)realloc(*p_p_prioritiesColumn, (size_t)(sizeof(DWORD) * prioritiesCapacity)))) {
+				printf("Error: Failed to grow the priorities column to %llu rows.\n", prioritiesCapacity); return STATUS_CODE_FAILURE;
+			}
+			*p_p_prioritiesColumn = p_grownPrioritiesColumn;
+			if (NULL == (p_grownPrioritiesColumn = (LPDWORD)realloc(*p_p_deadlinesColumn, (size_t)(sizeof(DWORD) * prioritiesCapacity)))) {
+				printf("Error: Failed to grow the deadlines column to %llu rows.\n", prioritiesCapacity); return STATUS_CODE_FAILURE;
+			}
+			*p_p_deadlinesColumn = p_grownPrioritiesColumn;
+		}
+		(*p_p_prioritiesColumn)[*p_numberOfPriorities] = (DWORD)low;
+
+		//The line's optional deadline (second column)
+		if (FALSE == parseLineColumnFromMappedFile(p_mappedPrioritiesFile, offset, 1, &deadline)) deadline = TASK_DEADLINE_NONE;
+		else if (TASK_DEADLINE_NONE <= deadline) {
+			printf("Error: The deadline %llu of the prioritized byte-offset %llu exceeds the supported deadlines' range.\n", deadline, taskOffset);
+			return STATUS_CODE_FAILURE;
+		}
+		else *p_hasDeadlines = TRUE;
+		(*p_p_deadlinesColumn)[*p_numberOfPriorities] = (DWORD)deadline;
+		*p_numberOfPriorities += 1;
+	}
+
+	//Validating the file has priorities at all
+	if (0 == *p_numberOfPriorities) {
+		printf("Error: The Tasks Priorities file holds no priorities.\n");
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL writeTasksContainer(char* p_containerFilePath, tasksContainerHeader* p_header, LPDWORD p_tasksColumn, LPDWORD p_prioritiesColumn, LPDWORD p_deadlinesColumn)
+{
+	HANDLE h_containerFile = INVALID_HANDLE_VALUE;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_containerFilePath);
+	assert(NULL != p_header);
+	assert(NULL != p_tasksColumn);
+
+	//Creating the container file (overwriting an existing file)
+	h_containerFile = CreateFile(
+		p_containerFilePath,					// Const null - terminated string describing the file's path
+		GENERIC_WRITE,							// Desired Access is set to Writing mode
+		0,										// No sharing while the container is written
+		NULL,									// No Security Attributes
+		CREATE_ALWAYS,							// A new container replaces an existing one
+		FILE_ATTRIBUTE_NORMAL,					// General writing in files
+		NULL									// No Template
+	);
+	if (INVALID_HANDLE_VALUE == h_containerFile) {
+		printf("Error: Failed to create the tasks container file '%s', with code: %d.\n", p_containerFilePath, GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Writing the header & the columns sequentially
+	retVal = (STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_containerFile, p_header, sizeof(tasksContainerHeader))) &&
+		(STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_containerFile, p_tasksColumn, p_header->numberOfTasks * sizeof(DWORD))) &&
+		((NULL == p_prioritiesColumn) || (STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_containerFile, p_prioritiesColumn, p_header->numberOfPriorities * sizeof(DWORD)))) &&
+		((NULL == p_deadlinesColumn) || (STATUS_CODE_SUCCESS == writeEntireBufferToFile(h_containerFile, p_deadlinesColumn, p_header->numberOfPriorities * sizeof(DWORD))));
+
+	if (FALSE == CloseHandle(h_containerFile)) {
+		printf("Error: Failed to close the tasks container file handle with code: %d.\n", GetLastError());
+		retVal = STATUS_CODE_FAILURE;
+	}
+	return retVal;
+}
+
+static BOOL readTasksContainerHeader(char* p_filePath, tasksContainerHeader* p_header)
+{
+	HANDLE h_file = INVALID_HANDLE_VALUE;
+	DWORD numberOfBytesRead = 0;
+	BOOL retVal = FALSE;
+	//Asserts
+	assert(NULL != p_filePath);
+	assert(NULL != p_header);
+
+	//Opening the file for reading (other handles may still read & write)
+	h_file = CreateFile(p_filePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == h_file) return FALSE;
+
+	//Reading the header & matching the magic
+	retVal = (FALSE != ReadFile(h_file, p_header, sizeof(tasksContainerHeader), &numberOfBytesRead, NULL)) &&
+		(sizeof(tasksContainerHeader) == numberOfBytesRead) &&
+		(0 == memcmp(p_header->magic, TASKS_CONTAINER_MAGIC, TASKS_CONTAINER_MAGIC_LENGTH));
+	CloseHandle(h_file);
+	return retVal;
+}
+
+static BOOL validateTasksContainerHeader(tasksContainerHeader* p_header, DWORDLONG fileSize)
+{
+	//Asserts
+	assert(NULL != p_header);
+
+	//Version & rows validation
+	if ((TASKS_CONTAINER_VERSION != p_header->version) || (0 == p_header->numberOfTasks) || (MAXDWORD < p_header->numberOfTasks)) return STATUS_CODE_FAILURE;
+	if ((p_header->payloadSize > fileSize) || (p_header->tasksColumnOffset < sizeof(tasksContainerHeader))) return STATUS_CODE_FAILURE;
+
+	//Columns' bounds validation (the columns must lie entirely within the payload)
+	if ((p_header->tasksColumnOffset > p_header->payloadSize) ||
+		(p_header->numberOfTasks > (p_header->payloadSize - p_header->tasksColumnOffset) / sizeof(DWORD))) return STATUS_CODE_FAILURE;
+	if (p_header->flags & TASKS_CONTAINER_HAS_PRIORITIES) {
+		if ((0 == p_header->numberOfPriorities) || (p_header->prioritiesColumnOffset < sizeof(tasksContainerHeader)) ||
+			(p_header->prioritiesColumnOffset > p_header->payloadSize) ||
+			(p_header->numberOfPriorities > (p_header->payloadSize - p_header->prioritiesColumnOffset) / sizeof(DWORD))) return STATUS_CODE_FAILURE;
+	}
+	//The deadlines column follows the priorities column - it must lie within the payload too
+	if (p_header->flags & TASKS_CONTAINER_HAS_DEADLINES) {
+		if ((0 == (p_header->flags & TASKS_CONTAINER_HAS_PRIORITIES)) ||
+			(p_header->numberOfPriorities > (p_header->payloadSize - p_header->prioritiesColumnOffset) / sizeof(DWORD) / 2)) return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
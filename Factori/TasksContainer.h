@@ -0,0 +1,78 @@
+/* TasksContainer.h
+------------------------------------------------------------
+	Module Description - header module for TasksContainer.c
+------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __TASKS_CONTAINER_H__
+#define __TASKS_CONTAINER_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MappedFile.h"
+
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function converts a Tasks list text file & a Tasks Priorities list text file into a tasks container file.
+///		Both text files are mapped & parsed once: every line of the Tasks file that holds a number becomes a row in the tasks column
+///		(solution lines are skipped), and every byte-offset in the Tasks Priorities file is translated to the row of the task it points at.
+///		If any priorities line has a second column (a deadline in milli-seconds), a deadlines column follows the priorities column.
+///		The container (header, tasks column, priorities column & checksum) is then written to 'p_containerFilePath' (overwritten if exists).
+/// </summary>
+/// <param name="char* p_tasksListFilePath - A pointer to the Tasks list text file's path (absolute\relative)"></param>
+/// <param name="char* p_tasksPrioritiesListFilePath - A pointer to the Tasks Priorities list text file's path (absolute\relative)"></param>
+/// <param name="char* p_containerFilePath - A pointer to the output container file's path (absolute\relative)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL convertTextFilesToTasksContainer(char* p_tasksListFilePath, char* p_tasksPrioritiesListFilePath, char* p_containerFilePath);
+/// <summary>
+///	 Description - This function checks whether a file begins with a tasks container header (TASKS_CONTAINER_MAGIC).
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the file's path (absolute\relative)"></param>
+/// <returns>TRUE if the file is a tasks container, FALSE otherwise (including a missing or a too short file)</returns>
+BOOL isTasksContainerFile(char* p_filePath);
+/// <summary>
+///	 Description - This function reads & validates a tasks container's header and maps the container's payload (header & columns)
+///		to a read-only view. No parsing is made - the columns are accessed in place. The checksum is validated only if requested,
+///		since it requires a pass over all of the columns.
+/// </summary>
+/// <param name="char* p_containerFilePath - A pointer to the container file's path (absolute\relative)"></param>
+/// <param name="BOOL verifyChecksum - TRUE for validating the container's checksum (if it has one)"></param>
+/// <returns>A pointer to a dynamically allocated 'tasksContainer' struct if successful, or NULL if failed</returns>
+tasksContainer* loadTasksContainer(char* p_containerFilePath, BOOL verifyChecksum);
+/// <summary>
+///	 Description - This function fetches the value of the task at position 'position' of the container's priority order (the rows order
+///		if there is no priorities column). Positions beyond the priority order repeat its' last task (as with a short Tasks Priorities file).
+/// </summary>
+/// <param name="tasksContainer* p_container - A pointer to a loaded 'tasksContainer' struct"></param>
+/// <param name="DWORDLONG position - The (0-based) position of the task in the priority order"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a priority pointing beyond the tasks column</returns>
+BOOL fetchContainerTaskByPriority(tasksContainer* p_container, DWORDLONG position, PDWORDLONG p_task);
+/// <summary>
+///	 Description - This function fetches the deadline of the task at position 'position' of the container's priority order. Positions
+///		beyond the priority order repeat its' last deadline.
+/// </summary>
+/// <param name="tasksContainer* p_container - A pointer to a loaded 'tasksContainer' struct"></param>
+/// <param name="DWORDLONG position - The (0-based) position of the task in the priority order"></param>
+/// <param name="LPDWORD p_deadline - A pointer to the variable that will be updated with the deadline (milli-seconds, TASK_DEADLINE_NONE if the container has no deadlines column)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL fetchContainerDeadlineByPriority(tasksContainer* p_container, DWORDLONG position, LPDWORD p_deadline);
+/// <summary>
+///	 Description - This function unmaps a loaded tasks container, frees its' struct and sets its' pointer to NULL.
+/// </summary>
+/// <param name="tasksContainer** p_p_container - A pointer to a pointer to a 'tasksContainer' struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL unloadTasksContainer(tasksContainer** p_p_container);
+
+
+#endif //__TASKS_CONTAINER_H__
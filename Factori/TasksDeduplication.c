@@ -0,0 +1,140 @@
+/* TasksDeduplication.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for grouping identical
+		values among the tasks to solve, before solving begins: every distinct value
+		is solved once, and its' solution is written once for every occurrence.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "TasksDeduplication.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const DWORD SINGLE_OBJECT = 1;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - qsort comparison function - orders 'prioritizedTask' structs by value, and identical values by position.
+/// </summary>
+/// <param name="const void* p_first - A pointer to the first 'prioritizedTask'"></param>
+/// <param name="const void* p_second - A pointer to the second 'prioritizedTask'"></param>
+/// <returns>A negative, zero or positive integer as the first task is ordered before, with or after the second</returns>
+static int compareTasksByValue(const void* p_first, const void* p_second);
+/// <summary>
+///  Description - qsort comparison function - orders 'prioritizedTask' structs by position.
+/// </summary>
+/// <param name="const void* p_first - A pointer to the first 'prioritizedTask'"></param>
+/// <param name="const void* p_second - A pointer to the second 'prioritizedTask'"></param>
+/// <returns>A negative, zero or positive integer as the first task is ordered before, with or after the second</returns>
+static int compareTasksByPosition(const void* p_first, const void* p_second);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+deduplicatedTasks* deduplicateTasks(PDWORDLONG p_tasksValues, DWORDLONG numberOfTasks)
+{
+	deduplicatedTasks* p_deduplicatedTasks = NULL;
+	prioritizedTask* p_tasks = NULL;
+	DWORDLONG taskIndex = 0, numberOfDistinctTasks = 0;
+	PDWORDLONG p_numberOfOccurrences = NULL;
+	//Input integrity validation
+	if ((NULL == p_tasksValues) && (0 < numberOfTasks)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the distinct tasks struct & its' arrays (at most one distinct value per task)
+	if ((NULL == (p_deduplicatedTasks = (deduplicatedTasks*)calloc(sizeof(deduplicatedTasks), SINGLE_OBJECT))) ||
+		(NULL == (p_tasks = (prioritizedTask*)calloc(sizeof(prioritizedTask), (size_t)numberOfTasks + 1))) ||
+		(NULL == (p_deduplicatedTasks->p_distinctValues = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)numberOfTasks + 1))) ||
+		(NULL == (p_numberOfOccurrences = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)numberOfTasks + 1)))) {
+		printf("Error: Failed to allocate memory for the tasks' de-duplication.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_tasks);
+		destroyDeduplicatedTasks(&p_deduplicatedTasks);
+		return NULL;
+	}
+	p_deduplicatedTasks->p_numberOfOccurrences = p_numberOfOccurrences;
+	p_deduplicatedTasks->numberOfTasks = numberOfTasks;
+
+	//Pairing every task's value with its' position in the priority order & grouping identical values together
+	for (taskIndex = 0; taskIndex < numberOfTasks; taskIndex++) {
+		(p_tasks + taskIndex)->value = *(p_tasksValues + taskIndex);
+		(p_tasks + taskIndex)->position = taskIndex;
+	}
+	qsort(p_tasks, (size_t)numberOfTasks, sizeof(prioritizedTask), compareTasksByValue);
+
+	//Collapsing every group to its' first occurrence (the group's lowest position), while counting the group's occurrences
+	for (taskIndex = 0; taskIndex < numberOfTasks; taskIndex++) {
+		if ((0 < numberOfDistinctTasks) && ((p_tasks + numberOfDistinctTasks - 1)->value == (p_tasks + taskIndex)->value)) {
+			(*(p_numberOfOccurrences + (p_tasks + numberOfDistinctTasks - 1)->position))++;
+			continue;
+		}
+		*(p_tasks + numberOfDistinctTasks) = *(p_tasks + taskIndex);
+		*(p_numberOfOccurrences + (p_tasks + taskIndex)->position) = 1;
+		numberOfDistinctTasks++;
+	}
+
+	//Ordering the distinct tasks by the priority of their first occurrence (the occurrences were counted by that position, and are
+	// moved in place - a distinct task's index never exceeds its' first occurrence's position)
+	qsort(p_tasks, (size_t)numberOfDistinctTasks, sizeof(prioritizedTask), compareTasksByPosition);
+	for (taskIndex = 0; taskIndex < numberOfDistinctTasks; taskIndex++) {
+		*(p_deduplicatedTasks->p_distinctValues + taskIndex) = (p_tasks + taskIndex)->value;
+		*(p_numberOfOccurrences + taskIndex) = *(p_numberOfOccurrences + (p_tasks + taskIndex)->position);
+	}
+	p_deduplicatedTasks->numberOfDistinctTasks = numberOfDistinctTasks;
+
+	//Free the sorting array
+	free(p_tasks);
+
+	printf("%llu tasks were de-duplicated into %llu distinct tasks.\n", numberOfTasks, numberOfDistinctTasks);
+	return p_deduplicatedTasks;
+}
+
+void destroyDeduplicatedTasks(deduplicatedTasks** p_p_deduplicatedTasks)
+{
+	//Input integrity validation
+	if ((NULL == p_p_deduplicatedTasks) || (NULL == *p_p_deduplicatedTasks)) return;
+
+	//Free the arrays & the struct
+	free((*p_p_deduplicatedTasks)->p_distinctValues);
+	free((*p_p_deduplicatedTasks)->p_numberOfOccurrences);
+	free(*p_p_deduplicatedTasks);
+	*p_p_deduplicatedTasks = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static int compareTasksByValue(const void* p_first, const void* p_second)
+{
+	const prioritizedTask* p_firstTask = (const prioritizedTask*)p_first;
+	const prioritizedTask* p_secondTask = (const prioritizedTask*)p_second;
+
+	if (p_firstTask->value != p_secondTask->value) return (p_firstTask->value < p_secondTask->value) ? -1 : 1;
+	return compareTasksByPosition(p_first, p_second);
+}
+
+static int compareTasksByPosition(const void* p_first, const void* p_second)
+{
+	const prioritizedTask* p_firstTask = (const prioritizedTask*)p_first;
+	const prioritizedTask* p_secondTask = (const prioritizedTask*)p_second;
+
+	if (p_firstTask->position == p_secondTask->position) return 0;
+	return (p_firstTask->position < p_secondTask->position) ? -1 : 1;
+}
@@ -0,0 +1,39 @@
+/* TasksDeduplication.h
+----------------------------------------------------------------
+	Module Description - header module for TasksDeduplication.c
+----------------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __TASKS_DEDUPLICATION_H__
+#define __TASKS_DEDUPLICATION_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function groups identical values among the tasks to solve. The tasks are sorted by value (ties by priority),
+///		every run of identical values becomes a single distinct task that counts its' occurrences, and the distinct tasks are then
+///		sorted back by the priority of their first occurrence.
+/// </summary>
+/// <param name="PDWORDLONG p_tasksValues - A pointer to the tasks' values array, in priority order (p_tasksValues[0] is the most prioritized)"></param>
+/// <param name="DWORDLONG numberOfTasks - The number of tasks in the array"></param>
+/// <returns>A pointer to a dynamically allocated 'deduplicatedTasks' struct if successful, or NULL if failed</returns>
+deduplicatedTasks* deduplicateTasks(PDWORDLONG p_tasksValues, DWORDLONG numberOfTasks);
+/// <summary>
+///	 Description - This function frees a 'deduplicatedTasks' struct with its' arrays and sets its' pointer to NULL.
+/// </summary>
+/// <param name="deduplicatedTasks** p_p_deduplicatedTasks - A pointer to a pointer to a 'deduplicatedTasks' struct"></param>
+void destroyDeduplicatedTasks(deduplicatedTasks** p_p_deduplicatedTasks);
+
+
+#endif //__TASKS_DEDUPLICATION_H__
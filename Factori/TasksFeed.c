@@ -0,0 +1,356 @@
+/* TasksFeed.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for dispatching the tasks
+		from a priority heap, which is modified while the threads solve the tasks: new
+		tasks are inserted, & waiting tasks are reprioritized or canceled
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "TasksFeed.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const BOOL  MANUAL_RESET_EVENT = TRUE;
+static const BOOL  INITIALLY_NON_SIGNALLED = FALSE;
+
+static const int   INSERT_COMMAND_ARGUMENTS = 2;
+static const int   REPRIORITIZE_COMMAND_ARGUMENTS = 2;
+static const int   CANCEL_COMMAND_ARGUMENTS = 1;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function write-locks the Priorities Queue lock, which guards the tasks feed.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL lockTasksFeed(threadPackage* p_params);
+/// <summary>
+///  Description - This function signals the tasks' availability event ON (the heap has tasks or the feed is closed) or OFF, according to the
+///		modified feed, and releases the Priorities Queue lock.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (the feed is locked)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL releaseTasksFeed(threadPackage* p_params);
+/// <summary>
+///  Description - This function executes a single tasks feed file command (see feedTasksFromFile(.)).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="char* p_commandLine - The command's line (null-terminated, without the newline)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a malformed command</returns>
+static BOOL executeTasksFeedCommand(threadPackage* p_params, char* p_commandLine);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+BOOL buildTasksFeed(threadPackage* p_params)
+{
+	PDWORDLONG p_tasksValues = NULL;
+	DWORDLONG taskIndex = 0;
+	//Input integrity validation
+	if (NULL == p_params) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Fetching all the tasks' values in priority order
+	if (NULL == (p_tasksValues = fetchAllTasksInPriorityOrder(p_params))) return STATUS_CODE_FAILURE;
+
+	//Memory allocation for the feed, its' heap & its' event
+	if ((NULL == (p_params->p_tasksFeed = (tasksFeed*)calloc(sizeof(tasksFeed), SINGLE_OBJECT))) ||
+		(NULL == (p_params->p_tasksFeed->p_heap = InitializePriorityHeap(p_params->numberOfTasks))) ||
+		(NULL == (p_params->p_tasksFeed->p_h_tasksAvailableEvent = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT)))) {
+		printf("Error: Failed to allocate memory for the tasks feed.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_tasksValues);
+		return STATUS_CODE_FAILURE;
+	}
+	if (NULL == (*(p_params->p_tasksFeed->p_h_tasksAvailableEvent) = CreateEvent(NULL, MANUAL_RESET_EVENT, INITIALLY_NON_SIGNALLED, NULL))) {
+		printf("Error: Failed to create the tasks feed's event with code: %d.\n", GetLastError());
+		free(p_params->p_tasksFeed->p_h_tasksAvailableEvent);
+		p_params->p_tasksFeed->p_h_tasksAvailableEvent = NULL;
+		free(p_tasksValues);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Inserting the tasks in priority order - a task's position is both its' priority & its' identifier
+	for (taskIndex = 0; taskIndex < p_params->numberOfTasks; taskIndex++) {
+		if (STATUS_CODE_SUCCESS != HeapInsert(p_params->p_tasksFeed->p_heap, *(p_tasksValues + taskIndex), (LONGLONG)taskIndex, NULL)) {
+			free(p_tasksValues);
+			return STATUS_CODE_FAILURE;
+		}
+	}
+	if (0 < p_params->numberOfTasks) SetEvent(*(p_params->p_tasksFeed->p_h_tasksAvailableEvent));
+
+	//The positions cursor's counters were used for fetching the tasks
+	memset((void*)p_params->chunkSizesHistogram, 0, sizeof(p_params->chunkSizesHistogram));
+	free(p_tasksValues);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL feedTask(threadPackage* p_params, DWORDLONG value, LONGLONG priority, PDWORDLONG p_id)
+{
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	//------------------locked
+	if (TRUE == p_params->p_tasksFeed->closed) printf("Error: A task was fed after the tasks feed was closed.\n");
+	else if (STATUS_CODE_SUCCESS == (retVal = HeapInsert(p_params->p_tasksFeed->p_heap, value, priority, p_id)))
+		p_params->p_tasksFeed->numberOfFedTasks++;
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	return retVal;
+}
+
+BOOL reprioritizeFedTask(threadPackage* p_params, DWORDLONG id, LONGLONG priority)
+{
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	//------------------locked
+	retVal = HeapReprioritize(p_params->p_tasksFeed->p_heap, id, priority);
+	if (STATUS_CODE_SUCCESS == retVal) p_params->p_tasksFeed->numberOfReprioritizedTasks++;
+	else if (HEAP_ENTRY_NOT_FOUND == retVal) p_params->p_tasksFeed->numberOfIgnoredCommands++;
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	return retVal;
+}
+
+BOOL cancelFedTask(threadPackage* p_params, DWORDLONG id)
+{
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	//------------------locked
+	retVal = HeapCancel(p_params->p_tasksFeed->p_heap, id);
+	if (STATUS_CODE_SUCCESS == retVal) p_params->p_tasksFeed->numberOfCanceledTasks++;
+	else if (HEAP_ENTRY_NOT_FOUND == retVal) p_params->p_tasksFeed->numberOfIgnoredCommands++;
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != releaseTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	return retVal;
+}
+
+BOOL closeTasksFeed(threadPackage* p_params)
+{
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != lockTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+	//------------------locked (the event is signalled ON for good - waiting threads wake up to an empty heap & terminate)
+	p_params->p_tasksFeed->closed = TRUE;
+	//----------------unlocking
+	return releaseTasksFeed(p_params);
+}
+
+BOOL feedTasksFromFile(threadPackage* p_params, char* p_feedFilePath)
+{
+	HANDLE h_feedFile = INVALID_HANDLE_VALUE;
+	char p_buffer[TASKS_FEED_READ_BLOCK_SIZE + 1];
+	DWORD numberOfBufferedBytes = 0, numberOfBytesRead = 0, byteIndex = 0, lineBeginning = 0;
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed) || (NULL == p_feedFilePath)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Opening the feed file (others may keep appending to it)
+	h_feedFile = CreateFile(p_feedFilePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == h_feedFile) {
+		printf("Error: Failed to open the tasks feed file '%s' with code: %d.\n", p_feedFilePath, GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Reading blocks & executing every complete line - a partial line waits at the buffer's beginning for the following block
+	while (STATUS_CODE_SUCCESS == retVal) {
+		if (FALSE == ReadFile(h_feedFile, p_buffer + numberOfBufferedBytes, TASKS_FEED_READ_BLOCK_SIZE - numberOfBufferedBytes, &numberOfBytesRead, NULL)) {
+			//A pipe's writer closing it is the feed's end
+			if (ERROR_BROKEN_PIPE != GetLastError()) {
+				printf("Error: Failed to read the tasks feed file with code: %d.\n", GetLastError());
+				retVal = STATUS_CODE_FAILURE;
+			}
+			break;
+		}
+		if (0 == numberOfBytesRead) break;
+		numberOfBufferedBytes += numberOfBytesRead;
+
+		for (byteIndex = lineBeginning = 0; (byteIndex < numberOfBufferedBytes) && (STATUS_CODE_SUCCESS == retVal); byteIndex++) {
+			if ('\n' != p_buffer[byteIndex]) continue;
+			p_buffer[byteIndex] = '\0';
+			retVal = executeTasksFeedCommand(p_params, p_buffer + lineBeginning);
+			lineBeginning = byteIndex + 1;
+		}
+		numberOfBufferedBytes -= lineBeginning;
+		memmove(p_buffer, p_buffer + lineBeginning, numberOfBufferedBytes);
+		if (TASKS_FEED_READ_BLOCK_SIZE == numberOfBufferedBytes) {
+			printf("Error: A tasks feed command exceeds %d characters.\n", TASKS_FEED_READ_BLOCK_SIZE);
+			retVal = STATUS_CODE_FAILURE;
+		}
+	}
+
+	//The last line may lack a newline
+	if ((STATUS_CODE_SUCCESS == retVal) && (0 < numberOfBufferedBytes)) {
+		p_buffer[numberOfBufferedBytes] = '\0';
+		retVal = executeTasksFeedCommand(p_params, p_buffer);
+	}
+
+	CloseHandle(h_feedFile);
+	return retVal;
+}
+
+BOOL takeMostUrgentFedTask(threadPackage* p_params, PDWORDLONG p_task, PDWORDLONG p_dispatchOrder)
+{
+	BOOL retVal = STATUS_CODE_FAILURE, feedClosed = FALSE;
+	//Input integrity validation
+	if ((NULL == p_params) || (NULL == p_params->p_tasksFeed) || (NULL == p_task) || (NULL == p_dispatchOrder)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	while (TRUE) {
+		if (STATUS_CODE_SUCCESS != lockTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+		//------------------locked
+		if (STATUS_CODE_SUCCESS == (retVal = HeapPop(p_params->p_tasksFeed->p_heap, p_task)))
+			*p_dispatchOrder = p_params->p_tasksFeed->numberOfDispatchedTasks++;
+		feedClosed = p_params->p_tasksFeed->closed;
+		//----------------unlocking
+		if (STATUS_CODE_SUCCESS != releaseTasksFeed(p_params)) return STATUS_CODE_FAILURE;
+
+		if (STATUS_CODE_SUCCESS == retVal) return STATUS_CODE_SUCCESS;
+		if (HEAP_WAS_EMPTY != retVal) return STATUS_CODE_FAILURE;
+		if (TRUE == feedClosed) return TASKS_FEED_EXHAUSTED;
+
+		//Waiting for more tasks (or for the feed's closing) - the event was signalled OFF while the heap was empty
+		if (WAIT_OBJECT_0 != WaitForSingleObject(*(p_params->p_tasksFeed->p_h_tasksAvailableEvent), INFINITE)) {
+			printf("Error: Thread no. %lu failed waiting for fed tasks with code: %d.\n", (unsigned long)GetCurrentThreadId(), GetLastError());
+			return STATUS_CODE_FAILURE;
+		}
+	}
+}
+
+void destroyTasksFeed(tasksFeed** p_p_tasksFeed)
+{
+	//Input integrity validation
+	if ((NULL == p_p_tasksFeed) || (NULL == *p_p_tasksFeed)) return;
+
+	//Close the event's handle, free the heap & the feed struct
+	if (NULL != (*p_p_tasksFeed)->p_h_tasksAvailableEvent) closeHandleProcedure((*p_p_tasksFeed)->p_h_tasksAvailableEvent);
+	DestroyPriorityHeap(&((*p_p_tasksFeed)->p_heap));
+	free(*p_p_tasksFeed);
+	*p_p_tasksFeed = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static BOOL lockTasksFeed(threadPackage* p_params)
+{
+	//Assert
+	assert(NULL != p_params);
+
+	if (STATUS_CODE_SUCCESS != write_lock(p_params->p_prioritiesQueueLock)) {
+		printf("Tasks feed locking failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL releaseTasksFeed(threadPackage* p_params)
+{
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Assert
+	assert(NULL != p_params);
+
+	//Waiting threads may proceed while the heap has tasks, or once no task will ever arrive
+	if ((0 < p_params->p_tasksFeed->p_heap->numberOfEntries) || (TRUE == p_params->p_tasksFeed->closed))
+		retVal = SetEvent(*(p_params->p_tasksFeed->p_h_tasksAvailableEvent));
+	else retVal = ResetEvent(*(p_params->p_tasksFeed->p_h_tasksAvailableEvent));
+	if (FALSE == retVal) printf("Error: Failed to signal the tasks feed's event with code: %d.\n", GetLastError());
+
+	if (STATUS_CODE_SUCCESS != write_release(p_params->p_prioritiesQueueLock)) {
+		printf("Tasks feed lock release failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	return retVal;
+}
+
+static BOOL executeTasksFeedCommand(threadPackage* p_params, char* p_commandLine)
+{
+	DWORDLONG valueOrId = 0;
+	LONGLONG priority = 0;
+	size_t commandLength = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_commandLine);
+
+	//A Windows line ending's carriage return isn't part of the command
+	if ((0 < (commandLength = strlen(p_commandLine))) && ('\r' == p_commandLine[commandLength - 1])) p_commandLine[--commandLength] = '\0';
+	//Skipping empty lines & comments
+	if ((0 == commandLength) || ('#' == p_commandLine[0])) return STATUS_CODE_SUCCESS;
+
+	if (0 == strncmp(p_commandLine, "insert ", strlen("insert "))) {
+		if ((INSERT_COMMAND_ARGUMENTS != sscanf_s(p_commandLine + strlen("insert "), "%llu %lld", &valueOrId, &priority)) || (MAXDWORD < valueOrId)) {
+			printf("Error: Malformed tasks feed command '%s'.\n", p_commandLine);
+			return STATUS_CODE_FAILURE;
+		}
+		return feedTask(p_params, valueOrId, priority, NULL);
+	}
+	if (0 == strncmp(p_commandLine, "reprioritize ", strlen("reprioritize "))) {
+		if (REPRIORITIZE_COMMAND_ARGUMENTS != sscanf_s(p_commandLine + strlen("reprioritize "), "%llu %lld", &valueOrId, &priority)) {
+			printf("Error: Malformed tasks feed command '%s'.\n", p_commandLine);
+			return STATUS_CODE_FAILURE;
+		}
+		retVal = reprioritizeFedTask(p_params, valueOrId, priority);
+	}
+	else if (0 == strncmp(p_commandLine, "cancel ", strlen("cancel "))) {
+		if (CANCEL_COMMAND_ARGUMENTS != sscanf_s(p_commandLine + strlen("cancel "), "%llu", &valueOrId)) {
+			printf("Error: Malformed tasks feed command '%s'.\n", p_commandLine);
+			return STATUS_CODE_FAILURE;
+		}
+		retVal = cancelFedTask(p_params, valueOrId);
+	}
+	else {
+		printf("Error: Unknown tasks feed command '%s'.\n", p_commandLine);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//A task that already began solving (or was canceled) can't be modified - not an error
+	if (HEAP_ENTRY_NOT_FOUND == retVal) {
+		printf("Tasks feed: task %llu already began solving or was canceled - '%s' was ignored.\n", valueOrId, p_commandLine);
+		return STATUS_CODE_SUCCESS;
+	}
+	return retVal;
+}
@@ -0,0 +1,96 @@
+/* TasksFeed.h
+----------------------------------------------------------
+	Module Description - header module for TasksFeed.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __TASKS_FEED_H__
+#define __TASKS_FEED_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "PriorityHeap.h"
+#include "Lock.h"
+#include "MemoryHandling.h"
+#include "TasksSolverThread.h"
+
+
+// Constants ---------------------------------------------------
+#define TASKS_FEED_EXHAUSTED 4		// takeMostUrgentFedTask(.)'s outcome when the feed is closed & the heap is empty - no task will ever arrive
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the runtime tasks feed: it fetches the values of all the tasks to solve (exhausting the Queue or the
+///		container's cursor) & inserts them into a priority heap, every task with its' position in the priority order as both its' priority &
+///		its' identifier. The threads then dispatch from the heap, while more tasks are fed, reprioritized or canceled.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (before any thread was created)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL buildTasksFeed(threadPackage* p_params);
+/// <summary>
+///	 Description - This function feeds a new task to the running threads. Any thread may call it (under the Priorities Queue lock).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <param name="DWORDLONG value - The task's value"></param>
+/// <param name="LONGLONG priority - The task's priority (the lower - the more urgent, the initial tasks' priorities are 0 ... #tasks-1)"></param>
+/// <param name="PDWORDLONG p_id - A pointer to the variable that will be updated with the task's identifier (may be NULL)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. the feed is closed</returns>
+BOOL feedTask(threadPackage* p_params, DWORDLONG value, LONGLONG priority, PDWORDLONG p_id);
+/// <summary>
+///	 Description - This function changes the priority of a task that no thread has begun solving yet.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <param name="DWORDLONG id - The task's identifier"></param>
+/// <param name="LONGLONG priority - The task's new priority"></param>
+/// <returns>Reprioritized (TRUE), the task already began solving or was canceled (HEAP_ENTRY_NOT_FOUND) or Failure (FALSE)</returns>
+BOOL reprioritizeFedTask(threadPackage* p_params, DWORDLONG id, LONGLONG priority);
+/// <summary>
+///	 Description - This function cancels a task that no thread has begun solving yet (its' solution won't be written).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <param name="DWORDLONG id - The task's identifier"></param>
+/// <returns>Canceled (TRUE), the task already began solving or was canceled (HEAP_ENTRY_NOT_FOUND) or Failure (FALSE)</returns>
+BOOL cancelFedTask(threadPackage* p_params, DWORDLONG id);
+/// <summary>
+///	 Description - This function closes the tasks feed: no more tasks will be fed, & the threads terminate once the heap is empty.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL closeTasksFeed(threadPackage* p_params);
+/// <summary>
+///	 Description - This function executes a tasks feed file's commands, one per line, until the file's end (or the pipe's writer closing it):
+///			"insert <value> <priority>" - feed a new task (identifiers are handed out in order, following the initial tasks' positions).
+///			"reprioritize <id> <priority>" - change a waiting task's priority.
+///			"cancel <id>" - cancel a waiting task.
+///		Empty lines & lines beginning with '#' are skipped. Commands on tasks that already began solving are ignored (and counted).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <param name="char* p_feedFilePath - The tasks feed file's path (may also be a named pipe's path)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. a malformed command</returns>
+BOOL feedTasksFromFile(threadPackage* p_params, char* p_feedFilePath);
+/// <summary>
+///	 Description - This function pops the most urgent fed task for a thread. While the heap is empty & the feed is open, the thread waits
+///		for more tasks.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a tasks feed)"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <param name="PDWORDLONG p_dispatchOrder - A pointer to the variable that will be updated with the # of tasks popped before the task"></param>
+/// <returns>Success (TRUE), TASKS_FEED_EXHAUSTED if no task will ever arrive, or Failure (FALSE)</returns>
+BOOL takeMostUrgentFedTask(threadPackage* p_params, PDWORDLONG p_task, PDWORDLONG p_dispatchOrder);
+/// <summary>
+///	 Description - This function frees a tasks feed with its' heap, closes its' event & sets its' pointer to NULL.
+/// </summary>
+/// <param name="tasksFeed** p_p_tasksFeed - A pointer to a pointer to a 'tasksFeed' struct"></param>
+void destroyTasksFeed(tasksFeed** p_p_tasksFeed);
+
+
+#endif //__TASKS_FEED_H__
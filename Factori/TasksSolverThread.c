@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <Windows.h>
 #include <assert.h>
 
@@ -30,17 +31,13 @@ static const DWORD SINGLE_OBJECT = 1;
 
 
 
-static const BOOL POP_QUEUE_WAS_EMPTY = (BOOL)-2;
-
-static const DWORD TIMEOUT_BASE_CONSTANT_MS = 100; //100 milli-second
+static const BOOL NO_TASKS_REMAINING = (BOOL)-3;
 
 	//Write lock constants
 static const BOOL WRITE_ACCESS_GRANTED = TRUE;
 static const BOOL STATUS_FILE_WRITING_FAILED = (BOOL)0;
 static const BOOL STATUS_NEW_END_OF_FILE_SET_FAILED = 0;
 
-	//Read lock constant
-static const BOOL READ_ACCESS_GRANTED = TRUE;
 //static const BOOL STATUS_FILE_READING_FAILED = (BOOL)0; ---->>> in fetchMostPrioritizedTaskSizeInBytes(.) which is in SolveTasks.c module 
 
 
@@ -50,7 +47,7 @@ static const BOOL READ_ACCESS_GRANTED = TRUE;
 // Functions decleraitions ---------------------------------------------------------------
 /// <summary>
 ///  Description - This function allocates (on the Heap - dynamic mem.) memory for a Handle and 
-///		uses CreateFile WINAPI function to create a Handle to the Tasks list file (with Reading and writing permissions).
+///		uses CreateFile WINAPI function to create a Handle to the Tasks list file (with writing permissions - the solutions' appends).
 ///		The file opening routine is also defined to include sharing for both reading and writing requests to enable
 ///		synchronizing between threads attempting to access the file, e.g. in the case of multiple Readers (This sharing permission
 ///		is needed even for the state in which we open multiple handles from different threads, not only when accessing the file simultenously).
@@ -58,18 +55,27 @@ static const BOOL READ_ACCESS_GRANTED = TRUE;
 /// </summary>
 /// <param name="char* p_filePath - A pointer to the commandline argument (string) that represents the Tasks list file's path (absolute\relative)"></param>
 /// <returns>A pointer to a Handle to the Tasks file allocated on the heap if successful, or NULL if failed</returns>
-static HANDLE* openFileForReadingAndWriting(char* p_filePath);
+static HANDLE* openFileForWriting(char* p_filePath);
+/// <summary>
+///  Description - This function allocates (on the Heap - dynamic mem.) memory for a Handle and creates a read-only Handle to the Tasks list
+///		file (shared for reading & writing, since the other threads' writing Handles append to it). The tasks are read through it positionally
+///		(ReadFile with an OVERLAPPED offset), so its' file pointer is never relied upon & the reads need no lock. The reads still move its'
+///		file pointer, so the Handle stays the thread's own - it must not be shared with the writing Handle or with other threads.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the commandline argument (string) that represents the Tasks list file's path (absolute\relative)"></param>
+/// <returns>A pointer to a Handle to the Tasks file allocated on the heap if successful, or NULL if failed</returns>
+static HANDLE* openFileForReading(char* p_filePath);
 /// <summary>
-///  Description - This function scans through the given Tasks-list file (Tasks.txt) data ("file") struct's lines ("line") for the initial byte offset (from the
-///		beginning of the file) that matches the value stored in the input variable taskByteOffsetFromBeginningOfTheFile. The "line" struct 
+///  Description - This function searches the given Tasks-list file (Tasks.txt) data ("file") struct's lines ("line") for the initial byte offset (from the
+///		beginning of the file) that matches the value stored in the input variable taskByteOffsetFromBeginningOfTheFile (binary search). The "line" struct 
 ///		that will have its' initialPositionByByte field's value identical to the input taskByteOffsetFromBeginningOfTheFile, will also hold
 ///		the number of bytes within the line that pocesses the task needed to be fetched (numberOfBytesInLine). The output is the number of bytes in 
 ///		that line (That holds the desired task) in the Tasks file.
 /// </summary>
-/// <param name="file* p_tasksFileData - A pointer to the Tasks-list file data struct assembled with the file's lines' byte-offsets (nested-list)"></param>
-/// <param name="DWORD taskByteOffsetFromBeginningOfTheFile - An unsigned integer representing the initial byte-position of the most prioritized task currently being fetched"></param>
-/// <returns>An unsigned integer representing the number of bytes in the line, in the Tasks file, that holds the task's value's string</returns>
-static DWORD fetchMostPrioritizedTaskSizeInBytes(file* p_tasksFileData, DWORD taskByteOffsetFromBeginningOfTheFile);
+/// <param name="file* p_tasksFileData - A pointer to the Tasks-list file data struct assembled with the file's lines' byte-offsets (array)"></param>
+/// <param name="DWORDLONG taskByteOffsetFromBeginningOfTheFile - An unsigned 64-bit integer representing the initial byte-position of the most prioritized task currently being fetched"></param>
+/// <returns>An unsigned integer representing the number of bytes in the line, in the Tasks file, that holds the task's value's string, or 0 if no line begins at that byte-offset</returns>
+static DWORD fetchMostPrioritizedTaskSizeInBytes(file* p_tasksFileData, DWORDLONG taskByteOffsetFromBeginningOfTheFile);
 /// <summary>
 ///	 Description - This function receives as input a pointer to the Handle of the Tasks-list (Tasks.txt) file, a string describing the decomposition
 ///		of a task's value into the prime factors it is comprised of, and the length of this string in bytes. The function relocates the file's Handle
@@ -80,6 +86,158 @@ static DWORD fetchMostPrioritizedTaskSizeInBytes(file* p_tasksFileData, DWORD ta
 /// <param name="DWORD stringLength - An unsigned integer representing the size of the input task's prime factors string"></param>
 /// <returns>A BOOL value representing the function's outcome (The current task's prime-factors-string was printed to the Tasks file and a new EOF was defined at the string's end). Success (TRUE) or Failure (False)</returns>
 static BOOL printSolvedTaskToTasksListFile(HANDLE* p_h_tasksListFile, LPTSTR p_numberPrimeFactorsString, DWORD stringLength);
+/// <summary>
+///	 Description - This function fetches the value of the most prioritized remaining task when solving from the text files: it claims the
+///		next position of the Tasks Priorities Queue (atomically, without a lock) & takes the task's byte-offset at that position, locates the task's line size within the Tasks file
+///		data and reads the task's value from the Tasks file (a positional read - no lock). If the Tasks file data holds the lines' values
+///		(index cache), the value is taken from them instead, and in lazy subset mode it is parsed from the Tasks file's mapped view.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="HANDLE* p_h_tasksList - A pointer to the thread's read-only Handle of the Tasks list file"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>Success (TRUE), NO_TASKS_REMAINING if the Queue is empty, or Failure (FALSE)</returns>
+static BOOL fetchNextQueuedTask(threadPackage* p_params, taskPositionsRange* p_range, HANDLE* p_h_tasksList, PDWORDLONG p_task);
+/// <summary>
+///	 Description - This function fetches the value of the most prioritized remaining task when solving from a tasks container: it claims
+///		the next position of the container's priority order (atomically, without a lock) and reads the task from the mapped columns.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>Success (TRUE), NO_TASKS_REMAINING if all positions were claimed, or Failure (FALSE)</returns>
+static BOOL fetchNextContainerTask(threadPackage* p_params, taskPositionsRange* p_range, PDWORDLONG p_task);
+/// <summary>
+///	 Description - This function fetches the value of the most prioritized remaining task from the tasks' source in use - the runtime
+///		tasks feed's heap, the tasks container, or the Tasks Priorities Queue & the Tasks file.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="HANDLE* p_h_tasksList - A pointer to the thread's read-only Handle of the Tasks list file"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>Success (TRUE), NO_TASKS_REMAINING if there are no tasks left, or Failure (FALSE)</returns>
+static BOOL fetchNextTask(threadPackage* p_params, taskPositionsRange* p_range, HANDLE* p_h_tasksList, PDWORDLONG p_task);
+/// <summary>
+///	 Description - This function claims the next distinct task (atomically, without a lock), in the priority order of the distinct
+///		tasks' first occurrences.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <param name="PDWORDLONG p_numberOfOccurrences - A pointer to the variable that will be updated with the # of occurrences of the task"></param>
+/// <returns>Success (TRUE), NO_TASKS_REMAINING if all distinct tasks were claimed, or Failure (FALSE)</returns>
+static BOOL fetchNextDistinctTask(threadPackage* p_params, taskPositionsRange* p_range, PDWORDLONG p_task, PDWORDLONG p_numberOfOccurrences);
+/// <summary>
+///	 Description - This function writes a task's solution once per occurrence of the task, with a single write to the Tasks file
+///		(the solution is replicated into one buffer first).
+/// </summary>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the Handle of the Tasks-list text file (Tasks.txt)"></param>
+/// <param name="factorizedString* p_taskPrimeFactorsStringData - A pointer to the task's prime factors string struct"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The number of times the solution should be written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+static BOOL printSolvedTaskOccurrencesToTasksListFile(HANDLE* p_h_tasksListFile, factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function parses a task's value directly from the mapped view of the Tasks file (lazy subset mode), after
+///		validating that a line begins at the given byte-offset. The view is read only, so no lock is needed.
+/// </summary>
+/// <param name="mappedFile* p_mappedTasksFile - A pointer to the mapped view of the Tasks file"></param>
+/// <param name="DWORDLONG taskByteOffsetFromBeginningOfTheFile - The initial byte-position of the task's line"></param>
+/// <param name="PDWORDLONG p_task - A pointer to the variable that will be updated with the task's value"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL parseTaskFromMappedTasksFile(mappedFile* p_mappedTasksFile, DWORDLONG taskByteOffsetFromBeginningOfTheFile, PDWORDLONG p_task);
+/// <summary>
+///	 Description - This function claims the next position in the priority order: from the thread's private range if it isn't exhausted,
+///		and otherwise from the threads' shared cursor without any lock - either a single position with one atomic fetch-and-add (tasks start in
+///		exact priority order), or, with guided batch claiming, a run of consecutive positions with a compare-and-swap. The run's size is the
+///		remaining positions' share per thread (halved), clamped to [minimal, maximal] chunk size, so a task starts at most one chunk out of
+///		strict priority order. Every claim is counted in the chunk sizes' histogram.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="DWORDLONG numberOfPositions - The number of positions that may be claimed"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the claimed position"></param>
+/// <returns>Success (TRUE), or NO_TASKS_REMAINING if all positions were claimed</returns>
+static BOOL claimNextTaskPosition(threadPackage* p_params, taskPositionsRange* p_range, DWORDLONG numberOfPositions, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function claims the next position to solve. With size-class lanes it's the next position of the thread's home lane
+///		(or a borrowed one). Without a deadline schedule it's the next claimed position in the priority order. With one (EDF), the claimed index is translated to the schedule's position, which is deferred if it can't meet its' deadline
+///		anymore (demoted or skipped) - then the next index is claimed. Once all indices were claimed, the demoted positions are handed out.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="taskPositionsRange* p_range - A pointer to the thread's private range of claimed positions"></param>
+/// <param name="DWORDLONG numberOfPositions - The number of positions that may be claimed"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the claimed position"></param>
+/// <returns>Success (TRUE), NO_TASKS_REMAINING if all positions were claimed, or Failure (FALSE)</returns>
+static BOOL claimNextScheduledPosition(threadPackage* p_params, taskPositionsRange* p_range, DWORDLONG numberOfPositions, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function hands a solved task's solution to the reorder buffer (ordered output). If the thread becomes the drainer,
+///		it writes the ready solutions to the Tasks file in priority order (under the Tasks file's write lock), until the next one isn't ready.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with a reorder buffer)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's Handle of the Tasks list file"></param>
+/// <param name="DWORDLONG position - The solved task's position (dispatch order)"></param>
+/// <param name="factorizedString* p_taskPrimeFactorsStringData - A pointer to the task's solution (owned by the reorder buffer from now on)"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The number of times the solution should be written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+static BOOL printSolvedTaskInPriorityOrder(threadPackage* p_params, HANDLE* p_h_tasksListFile, DWORDLONG position,
+	factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function writes the thread's backlog of solutions (deferred writes) to the Tasks file, under the Tasks file's write lock.
+///		The lock is only tried: while it is busy & the backlog isn't full, the flush is skipped & the thread goes on solving. A full backlog,
+///		or a forced flush (no tasks remain), waits for the lock. The written tasks are reported completed once the lock is released.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with deferred writes)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's Handle of the Tasks list file"></param>
+/// <param name="deferredWritesBacklog* p_backlog - A pointer to the thread's backlog (NULL - nothing to write)"></param>
+/// <param name="workerProgress* p_progress - A pointer to the thread's progress slot"></param>
+/// <param name="BOOL force - Wait for the lock even if the backlog isn't full"></param>
+/// <returns>A BOOL value representing the function's outcome (a skipped flush is a success). Success (TRUE) or Failure (False)</returns>
+static BOOL flushDeferredWrites(threadPackage* p_params, HANDLE* p_h_tasksListFile, deferredWritesBacklog* p_backlog, workerProgress* p_progress, BOOL force);
+/// <summary>
+///	 Description - This function appends a solved task's line (once per occurrence of the task) to the thread's output buffer. A line that
+///		doesn't fit gets the buffer written first, & a line longer than a whole buffer is written on its' own. Once all the lines were appended,
+///		the buffer is written if its' oldest line is due.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with output buffering)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's Handle of the Tasks list file"></param>
+/// <param name="outputBuffer* p_outputBuffer - A pointer to the thread's buffer"></param>
+/// <param name="workerProgress* p_progress - A pointer to the thread's progress slot"></param>
+/// <param name="factorizedString* p_taskPrimeFactorsStringData - A pointer to the task's solution (still owned by the caller)"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The number of times the solution should be written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+static BOOL bufferSolvedTask(threadPackage* p_params, HANDLE* p_h_tasksListFile, outputBuffer* p_outputBuffer, workerProgress* p_progress,
+	factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function appends bytes to the end of the Tasks file in a single write - under the Tasks file's write lock, or with
+///		reserved appends, to a reserved range of the output (no lock).
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's Handle of the Tasks list file"></param>
+/// <param name="workerProgress* p_progress - A pointer to the thread's progress slot"></param>
+/// <param name="LPTSTR p_bytes - A pointer to the bytes to append"></param>
+/// <param name="DWORD numberOfBytes - The # of bytes to append"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+static BOOL appendToTasksListFile(threadPackage* p_params, HANDLE* p_h_tasksListFile, workerProgress* p_progress, LPTSTR p_bytes, DWORD numberOfBytes);
+/// <summary>
+///	 Description - This function writes the thread's output buffer to the end of the Tasks file in a single append, under the Tasks file's
+///		write lock (or to a reserved range of the output), and empties it.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct (with output buffering)"></param>
+/// <param name="HANDLE* p_h_tasksListFile - A pointer to the thread's Handle of the Tasks list file"></param>
+/// <param name="outputBuffer* p_outputBuffer - A pointer to the thread's buffer (NULL or empty - nothing to write)"></param>
+/// <param name="workerProgress* p_progress - A pointer to the thread's progress slot"></param>
+/// <param name="DWORD reason - Why the buffer is written (OUTPUT_BUFFER_FLUSH_*)"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (False)</returns>
+static BOOL flushOutputBuffer(threadPackage* p_params, HANDLE* p_h_tasksListFile, outputBuffer* p_outputBuffer, workerProgress* p_progress, DWORD reason);
+/// <summary>
+///	 Description - This function records a task's completion once its' solution was handed to its' write path (written, buffered, pushed or
+///		waiting in the reorder window) - every write path completes its' tasks through it: the deadline schedule records the task's finish, &
+///		the progress watchdog counts it.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <param name="workerProgress* p_progress - A pointer to the thread's progress slot"></param>
+/// <param name="DWORDLONG position - The completed task's position (dispatch order)"></param>
+static void recordTaskCompletion(threadPackage* p_params, workerProgress* p_progress, DWORDLONG position);
 
 // Functions definitions ---------------------------------------------------------------
 
@@ -110,7 +268,7 @@ BOOL WINAPI solveSingleTaskThread(LPVOID lpParam)
 
 
 	//Open a Handle to the Tasks list file - GLOBAL PATH
-	if (INVALID_HANDLE_VALUE == *(p_h_taskList = openFileForReadingAndWriting(p_filePath))) {
+	if (INVALID_HANDLE_VALUE == *(p_h_taskList = openFileForWriting(p_filePath))) {
 		printf("Error: Failed to open tasks list file (input) with code: %d.\n", GetLastError());
 		printf("At file: %s\nAt line number: %d\nAt function: %s", __FILE__, __LINE__, __func__);
 		freeTheString(p_taskPrimeFactorsStringData);
@@ -138,8 +296,17 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 {
 	threadPackage* p_params = NULL;
 	HANDLE* p_h_tasksList = NULL;
-	DWORD taskNumberStringNumberOfBytes = 0, task = 0, taskInitialByteOffsetChosenByPriority = 0;
+	HANDLE* p_h_tasksListForReading = NULL;
+	DWORDLONG task = 0, numberOfOccurrences = 1;
+	taskPositionsRange range = { 0 };
 	factorizedString* p_taskPrimeFactorsStringData = NULL;
+	BOOL retVal = STATUS_CODE_FAILURE, speculative = FALSE;
+	DWORD inFlightSlotIndex = 0;
+	inFlightTask adoptedTask;
+	cancellationToken cancellation = { NULL, 0 };
+	workerProgress* p_progress = NULL;
+	deferredWritesBacklog* p_backlog = NULL;
+	outputBuffer* p_outputBuffer = NULL;
 	//Check whether lpParam is NULL - Input integrity validation
 	if (NULL == lpParam) return EMPTY_THREAD_PARAMETERS;
 
@@ -147,9 +314,65 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 	p_params = (threadPackage*)lpParam;
 
 
-	//Open a Handle to the Tasks list file - GLOBAL PATH
-	if (NULL == (p_h_tasksList = openFileForReadingAndWriting(p_params->p_tasksFilePath))) {
+	//Open a writing Handle to the Tasks list file (the solutions' appends) - GLOBAL PATH
+	if (NULL == (p_h_tasksList = openFileForWriting(p_params->p_tasksFilePath))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Open a read-only Handle to the Tasks list file (the tasks' positional reads - no file pointer & no lock) - GLOBAL PATH
+	if (NULL == (p_h_tasksListForReading = openFileForReading(p_params->p_tasksFilePath))) {
 		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take ownership of a work stealing deque
+	if ((NULL != p_params->p_workStealingScheduler) && (STATUS_CODE_SUCCESS != registerWorkStealingWorker(p_params->p_workStealingScheduler, &range))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take a home size-class lane
+	if ((NULL != p_params->p_sizeClassLanes) && (STATUS_CODE_SUCCESS != registerSizeClassLaneWorker(p_params->p_sizeClassLanes, &range))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take a progress slot (the progress watchdog's stall diagnostics)
+	if ((NULL != p_params->p_progressWatchdog) && (STATUS_CODE_SUCCESS != registerWatchdogWorker(p_params->p_progressWatchdog, &p_progress))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take an in-flight task's slot (job tail mitigation)
+	if ((NULL != p_params->p_speculativeTail) && (STATUS_CODE_SUCCESS != registerSpeculativeTailSolver(p_params->p_speculativeTail, &inFlightSlotIndex))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take a private backlog for the solutions (deferred writes)
+	if ((NULL != p_params->p_deferredWrites) && (NULL == (p_backlog = createDeferredWritesBacklog(p_params->p_deferredWrites)))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Take a private buffer for the solutions' lines (output buffering)
+	if ((NULL != p_params->p_outputBuffering) && (NULL == (p_outputBuffer = createOutputBuffer(p_params->p_outputBuffering)))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		destroyDeferredWritesBacklog(&p_backlog);
 		return STATUS_CODE_FAILURE;
 	}
 
@@ -159,108 +382,157 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 	{
 
 
-		//1
-		/* --------------------------------------------- */
-		/* Attempt Priorities Queue resource Write lock  */
-		/* --------------------------------------------- */
-		if (WRITE_ACCESS_GRANTED != write_lock(p_params->p_prioritiesQueueLock)) {//==1
-			printf("Queue access failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
+		//1 + 2
+		/* ------------------------------------------------------------------------------ */
+		/* Fetch the most prioritized remaining task (from the Queue & Tasks file, from   */
+		/* the tasks container, or the next distinct task)                                */
+		/* ------------------------------------------------------------------------------ */
+		speculative = FALSE;
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_FETCHING, 0);
+		if (NO_TASKS_REMAINING == (retVal = (NULL != p_params->p_deduplicatedTasks) ?
+			fetchNextDistinctTask(p_params, &range, &task, &numberOfOccurrences) :
+			fetchNextTask(p_params, &range, p_h_tasksListForReading, &task))) {
+			// We reached an empty Queue... unless another thread's in-flight task may be re-executed (job tail)
+			if ((NULL == p_params->p_speculativeTail) || (SPECULATIVE_TAIL_NOTHING_TO_ADOPT ==
+				(retVal = adoptOldestInFlightTask(p_params->p_speculativeTail, inFlightSlotIndex, &adoptedTask, &cancellation)))) break;
+			task = adoptedTask.task;
+			range.lastPosition = adoptedTask.position;
+			numberOfOccurrences = adoptedTask.numberOfOccurrences;
+			speculative = TRUE;
+		}
+		//Publishing the task as in flight (job tail) - another thread may re-execute it once no tasks remain
+		else if ((STATUS_CODE_SUCCESS == retVal) && (NULL != p_params->p_speculativeTail))
+			retVal = publishInFlightTask(p_params->p_speculativeTail, inFlightSlotIndex, task, range.lastPosition, numberOfOccurrences, &cancellation);
+		if (STATUS_CODE_SUCCESS != retVal) {
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			return STATUS_CODE_FAILURE;
 		}
-		//------------------locked
 
-		//Find most prioritized remaining task size in bytes. 
-		//If returned value is (ULONG_MAX-1), then the queue is empty -->> NO MORE TASKS TO SOLVE... EXIT..
-		if ((ULONG_MAX - 1) == (taskInitialByteOffsetChosenByPriority = Top(p_params->p_prioritiesQueue))) { //remind the constants
-			if (STATUS_CODE_SUCCESS != write_release(p_params->p_prioritiesQueueLock)) {
-				printf("Queue lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
-				closeHandleProcedure(p_h_tasksList);
-				return STATUS_CODE_FAILURE;
-			}
-			break; // We reached an empty Queue...
-		}
 
-		if (STATUS_CODE_SUCCESS != Pop(p_params->p_prioritiesQueue)) {
-			//Generally, there should be no reason for the thread to receive an output from Pop(.) which equals POP_QUEUE_WAS_EMPTY because, Top(.) would sense an empty queue first..
-			if (STATUS_CODE_SUCCESS != write_release(p_params->p_prioritiesQueueLock)) {
-				printf("Queue lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
-				closeHandleProcedure(p_h_tasksList);
-				return STATUS_CODE_FAILURE;
-			}
-			break; // We reached an empty Queue... previous Top-empty-queue case should suffice
-		}
 
-		//-----------------unlocking
-		if (STATUS_CODE_SUCCESS != write_release(p_params->p_prioritiesQueueLock)) {
-			printf("Queue lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
+
+		//Tasks' values are upper bounded by 999,999,999 - only the byte-offsets are 64-bit
+		if (MAXDWORD < task) {
+			printf("Error: Task %llu exceeds the supported tasks' range.\n", task);
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			return STATUS_CODE_FAILURE;
 		}
-		/* ----------------------------------------------------- */
-		/* Release Attempt Priorities Queue resource Write lock  */
-		/* ----------------------------------------------------- */
-
-
-
-
-
-		//Access the Tasks file data struct for Reading (This resource is an ONLY reading resource which is why
-		// it doesn't require any Synchronization)
-		taskNumberStringNumberOfBytes = fetchMostPrioritizedTaskSizeInBytes(
-			p_params->p_tasksFileData,				/* Task-list file data struct */
-			taskInitialByteOffsetChosenByPriority	/* Initial byte offset from the beginning of the Tasks file */
-		);
-
-
 
-
-
-
-		//2
-		/* ------------------------------------------- */
-		/* Attempt Tasks list file resource Read lock  */
-		/* ------------------------------------------- */
-		if (READ_ACCESS_GRANTED != read_lock(p_params->p_tasksFileLock)) {//==1
-			printf("Tasks file reading access failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
+		//Solve Task..... (a re-executed task is solved with Pollard's rho, & an in-flight task's solving is cancelled once another solver finished it)
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_SOLVING, task);
+		if (NULL == p_params->p_speculativeTail) {
+			printf("Thread no. %lu beginning solving task: %llu...\n", (unsigned long)GetCurrentThreadId(), task);
+			p_taskPrimeFactorsStringData = receivePrimeFactorizedListString((DWORD)task);
+		}
+		else {
+			printf((TRUE == speculative) ? "Thread no. %lu re-executing in-flight task: %llu...\n" : "Thread no. %lu beginning solving task: %llu...\n", (unsigned long)GetCurrentThreadId(), task);
+			p_taskPrimeFactorsStringData = receiveCancelablePrimeFactorizedListString((DWORD)task, speculative, &cancellation);
+		}
+		if ((NULL == p_taskPrimeFactorsStringData) && ((NULL == p_params->p_speculativeTail) || (FALSE == isCancellationRequested(&cancellation)))) {
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			return STATUS_CODE_FAILURE;
 		}
-		//------------------locked
 
-		//Read most prioritized remaining task's value
-		if (STATUS_CODE_FAILURE == fetchTaskByteOffsetByPriorityOrTaskItself( //Fetch Task-Itself
-			p_h_tasksList,								/* a handle to the Tasks-list file */
-			taskInitialByteOffsetChosenByPriority,		/* initial byte offset from the beginning of the Tasks file */
-			taskNumberStringNumberOfBytes,				/* number of bytes that are used to represent the current task's line's string */
-			&task										/* The task's variable address, for updating with the value computed in the function */
-		)) { //p_currentPriorityCell->value == taskInitialByteOffsetChosenByPriority
-			if (STATUS_CODE_SUCCESS != read_release(p_params->p_tasksFileLock)) {
-				printf("Tasks file reading lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
+		//Job tail - only the first solver of the task to finish writes its' solution (the others' solutions are discarded)
+		if (NULL != p_params->p_speculativeTail) {
+			if (STATUS_CODE_SUCCESS != (retVal = resolveInFlightTask(p_params->p_speculativeTail, &cancellation, speculative))) {
+				if (NULL != p_taskPrimeFactorsStringData) freeTheString(p_taskPrimeFactorsStringData);
+				if (SPECULATIVE_TAIL_ALREADY_RESOLVED == retVal) continue;
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
 			}
-			closeHandleProcedure(p_h_tasksList);
-			return STATUS_CODE_FAILURE;
 		}
 
-		//--------------unlocking
-		if (STATUS_CODE_SUCCESS != read_release(p_params->p_tasksFileLock)) {
-			printf("Tasks file reading lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
-			closeHandleProcedure(p_h_tasksList);
-			return STATUS_CODE_FAILURE;
+		//Ordered output - the solution waits in the reorder window (the drainer writes it once the preceding solutions were written)
+		if (NULL != p_params->p_reorderBuffer) {
+			reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, task);
+			if (STATUS_CODE_SUCCESS != printSolvedTaskInPriorityOrder(p_params, p_h_tasksList, range.lastPosition, p_taskPrimeFactorsStringData, numberOfOccurrences)) {
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
+			}
+			recordTaskCompletion(p_params, p_progress, range.lastPosition);
+			continue;
 		}
-		/* ------------------------------------------- */
-		/* Release Tasks list file resource Read lock  */
-		/* ------------------------------------------- */
 
+		//Deferred writes - the solution waits in the thread's backlog, which is written whenever the Tasks file's lock is vacant (or once it's full)
+		if (NULL != p_backlog) {
+			if (STATUS_CODE_SUCCESS != deferSolvedTask(p_backlog, p_taskPrimeFactorsStringData, numberOfOccurrences, range.lastPosition)) {
+				freeTheString(p_taskPrimeFactorsStringData);
+				retVal = STATUS_CODE_FAILURE;
+			}
+			else retVal = flushDeferredWrites(p_params, p_h_tasksList, p_backlog, p_progress, FALSE);
+			if (STATUS_CODE_SUCCESS != retVal) {
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
+			}
+			continue;
+		}
 
+		//Output buffering - the solution's lines are appended to the thread's buffer, which is written in a single append once full or due
+		if (NULL != p_outputBuffer) {
+			retVal = bufferSolvedTask(p_params, p_h_tasksList, p_outputBuffer, p_progress, p_taskPrimeFactorsStringData, numberOfOccurrences);
+			freeTheString(p_taskPrimeFactorsStringData);
+			if (STATUS_CODE_SUCCESS != retVal) {
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
+			}
+			//The task is completed once its' solution is buffered (the buffer is written by the time the thread exits)
+			recordTaskCompletion(p_params, p_progress, range.lastPosition);
+			continue;
+		}
 
+		//Writer thread - the solution is pushed to the writer's ring (waiting only while the ring is full), & the writer thread writes it
+		if (NULL != p_params->p_writerRing) {
+			reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, task);
+			if (STATUS_CODE_SUCCESS != pushToWriterRing(p_params->p_writerRing, p_taskPrimeFactorsStringData, numberOfOccurrences)) {
+				printf("Error: The writer thread failed - the solution can't be written.\n");
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
+			}
+			//The task is completed once its' solution is pushed (the writer writes it by the time the ring is closed)
+			recordTaskCompletion(p_params, p_progress, range.lastPosition);
+			continue;
+		}
 
-		//Solve Task.....
-		printf("Thread no. %lu beginning solving task: %lu...\n", GetCurrentThreadId(), task);
-		if (NULL == (p_taskPrimeFactorsStringData = receivePrimeFactorizedListString(task))) {
-			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
-			closeHandleProcedure(p_h_tasksList);
-			return STATUS_CODE_FAILURE;
+		//Reserved appends - the solution is written to its' own reserved range of the output, concurrently with the other threads (no lock)
+		if (NULL != p_params->p_appendReservations) {
+			reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, task);
+			retVal = appendReservedSolution(p_params->p_appendReservations, p_params->p_tasksFileLock, p_h_tasksList, p_taskPrimeFactorsStringData, numberOfOccurrences);
+			freeTheString(p_taskPrimeFactorsStringData);
+			if (STATUS_CODE_SUCCESS != retVal) {
+				closeHandleProcedure(p_h_tasksList);
+				closeHandleProcedure(p_h_tasksListForReading);
+				destroyDeferredWritesBacklog(&p_backlog);
+				destroyOutputBuffer(&p_outputBuffer);
+				return STATUS_CODE_FAILURE;
+			}
+			recordTaskCompletion(p_params, p_progress, range.lastPosition);
+			continue;
 		}
 
 
@@ -272,21 +544,31 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 		/* -------------------------------------------- */
 		/* Attempt Tasks list file resource Write lock  */
 		/* -------------------------------------------- */
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_WAITING_FOR_LOCK, task);
 		if (WRITE_ACCESS_GRANTED != write_lock(p_params->p_tasksFileLock)) {//==1
 			printf("Tasks file writing access failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			freeTheString(p_taskPrimeFactorsStringData);
 			return STATUS_CODE_FAILURE;
 		}
 		//------------------locked
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, task);
 
-		//Write the solution (Task's number prime factors string) to the Tasks list file 
-		if (STATUS_CODE_FAILURE == printSolvedTaskToTasksListFile(p_h_tasksList, p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize)) {
+		//Write the solution (Task's number prime factors string) to the Tasks list file - once for every occurrence of the task
+		if (STATUS_CODE_FAILURE == ((1 < numberOfOccurrences) ?
+			printSolvedTaskOccurrencesToTasksListFile(p_h_tasksList, p_taskPrimeFactorsStringData, numberOfOccurrences) :
+			printSolvedTaskToTasksListFile(p_h_tasksList, p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize))) {
 			//Releasing Tasks file writing lock, in case writing the solution to Tasks file failed to prevent Deadlock!
 			if (STATUS_CODE_SUCCESS != write_release(p_params->p_tasksFileLock)) {
 				printf("Tasks file writing lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
 			}
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			freeTheString(p_taskPrimeFactorsStringData);
 			return STATUS_CODE_FAILURE;
 		}
@@ -295,9 +577,13 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 		if (STATUS_CODE_SUCCESS != write_release(p_params->p_tasksFileLock)) {
 			printf("Tasks file writing lock release failed...\n"); // Might remove due to 'printf' being non-atomic, & when multiple Writer to queue reach timeout, they would all print this message == OVERLOAD CMD
 			closeHandleProcedure(p_h_tasksList);
+			closeHandleProcedure(p_h_tasksListForReading);
+			destroyDeferredWritesBacklog(&p_backlog);
+			destroyOutputBuffer(&p_outputBuffer);
 			freeTheString(p_taskPrimeFactorsStringData);
 			return STATUS_CODE_FAILURE;
 		}
+		recordTaskCompletion(p_params, p_progress, range.lastPosition);
 		/* -------------------------------------------- */
 		/* Release Tasks list file resource Write lock  */
 		/* -------------------------------------------- */
@@ -308,17 +594,73 @@ BOOL WINAPI tasksSolverThread(LPVOID lpParam)
 		freeTheString(p_taskPrimeFactorsStringData);
 
 	}
-	//Closing the Tasks file Handle that was unique to the current thread
+	//No tasks remain - the rest of the backlog (deferred writes) or of the buffer (output buffering) is written, waiting for the lock if needed
+	if ((STATUS_CODE_SUCCESS != flushDeferredWrites(p_params, p_h_tasksList, p_backlog, p_progress, TRUE)) ||
+		(STATUS_CODE_SUCCESS != flushOutputBuffer(p_params, p_h_tasksList, p_outputBuffer, p_progress, OUTPUT_BUFFER_FLUSH_FINAL))) {
+		closeHandleProcedure(p_h_tasksList);
+		closeHandleProcedure(p_h_tasksListForReading);
+		destroyDeferredWritesBacklog(&p_backlog);
+		destroyOutputBuffer(&p_outputBuffer);
+		return STATUS_CODE_FAILURE;
+	}
+	reportWorkerActivity(p_progress, WORKER_ACTIVITY_DONE, 0);
+	//Closing the Tasks file Handles that were unique to the current thread
 	closeHandleProcedure(p_h_tasksList);
+	closeHandleProcedure(p_h_tasksListForReading);
+	destroyDeferredWritesBacklog(&p_backlog);
+	destroyOutputBuffer(&p_outputBuffer);
 	//Thread operation completed successfuly....
 	return STATUS_CODE_SUCCESS;
 }
 
 
 
+PDWORDLONG fetchAllTasksInPriorityOrder(threadPackage* p_params)
+{
+	HANDLE* p_h_tasksList = NULL;
+	PDWORDLONG p_tasksValues = NULL;
+	DWORDLONG taskIndex = 0;
+	taskPositionsRange range = { 0 };
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Input integrity validation
+	if (NULL == p_params) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the tasks' values
+	if (NULL == (p_tasksValues = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)p_params->numberOfTasks + 1))) {
+		printf("Error: Failed to allocate memory for the tasks' values.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return NULL;
+	}
+
+	//Open a read-only Handle to the Tasks list file - GLOBAL PATH
+	if (NULL == (p_h_tasksList = openFileForReading(p_params->p_tasksFilePath))) {
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_tasksValues);
+		return NULL;
+	}
+
+	//Fetching the tasks one after the other, exactly as the threads would (before any thread exists - the locks are vacant)
+	for (taskIndex = 0; taskIndex < p_params->numberOfTasks; taskIndex++) {
+		if (STATUS_CODE_SUCCESS == (retVal = fetchNextTask(p_params, &range, p_h_tasksList, p_tasksValues + taskIndex))) continue;
+		if (NO_TASKS_REMAINING == retVal) break;
+		closeHandleProcedure(p_h_tasksList);
+		free(p_tasksValues);
+		return NULL;
+	}
+
+	//Closing the Tasks file Handle & recording the number of tasks actually fetched
+	closeHandleProcedure(p_h_tasksList);
+	p_params->numberOfTasks = taskIndex;
+	return p_tasksValues;
+}
+
+
+
 //......................................Static functions..........................................
 
-static HANDLE* openFileForReadingAndWriting(char* p_filePath)
+static HANDLE* openFileForWriting(char* p_filePath)
 {
 	HANDLE* p_h_fileHandle = NULL;
 	//Assert
@@ -331,10 +673,10 @@ static HANDLE* openFileForReadingAndWriting(char* p_filePath)
 		return  NULL;
 	}
 
-	//Open file for reading
+	//Open file for writing
 	*p_h_fileHandle = CreateFile(
 		p_filePath,							// Const null - terminated string describing the file's path
-		GENERIC_READ | GENERIC_WRITE,		// Desired Access is set to Reading mode 
+		GENERIC_WRITE,						// Desired Access is set to Writing mode (the tasks are read through a separate read-only Handle)
 		FILE_SHARE_READ | FILE_SHARE_WRITE,	// Share Mode:Here various threads may read from the input file (input message)
 		NULL,								// No Security Attributes
 		OPEN_EXISTING,						// The message is an existing file. If it doesn't exist we shouldn't open anything
@@ -342,6 +684,39 @@ static HANDLE* openFileForReadingAndWriting(char* p_filePath)
 		NULL								// No Template
 	);
 	//File Handle creation validation
+	if (INVALID_HANDLE_VALUE == *p_h_fileHandle) {
+		printf("Error: Failed to create a Handle to the Tasks file '%s' for writing the solutions, with code: %d.\n", p_filePath, GetLastError());
+		free(p_h_fileHandle);
+		return NULL;
+	}
+	//Returning a pointer to the created handle to file
+	return p_h_fileHandle;
+}
+
+static HANDLE* openFileForReading(char* p_filePath)
+{
+	HANDLE* p_h_fileHandle = NULL;
+	//Assert
+	assert(NULL != p_filePath);
+
+	//Allocating dynamic memory (Heap) for a file Handle pointer
+	if (NULL == (p_h_fileHandle = (HANDLE*)calloc(sizeof(HANDLE), SINGLE_OBJECT))) {
+		printf("Error: Failed to allocate memory for a Handle to file '%s'.\n", p_filePath);
+		printf("At file: %s\n at line number: %d\n at function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return  NULL;
+	}
+
+	//Open file for (positional) reading
+	*p_h_fileHandle = CreateFile(
+		p_filePath,							// Const null - terminated string describing the file's path
+		GENERIC_READ,						// Desired Access is set to Reading mode
+		FILE_SHARE_READ | FILE_SHARE_WRITE,	// Share Mode: the other threads' writing Handles append to the file meanwhile
+		NULL,								// No Security Attributes
+		OPEN_EXISTING,						// The message is an existing file. If it doesn't exist we shouldn't open anything
+		FILE_FLAG_RANDOM_ACCESS,			// The tasks are read at their prioritized (scattered) byte-offsets
+		NULL								// No Template
+	);
+	//File Handle creation validation
 	if (INVALID_HANDLE_VALUE == *p_h_fileHandle) {
 		printf("Error: Failed to create a Handle to the Tasks file '%s' for tasks retreival, with code: %d.\n", p_filePath, GetLastError());
 		free(p_h_fileHandle);
@@ -351,45 +726,39 @@ static HANDLE* openFileForReadingAndWriting(char* p_filePath)
 	return p_h_fileHandle;
 }
 
-static DWORD fetchMostPrioritizedTaskSizeInBytes(file* p_tasksFileData, DWORD taskByteOffsetFromBeginningOfTheFile)
+static DWORD fetchMostPrioritizedTaskSizeInBytes(file* p_tasksFileData, DWORDLONG taskByteOffsetFromBeginningOfTheFile)
 {
-	line* p_currentLine = NULL;
+	line taskLine;
 	//Asserts
 	assert(NULL != p_tasksFileData);
-	assert(0 <= taskByteOffsetFromBeginningOfTheFile);
 
-	//Set the current line data to be the first line data in the Tasks list file
-	p_currentLine = p_tasksFileData->p_firstLineInFile;
-	//Iterate through the Tasks list file data framed as lines structures & locate the number of bytes the task is composed of
-	while (NULL != p_currentLine->p_nextLine) {
-		if (taskByteOffsetFromBeginningOfTheFile == p_currentLine->initialPositionByByte)  return p_currentLine->numberOfBytesInLine;
-		p_currentLine = p_currentLine->p_nextLine;
-	}
-
-	//If the while loop wasn't entered it means there was only one line with a task, so the first's line number of bytes is sent back
-	//If the last cell (line) in the list is the current prioritized task, then the number of bytes is sent from here after the loop finished 
-	return p_currentLine->numberOfBytesInLine;
+	//Locate the line in the Tasks list file data (binary search over the lines' initial byte positions, or a rank in the compressed index)
+	if (STATUS_CODE_SUCCESS != findLineByInitialByteOffset(p_tasksFileData, taskByteOffsetFromBeginningOfTheFile, &taskLine)) return 0;
 
+	//Return the number of bytes the task is composed of
+	return taskLine.numberOfBytesInLine;
 }
 
 static BOOL printSolvedTaskToTasksListFile(HANDLE* p_h_tasksListFile, LPTSTR p_numberPrimeFactorsString, DWORD stringLength)
 {
-	DWORD retValSet = 0, numberOfBytesWritten = 0;
-	BOOL retValWrite = FALSE;
+	DWORD numberOfBytesWritten = 0;
+	LARGE_INTEGER endOfFileDistance;
+	BOOL retValSet = FALSE, retValWrite = FALSE;
 	//Asserts
 	assert(p_h_tasksListFile != NULL);
 	assert(p_numberPrimeFactorsString != NULL);
 
 
 	//Set the Handle to point at the byte position from which the print to the file should start - end of file!!
-	retValSet = SetFilePointer(
+	endOfFileDistance.QuadPart = 0;
+	retValSet = SetFilePointerEx(
 		*p_h_tasksListFile,					//Tasks List file Handle 
-		0,									//Initial byte position set to be the begining of teh writing mark
-		NULL,								//Assuming there is less than 2^32 bytes in the input file -recheck
+		endOfFileDistance,					//Initial byte position set to be the begining of teh writing mark
+		NULL,								//No need for the new file pointer position (64-bit - files may pass 4GB)
 		FILE_END							//Starting byte count is set to the end of the file which constatnly changes
 	);
 	//Validate Handle pointing succeeded...
-	if (INVALID_SET_FILE_POINTER == retValSet) {
+	if (FALSE == retValSet) {
 		//Initial byte position of wasn't found
 		printf("Error: Failed to reset the file Handle pointer position for printing, with code: %d.\n", GetLastError());
 		printf("At file: %s\nAt line number: %d\nAt function: %s", __FILE__, __LINE__, __func__);
@@ -420,4 +789,433 @@ static BOOL printSolvedTaskToTasksListFile(HANDLE* p_h_tasksListFile, LPTSTR p_n
 
 	//Writing to output file was successful...
 	return STATUS_CODE_SUCCESS;
-}
\ No newline at end of file
+}
+
+static BOOL fetchNextQueuedTask(threadPackage* p_params, taskPositionsRange* p_range, HANDLE* p_h_tasksList, PDWORDLONG p_task)
+{
+	DWORD taskNumberStringNumberOfBytes = 0;
+	DWORDLONG taskInitialByteOffsetChosenByPriority = 0, position = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_h_tasksList);
+	assert(NULL != p_task);
+
+	//1
+	/* ---------------------------------------------------------- */
+	/* Claim the next position in the (immutable) Queue - no lock */
+	/* ---------------------------------------------------------- */
+	if (STATUS_CODE_SUCCESS != (retVal = claimNextScheduledPosition(p_params, p_range, p_params->p_prioritiesQueue->numberOfCells, &position))) return retVal; // We reached the Queue's end...
+	p_range->lastPosition = position;
+	taskInitialByteOffsetChosenByPriority = At(p_params->p_prioritiesQueue, position);
+
+
+
+	//Lazy subset - the task's value is parsed from the Tasks file's mapped view (nothing was framed)
+	if (NULL != p_params->p_mappedTasksFile)
+		return parseTaskFromMappedTasksFile(p_params->p_mappedTasksFile, taskInitialByteOffsetChosenByPriority, p_task);
+
+	//The Tasks file's lines' values were kept while framing (index cache) - the task's value is taken from them without reading the file
+	if (NULL != p_params->p_tasksFileData->p_linesValues) {
+		if (STATUS_CODE_SUCCESS != fetchLineValueByInitialByteOffset(p_params->p_tasksFileData, taskInitialByteOffsetChosenByPriority, p_task)) {
+			printf("Error: No task in the Tasks file begins at the prioritized byte-offset %llu.\n", taskInitialByteOffsetChosenByPriority);
+			return STATUS_CODE_FAILURE;
+		}
+		return STATUS_CODE_SUCCESS;
+	}
+
+
+
+
+
+	//Access the Tasks file data struct for Reading (This resource is an ONLY reading resource which is why
+	// it doesn't require any Synchronization)
+	taskNumberStringNumberOfBytes = fetchMostPrioritizedTaskSizeInBytes(
+		p_params->p_tasksFileData,				/* Task-list file data struct */
+		taskInitialByteOffsetChosenByPriority	/* Initial byte offset from the beginning of the Tasks file */
+	);
+	if (0 == taskNumberStringNumberOfBytes) {
+		printf("Error: No line in the Tasks file begins at the prioritized byte-offset %llu.\n", taskInitialByteOffsetChosenByPriority);
+		return STATUS_CODE_FAILURE;
+	}
+
+
+
+
+
+
+	//2
+	/* ------------------------------------------------------------------------------ */
+	/* Read the task's line - a positional read on the thread's read-only Handle, so  */
+	/* no file pointer is shared with the appending Writers & no lock is needed (the  */
+	/* task's line precedes every solution appended after framing)                    */
+	/* ------------------------------------------------------------------------------ */
+	if (STATUS_CODE_FAILURE == fetchTaskByteOffsetByPriorityOrTaskItself( //Fetch Task-Itself
+		p_h_tasksList,								/* a read-only handle to the Tasks-list file */
+		taskInitialByteOffsetChosenByPriority,		/* initial byte offset from the beginning of the Tasks file */
+		taskNumberStringNumberOfBytes,				/* number of bytes that are used to represent the current task's line's string */
+		p_task										/* The task's variable address, for updating with the value computed in the function */
+	)) { //p_currentPriorityCell->value == taskInitialByteOffsetChosenByPriority
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The task's value was fetched
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL fetchNextContainerTask(threadPackage* p_params, taskPositionsRange* p_range, PDWORDLONG p_task)
+{
+	DWORDLONG position = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_task);
+
+	//Claiming the next position in the container's priority order - no lock
+	if (STATUS_CODE_SUCCESS != (retVal = claimNextScheduledPosition(p_params, p_range, p_params->numberOfTasks, &position))) return retVal;
+	p_range->lastPosition = position;
+
+	//The container is mapped read only - its' columns are read without locking
+	return fetchContainerTaskByPriority(p_params->p_tasksContainer, position, p_task);
+}
+
+static BOOL parseTaskFromMappedTasksFile(mappedFile* p_mappedTasksFile, DWORDLONG taskByteOffsetFromBeginningOfTheFile, PDWORDLONG p_task)
+{
+	//Asserts
+	assert(NULL != p_mappedTasksFile);
+	assert(NULL != p_task);
+
+	//A line begins at the offset only if it is the file's first byte or it follows a Newline character
+	if ((taskByteOffsetFromBeginningOfTheFile >= p_mappedTasksFile->numberOfBytes) ||
+		((0 < taskByteOffsetFromBeginningOfTheFile) && ('\n' != p_mappedTasksFile->p_view[taskByteOffsetFromBeginningOfTheFile - 1]))) {
+		printf("Error: No line in the Tasks file begins at the prioritized byte-offset %llu.\n", taskByteOffsetFromBeginningOfTheFile);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Parsing the task's value up to the end of its' line
+	if (FALSE == parseNumberFromMappedFile(p_mappedTasksFile, taskByteOffsetFromBeginningOfTheFile, p_task, NULL)) {
+		printf("Error: No task in the Tasks file begins at the prioritized byte-offset %llu.\n", taskByteOffsetFromBeginningOfTheFile);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The task's value was fetched
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL fetchNextTask(threadPackage* p_params, taskPositionsRange* p_range, HANDLE* p_h_tasksList, PDWORDLONG p_task)
+{
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+
+	//The runtime tasks feed's heap replaces the positions' order
+	if (NULL != p_params->p_tasksFeed) {
+		retVal = takeMostUrgentFedTask(p_params, p_task, &(p_range->lastPosition));
+		return (TASKS_FEED_EXHAUSTED == retVal) ? NO_TASKS_REMAINING : retVal;
+	}
+
+	//The tasks container replaces the Queue & the Tasks file
+	if (NULL != p_params->p_tasksContainer) return fetchNextContainerTask(p_params, p_range, p_task);
+	return fetchNextQueuedTask(p_params, p_range, p_h_tasksList, p_task);
+}
+
+static BOOL fetchNextDistinctTask(threadPackage* p_params, taskPositionsRange* p_range, PDWORDLONG p_task, PDWORDLONG p_numberOfOccurrences)
+{
+	DWORDLONG distinctTaskIndex = 0;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_task);
+	assert(NULL != p_numberOfOccurrences);
+
+	//Claiming the next distinct task - no lock
+	if (NO_TASKS_REMAINING == claimNextTaskPosition(p_params, p_range, p_params->p_deduplicatedTasks->numberOfDistinctTasks, &distinctTaskIndex)) return NO_TASKS_REMAINING;
+	p_range->lastPosition = distinctTaskIndex;
+
+	//The distinct tasks are read only - no locking
+	*p_task = *(p_params->p_deduplicatedTasks->p_distinctValues + distinctTaskIndex);
+	*p_numberOfOccurrences = *(p_params->p_deduplicatedTasks->p_numberOfOccurrences + distinctTaskIndex);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL printSolvedTaskOccurrencesToTasksListFile(HANDLE* p_h_tasksListFile, factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences)
+{
+	LPTSTR p_occurrencesString = NULL;
+	DWORDLONG occurrence = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_h_tasksListFile);
+	assert(NULL != p_taskPrimeFactorsStringData);
+
+	//A single write is limited to a DWORD number of bytes
+	if ((DWORDLONG)p_taskPrimeFactorsStringData->stringSize * numberOfOccurrences > MAXDWORD) {
+		printf("Error: The solutions of %llu occurrences of a task exceed a single write.\n", numberOfOccurrences);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Replicating the solution once per occurrence
+	if (NULL == (p_occurrencesString = (LPTSTR)calloc(sizeof(TCHAR), (size_t)(p_taskPrimeFactorsStringData->stringSize * numberOfOccurrences) + 1))) {
+		printf("Error: Failed to allocate memory for the task's occurrences' solutions.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	for (occurrence = 0; occurrence < numberOfOccurrences; occurrence++)
+		memcpy(p_occurrencesString + occurrence * p_taskPrimeFactorsStringData->stringSize,
+			p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize * sizeof(TCHAR));
+
+	//Writing all occurrences at once
+	retVal = printSolvedTaskToTasksListFile(p_h_tasksListFile, p_occurrencesString, (DWORD)(p_taskPrimeFactorsStringData->stringSize * numberOfOccurrences));
+	free(p_occurrencesString);
+	return retVal;
+}
+
+static BOOL claimNextScheduledPosition(threadPackage* p_params, taskPositionsRange* p_range, DWORDLONG numberOfPositions, PDWORDLONG p_position)
+{
+	DWORDLONG dispatchIndex = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_range);
+	assert(NULL != p_position);
+
+	//Size-class lanes - every lane keeps its' own cursor
+	if (NULL != p_params->p_sizeClassLanes) {
+		retVal = takeSizeClassLanePosition(p_params->p_sizeClassLanes, p_range, p_position);
+		return (SIZE_CLASS_LANES_EXHAUSTED == retVal) ? NO_TASKS_REMAINING : retVal;
+	}
+
+	//No deadline schedule - the priority order is the dispatch order
+	if (NULL == p_params->p_deadlineSchedule) return claimNextTaskPosition(p_params, p_range, numberOfPositions, p_position);
+
+	//Claiming dispatch indices until one's position is admitted (a deferred position was demoted or skipped)
+	do {
+		if ((NO_TASKS_REMAINING == claimNextTaskPosition(p_params, p_range, numberOfPositions, &dispatchIndex)) ||
+			(dispatchIndex >= p_params->p_deadlineSchedule->numberOfTasks)) {
+			//All indices were claimed - the demoted positions are last
+			retVal = takeDemotedPosition(p_params->p_deadlineSchedule, p_position);
+			return (DEADLINE_SCHEDULE_EXHAUSTED == retVal) ? NO_TASKS_REMAINING : retVal;
+		}
+	} while (DEADLINE_SCHEDULE_DEFERRED == (retVal = admitScheduledPosition(p_params->p_deadlineSchedule, dispatchIndex, p_position)));
+
+	return retVal;
+}
+
+static BOOL claimNextTaskPosition(threadPackage* p_params, taskPositionsRange* p_range, DWORDLONG numberOfPositions, PDWORDLONG p_position)
+{
+	LONGLONG claimedPosition = 0;
+	DWORDLONG chunkSize = 1;
+	DWORD bucket = 0;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_range);
+	assert(NULL != p_position);
+
+	//Work stealing - the thread's own deque, then other threads' deques (the scheduler was seeded with all positions)
+	if (NULL != p_params->p_workStealingScheduler)
+		return (TRUE == takeWorkStealingPosition(p_params->p_workStealingScheduler, p_range, p_position)) ? STATUS_CODE_SUCCESS : NO_TASKS_REMAINING;
+
+	//The thread's private range still has positions - no shared access at all
+	if (p_range->nextPosition < p_range->endPosition) {
+		*p_position = p_range->nextPosition++;
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//Single claims - a single atomic fetch-and-add claims a position - every position is claimed by exactly one thread, in increasing order
+	if (1 >= p_params->maximalChunkSize) {
+		*p_position = (DWORDLONG)InterlockedExchangeAdd64(&(p_params->nextTaskPosition), 1);
+		//All positions were claimed (the cursor keeps growing past the end by one per thread - harmless)
+		if (*p_position >= numberOfPositions) return NO_TASKS_REMAINING;
+		InterlockedIncrement(&(p_params->chunkSizesHistogram[0]));
+		return STATUS_CODE_SUCCESS;
+	}
+
+	//Guided claims - a run of consecutive positions, sized by the positions remaining at the time of the claim (compare-and-swap loop)
+	do {
+		claimedPosition = InterlockedCompareExchange64(&(p_params->nextTaskPosition), 0, 0); //Atomic 64-bit read (also on 32-bit builds)
+		if ((DWORDLONG)claimedPosition >= numberOfPositions) return NO_TASKS_REMAINING;
+		chunkSize = (numberOfPositions - (DWORDLONG)claimedPosition) / (GUIDED_CHUNK_DIVISOR * p_params->numberOfThreads);
+		if (chunkSize > p_params->maximalChunkSize) chunkSize = p_params->maximalChunkSize;
+		if (chunkSize < p_params->minimalChunkSize) chunkSize = p_params->minimalChunkSize;
+		if (chunkSize > numberOfPositions - (DWORDLONG)claimedPosition) chunkSize = numberOfPositions - (DWORDLONG)claimedPosition;
+	} while (claimedPosition != InterlockedCompareExchange64(&(p_params->nextTaskPosition), claimedPosition + (LONGLONG)chunkSize, claimedPosition));
+
+	//Counting the chunk's size (bucket of its' highest set bit)
+	for (bucket = 0; ((chunkSize >> (bucket + 1)) > 0) && (bucket + 1 < CHUNK_SIZES_HISTOGRAM_BUCKETS); bucket++);
+	InterlockedIncrement(&(p_params->chunkSizesHistogram[bucket]));
+
+	//The thread's new private range begins with the claimed position
+	p_range->endPosition = (DWORDLONG)claimedPosition + chunkSize;
+	p_range->nextPosition = (DWORDLONG)claimedPosition + 1;
+	*p_position = (DWORDLONG)claimedPosition;
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL printSolvedTaskInPriorityOrder(threadPackage* p_params, HANDLE* p_h_tasksListFile, DWORDLONG position,
+	factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences)
+{
+	reorderedResult result;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_h_tasksListFile);
+
+	//Depositing the solution - only the drainer writes
+	if (REORDER_BUFFER_DRAIN != (retVal = depositReorderedResult(p_params->p_reorderBuffer, position, p_taskPrimeFactorsStringData, numberOfOccurrences)))
+		return retVal;
+
+	//Writing the ready solutions in priority order, each under the Tasks file's write lock
+	while (STATUS_CODE_SUCCESS == (retVal = takeNextReorderedResult(p_params->p_reorderBuffer, &result))) {
+		if (WRITE_ACCESS_GRANTED != write_lock(p_params->p_tasksFileLock)) {
+			printf("Tasks file writing access failed...\n");
+			return STATUS_CODE_FAILURE;
+		}
+		//------------------locked
+		retVal = (1 < result.numberOfOccurrences) ?
+			printSolvedTaskOccurrencesToTasksListFile(p_h_tasksListFile, result.p_solution, result.numberOfOccurrences) :
+			printSolvedTaskToTasksListFile(p_h_tasksListFile, result.p_solution->p_numberPrimeFactorsString, result.p_solution->stringSize);
+		//----------------unlocking
+		if (STATUS_CODE_SUCCESS != write_release(p_params->p_tasksFileLock)) {
+			printf("Tasks file writing lock release failed...\n");
+			return STATUS_CODE_FAILURE;
+		}
+		if ((STATUS_CODE_FAILURE == retVal) || (STATUS_CODE_SUCCESS != advanceReorderWindow(p_params->p_reorderBuffer))) return STATUS_CODE_FAILURE;
+	}
+
+	//The next solution isn't ready - its' thread will drain
+	return (REORDER_BUFFER_DRAINED == retVal) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE;
+}
+
+static BOOL flushDeferredWrites(threadPackage* p_params, HANDLE* p_h_tasksListFile, deferredWritesBacklog* p_backlog, workerProgress* p_progress, BOOL force)
+{
+	deferredWrite* p_entry = NULL;
+	DWORD entryIndex = 0;
+	BOOL retVal = STATUS_CODE_SUCCESS, forced = FALSE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_h_tasksListFile);
+
+	//Nothing to write
+	if ((NULL == p_backlog) || (0 == p_backlog->numberOfEntries)) return STATUS_CODE_SUCCESS;
+
+	//Writing right away only if the lock is vacant - otherwise solving on, unless the backlog is full (or no tasks remain)
+	if (STATUS_CODE_SUCCESS != try_write_lock(p_params->p_tasksFileLock)) {
+		if ((FALSE == force) && (p_backlog->numberOfEntries < p_backlog->flushThreshold)) {
+			recordDeferredWritesSkip(p_params->p_deferredWrites);
+			return STATUS_CODE_SUCCESS;
+		}
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_WAITING_FOR_LOCK, 0);
+		if (WRITE_ACCESS_GRANTED != write_lock(p_params->p_tasksFileLock)) {
+			printf("Tasks file writing access failed...\n");
+			return STATUS_CODE_FAILURE;
+		}
+		forced = TRUE;
+	}
+	//------------------locked
+	reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, 0);
+	for (entryIndex = 0; (STATUS_CODE_SUCCESS == retVal) && (entryIndex < p_backlog->numberOfEntries); entryIndex++) {
+		p_entry = p_backlog->p_entries + entryIndex;
+		retVal = (1 < p_entry->numberOfOccurrences) ?
+			printSolvedTaskOccurrencesToTasksListFile(p_h_tasksListFile, p_entry->p_solution, p_entry->numberOfOccurrences) :
+			printSolvedTaskToTasksListFile(p_h_tasksListFile, p_entry->p_solution->p_numberPrimeFactorsString, p_entry->p_solution->stringSize);
+	}
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != write_release(p_params->p_tasksFileLock)) {
+		printf("Tasks file writing lock release failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	if (STATUS_CODE_FAILURE == retVal) return STATUS_CODE_FAILURE;
+
+	//The backlog's tasks are completed once their solutions were written
+	for (entryIndex = 0; entryIndex < p_backlog->numberOfEntries; entryIndex++) {
+		recordTaskCompletion(p_params, p_progress, p_backlog->p_entries[entryIndex].position);
+	}
+	recordDeferredWritesFlush(p_params->p_deferredWrites, p_backlog->numberOfEntries, forced);
+	clearDeferredWritesBacklog(p_backlog);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL bufferSolvedTask(threadPackage* p_params, HANDLE* p_h_tasksListFile, outputBuffer* p_outputBuffer, workerProgress* p_progress,
+	factorizedString* p_taskPrimeFactorsStringData, DWORDLONG numberOfOccurrences)
+{
+	DWORDLONG occurrenceIndex = 0;
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_outputBuffer);
+	assert(NULL != p_taskPrimeFactorsStringData);
+
+	//Appending the line once for every occurrence of the task - a full buffer is written first
+	for (occurrenceIndex = 0; occurrenceIndex < numberOfOccurrences; occurrenceIndex++) {
+		if (OUTPUT_BUFFER_FULL != (retVal = appendToOutputBuffer(p_outputBuffer, p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize))) {
+			if (STATUS_CODE_SUCCESS != retVal) return STATUS_CODE_FAILURE;
+			continue;
+		}
+		if (STATUS_CODE_SUCCESS != flushOutputBuffer(p_params, p_h_tasksListFile, p_outputBuffer, p_progress, OUTPUT_BUFFER_FLUSH_FULL)) return STATUS_CODE_FAILURE;
+		if (OUTPUT_BUFFER_FULL != (retVal = appendToOutputBuffer(p_outputBuffer, p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize))) {
+			if (STATUS_CODE_SUCCESS != retVal) return STATUS_CODE_FAILURE;
+			continue;
+		}
+
+		//The line is longer than a whole buffer - it is written on its' own
+		if (STATUS_CODE_SUCCESS != appendToTasksListFile(p_params, p_h_tasksListFile, p_progress,
+			p_taskPrimeFactorsStringData->p_numberPrimeFactorsString, p_taskPrimeFactorsStringData->stringSize)) return STATUS_CODE_FAILURE;
+		recordOversizedOutputLine(p_params->p_outputBuffering);
+	}
+
+	//Writing the buffer if its' oldest line stayed buffered for the flush interval
+	if (TRUE == isOutputBufferFlushDue(p_outputBuffer))
+		return flushOutputBuffer(p_params, p_h_tasksListFile, p_outputBuffer, p_progress, OUTPUT_BUFFER_FLUSH_TIMED);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL flushOutputBuffer(threadPackage* p_params, HANDLE* p_h_tasksListFile, outputBuffer* p_outputBuffer, workerProgress* p_progress, DWORD reason)
+{
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_h_tasksListFile);
+
+	//Nothing to write
+	if ((NULL == p_outputBuffer) || (0 == p_outputBuffer->numberOfLines)) return STATUS_CODE_SUCCESS;
+
+	if (STATUS_CODE_SUCCESS != appendToTasksListFile(p_params, p_h_tasksListFile, p_progress, p_outputBuffer->p_bytes, p_outputBuffer->numberOfBytes)) return STATUS_CODE_FAILURE;
+	recordOutputBufferFlush(p_params->p_outputBuffering, p_outputBuffer, reason);
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL appendToTasksListFile(threadPackage* p_params, HANDLE* p_h_tasksListFile, workerProgress* p_progress, LPTSTR p_bytes, DWORD numberOfBytes)
+{
+	BOOL retVal = STATUS_CODE_FAILURE;
+	//Asserts
+	assert(NULL != p_params);
+	assert(NULL != p_h_tasksListFile);
+	assert(NULL != p_bytes);
+
+	//Reserved appends - a reserved range of the output, written concurrently with the other threads
+	if (NULL != p_params->p_appendReservations) {
+		reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, 0);
+		return appendReservedBytes(p_params->p_appendReservations, p_params->p_tasksFileLock, p_h_tasksListFile, p_bytes, numberOfBytes);
+	}
+
+	reportWorkerActivity(p_progress, WORKER_ACTIVITY_WAITING_FOR_LOCK, 0);
+	if (WRITE_ACCESS_GRANTED != write_lock(p_params->p_tasksFileLock)) {
+		printf("Tasks file writing access failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	//------------------locked
+	reportWorkerActivity(p_progress, WORKER_ACTIVITY_WRITING, 0);
+	retVal = printSolvedTaskToTasksListFile(p_h_tasksListFile, p_bytes, numberOfBytes);
+	//----------------unlocking
+	if (STATUS_CODE_SUCCESS != write_release(p_params->p_tasksFileLock)) {
+		printf("Tasks file writing lock release failed...\n");
+		return STATUS_CODE_FAILURE;
+	}
+	return retVal;
+}
+
+static void recordTaskCompletion(threadPackage* p_params, workerProgress* p_progress, DWORDLONG position)
+{
+	//Assert
+	assert(NULL != p_params);
+
+	recordDeadlineFinish(p_params->p_deadlineSchedule, position);
+	reportWorkerTaskCompleted(p_params->p_progressWatchdog, p_progress);
+}
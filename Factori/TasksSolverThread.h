@@ -21,6 +21,19 @@
 #include "Lock.h"
 #include "ReceivePrimeFactorizedListString.h"
 #include "SolveTasks.h"
+#include "TasksContainer.h"
+#include "MappedFile.h"
+#include "WorkStealing.h"
+#include "TasksFeed.h"
+#include "ReorderBuffer.h"
+#include "SpeculativeTail.h"
+#include "DeadlineScheduling.h"
+#include "SizeClassLanes.h"
+#include "ProgressWatchdog.h"
+#include "DeferredWrites.h"
+#include "OutputBuffer.h"
+#include "AppendReservations.h"
+#include "WriterThread.h"
 
 
 
@@ -28,23 +41,30 @@
 /// <summary>
 /// Description - This function is the Thread routine. It receives a "threadPackage" data as input, which will contain the all the resources, and their locks,
 ///		needed to assist it execute the following routine, until there are no more tasks needed to be solved (Empty Tasks Priorities queue):
-///		1) write_lock the queue resource  
-///	    2) draw the most prioritized task offset from resource1-queue (top of the queue)   
-///		3) release writing lock (resource1)
-///	    4) fetch number of bytes in the received offset in Tasks file (from resouce2-Tasks file data struct - a Readers ONLY struct - no need for locking)
-///		5) read_lock resource3-Tasks file  
-///		6) fetch task's value   
-///		7) release read lock    
-///		8) solve task...   
-///		9) write_lock resource3   
-///		10) write to file the solution
-///		11) release writing lock  
-///		12) cycle back as long as the queue has values in it (will be check after relocking) 
-///		Finally, when the queue is empty, the thread will exit with Success code.
+///		1) claim the next position in the priority order (atomic fetch-and-add on a shared cursor - no lock)
+///	    2) draw the task offset at that position from resource1-queue (immutable while solving - no lock)
+///	    3) fetch number of bytes in the received offset in Tasks file (from resouce2-Tasks file data struct - a Readers ONLY struct - no need for locking)
+///		4) fetch task's value from resource3-Tasks file (a positional read on the thread's read-only Handle - no lock)
+///		5) solve task...   
+///		6) write_lock resource3 (with deferred writes - defer the solution & only try the lock, unless the thread's backlog is full. With
+///		   reserved appends - no lock, reserve the solution's range of the output instead. With a writer thread - no lock, push the solution to
+///		   the writer's ring instead, & the writer thread writes it)
+///		7) write to file the solution (with deferred writes - the whole backlog; with output buffering - append it to the thread's buffer, written once full or due)
+///		8) release writing lock  
+///		9) cycle back as long as the queue has unclaimed positions
+///		Finally, when all the queue's positions were claimed, the thread will exit with Success code.
 /// </summary>
 /// <param name="LPVOID lpParam - A void pointer to the shared-with-all-threads 'threadPackage' data struct"></param>
 /// <returns>A BOOL value representing the function's outcome (Thread has completed solving and printing to Tasks file all the tasks it took from the Tasks Priorities Queue). Success (TRUE) or Failure (FALSE)</returns>
 BOOL WINAPI tasksSolverThread(LPVOID lpParam);
+/// <summary>
+///	 Description - This function fetches the values of all the tasks to solve, in priority order, from the tasks' source in the threads'
+///		parameters struct (tasks container, or Queue & Tasks file) exactly as the threads would - which leaves the source exhausted.
+///		It must be called before the threads are created. The threads' parameters' numberOfTasks is updated with the # of tasks fetched.
+/// </summary>
+/// <param name="threadPackage* p_params - A pointer to the threads' parameters struct"></param>
+/// <returns>A pointer to a dynamically allocated array of the tasks' values (most prioritized first) if successful, or NULL if failed</returns>
+PDWORDLONG fetchAllTasksInPriorityOrder(threadPackage* p_params);
 
 
 #endif //__TASKS_SOLVER_THREAD_H__
@@ -0,0 +1,299 @@
+/* WorkStealing.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling Chase-Lev
+		work stealing deques, and a scheduler that dispatches the positions of the
+		priority order from a deque per thread: every thread pops its' own deque
+		without contention, and steals from other threads' deques once it is empty.
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "WorkStealing.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+
+static const DWORD RANDOM_STEAL_ATTEMPTS_PER_DEQUE = 2;	//Random victims tried (per deque) before a full sweep over all deques
+static const DWORD RANDOM_STATE_SEED = 2463534242;		//xorshift32 seed, mixed with the worker's index
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function reads a 64-bit value atomically (a plain read isn't atomic on 32-bit builds).
+/// </summary>
+/// <param name="volatile LONGLONG* p_value - A pointer to the value"></param>
+/// <returns>The value</returns>
+static LONGLONG atomicRead64(volatile LONGLONG* p_value);
+/// <summary>
+///  Description - This function advances a thread's xorshift32 random state & returns it.
+/// </summary>
+/// <param name="LPDWORD p_randomState - A pointer to the random state (never 0)"></param>
+/// <returns>The next random value</returns>
+static DWORD nextRandom(LPDWORD p_randomState);
+/// <summary>
+///  Description - This function steals a position from other threads' deques - firstly from randomly chosen victims, and then by a full
+///		sweep over all the deques, which is repeated as long as a steal was aborted (the deque might still have positions).
+/// </summary>
+/// <param name="workStealingScheduler* p_scheduler - A pointer to a workStealingScheduler struct"></param>
+/// <param name="taskPositionsRange* p_dispatchState - A pointer to the thief's private dispatch state"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the stolen position"></param>
+/// <returns>TRUE if a position was stolen, or FALSE if all the deques are empty</returns>
+static BOOL stealPosition(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState, PDWORDLONG p_position);
+/// <summary>
+///  Description - This function updates the scheduler's priority fidelity counters with a taken position: the position's start order,
+///		and the largest displacement between a start order and a position (atomic compare-and-swap maximum).
+/// </summary>
+/// <param name="workStealingScheduler* p_scheduler - A pointer to a workStealingScheduler struct"></param>
+/// <param name="DWORDLONG position - The taken position"></param>
+static void countStartedPosition(workStealingScheduler* p_scheduler, DWORDLONG position);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+BOOL PushBottom(workStealingDeque* p_deque, DWORDLONG position)
+{
+	LONGLONG bottom = 0, top = 0;
+	//Input integrity validation
+	if (NULL == p_deque) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	bottom = atomicRead64(&(p_deque->bottom));
+	top = atomicRead64(&(p_deque->top));
+	//The deque is full
+	if ((DWORDLONG)(bottom - top) >= p_deque->capacity) {
+		printf("Error: A work stealing deque is full (%llu positions).\n", p_deque->capacity);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//Writing the position & only then publishing it to the thieves (the exchange is a full barrier)
+	*(p_deque->p_positions + (DWORDLONG)bottom % p_deque->capacity) = position;
+	InterlockedExchange64(&(p_deque->bottom), bottom + 1);
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL PopBottom(workStealingDeque* p_deque, PDWORDLONG p_position)
+{
+	LONGLONG bottom = 0, top = 0;
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Input integrity validation
+	if ((NULL == p_deque) || (NULL == p_position)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	//Reserving the bottom position before looking at the top (the exchange is a full barrier - thieves see the reservation)
+	bottom = atomicRead64(&(p_deque->bottom)) - 1;
+	InterlockedExchange64(&(p_deque->bottom), bottom);
+	top = atomicRead64(&(p_deque->top));
+
+	//The deque was empty - undoing the reservation
+	if (top > bottom) {
+		InterlockedExchange64(&(p_deque->bottom), top);
+		return WORK_STEALING_DEQUE_EMPTY;
+	}
+
+	*p_position = *(p_deque->p_positions + (DWORDLONG)bottom % p_deque->capacity);
+	//More than a single position remained - no thief can reach the reserved one
+	if (top < bottom) return STATUS_CODE_SUCCESS;
+
+	//The last position - racing the thieves for it on the top index
+	if (top != InterlockedCompareExchange64(&(p_deque->top), top + 1, top)) retVal = WORK_STEALING_DEQUE_EMPTY;
+	InterlockedExchange64(&(p_deque->bottom), top + 1);
+	return retVal;
+}
+
+BOOL StealTop(workStealingDeque* p_deque, PDWORDLONG p_position)
+{
+	LONGLONG bottom = 0, top = 0;
+	DWORDLONG position = 0;
+	//Input integrity validation
+	if ((NULL == p_deque) || (NULL == p_position)) {
+		printf("Error: Bad input to function: %s\n", __func__);  return STATUS_CODE_FAILURE;
+	}
+
+	//Reading the top before the bottom (the atomic reads are full barriers)
+	top = atomicRead64(&(p_deque->top));
+	bottom = atomicRead64(&(p_deque->bottom));
+	if (top >= bottom) return WORK_STEALING_DEQUE_EMPTY;
+
+	//Reading the top position & claiming it - unless the owner or another thief claimed it first
+	position = *(p_deque->p_positions + (DWORDLONG)top % p_deque->capacity);
+	if (top != InterlockedCompareExchange64(&(p_deque->top), top + 1, top)) return WORK_STEALING_STEAL_ABORTED;
+	*p_position = position;
+	return STATUS_CODE_SUCCESS;
+}
+
+workStealingScheduler* buildWorkStealingScheduler(DWORD numberOfDeques, DWORDLONG numberOfPositions)
+{
+	workStealingScheduler* p_scheduler = NULL;
+	DWORD dequeIndex = 0;
+	DWORDLONG position = 0;
+	//Input integrity validation
+	if (0 == numberOfDeques) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//Memory allocation for the scheduler & its' deques
+	if ((NULL == (p_scheduler = (workStealingScheduler*)calloc(sizeof(workStealingScheduler), SINGLE_OBJECT))) ||
+		(NULL == (p_scheduler->p_deques = (workStealingDeque*)calloc(sizeof(workStealingDeque), numberOfDeques)))) {
+		printf("Error: Failed to allocate memory for the work stealing scheduler.\n");
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		free(p_scheduler);
+		return NULL;
+	}
+	p_scheduler->numberOfDeques = numberOfDeques;
+
+	//Every deque has room for its' entire stripe (at least one position)
+	for (dequeIndex = 0; dequeIndex < numberOfDeques; dequeIndex++) {
+		(p_scheduler->p_deques + dequeIndex)->capacity = numberOfPositions / numberOfDeques + 1;
+		if (NULL == ((p_scheduler->p_deques + dequeIndex)->p_positions = (PDWORDLONG)calloc(sizeof(DWORDLONG), (size_t)(p_scheduler->p_deques + dequeIndex)->capacity))) {
+			printf("Error: Failed to allocate memory for a work stealing deque.\n");
+			printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+			destroyWorkStealingScheduler(&p_scheduler);
+			return NULL;
+		}
+	}
+
+	//Seeding the stripes from the least urgent position backwards, so every deque's bottom (its' owner's end) is its' most urgent position
+	for (position = numberOfPositions; position > 0; position--) {
+		if (STATUS_CODE_SUCCESS != PushBottom(p_scheduler->p_deques + (position - 1) % numberOfDeques, position - 1)) {
+			destroyWorkStealingScheduler(&p_scheduler);
+			return NULL;
+		}
+	}
+
+	printf("Work stealing scheduler seeded %lu deques with %llu tasks.\n", (unsigned long)numberOfDeques, numberOfPositions);
+	return p_scheduler;
+}
+
+BOOL registerWorkStealingWorker(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState)
+{
+	LONG workerIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_scheduler) || (NULL == p_dispatchState)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//Handing the thread the next unowned deque
+	if ((DWORD)(workerIndex = InterlockedIncrement(&(p_scheduler->nextWorkerIndex)) - 1) >= p_scheduler->numberOfDeques) {
+		printf("Error: More threads than work stealing deques (%lu).\n", (unsigned long)p_scheduler->numberOfDeques);
+		return STATUS_CODE_FAILURE;
+	}
+	p_dispatchState->workerIndex = (DWORD)workerIndex;
+	p_dispatchState->randomState = RANDOM_STATE_SEED ^ ((DWORD)workerIndex * 2654435761UL);
+	if (0 == p_dispatchState->randomState) p_dispatchState->randomState = RANDOM_STATE_SEED;
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL takeWorkStealingPosition(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState, PDWORDLONG p_position)
+{
+	//Input integrity validation
+	if ((NULL == p_scheduler) || (NULL == p_dispatchState) || (NULL == p_position)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return FALSE;
+	}
+
+	//The thread's own deque first, then the other threads' deques
+	if (TRUE != PopBottom(p_scheduler->p_deques + p_dispatchState->workerIndex, p_position)) {
+		if (TRUE != stealPosition(p_scheduler, p_dispatchState, p_position)) return FALSE;
+		InterlockedIncrement64(&(p_scheduler->numberOfSteals));
+	}
+
+	countStartedPosition(p_scheduler, *p_position);
+	return TRUE;
+}
+
+void destroyWorkStealingScheduler(workStealingScheduler** p_p_scheduler)
+{
+	DWORD dequeIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_p_scheduler) || (NULL == *p_p_scheduler)) return;
+
+	//Free every deque's positions, the deques array & the scheduler
+	if (NULL != (*p_p_scheduler)->p_deques)
+		for (dequeIndex = 0; dequeIndex < (*p_p_scheduler)->numberOfDeques; dequeIndex++)
+			free(((*p_p_scheduler)->p_deques + dequeIndex)->p_positions);
+	free((*p_p_scheduler)->p_deques);
+	free(*p_p_scheduler);
+	*p_p_scheduler = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static LONGLONG atomicRead64(volatile LONGLONG* p_value)
+{
+	//Comparing with (& exchanging for) the same value never modifies it
+	return InterlockedCompareExchange64(p_value, 0, 0);
+}
+
+static DWORD nextRandom(LPDWORD p_randomState)
+{
+	*p_randomState ^= *p_randomState << 13;
+	*p_randomState ^= *p_randomState >> 17;
+	*p_randomState ^= *p_randomState << 5;
+	return *p_randomState;
+}
+
+static BOOL stealPosition(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState, PDWORDLONG p_position)
+{
+	DWORD attempt = 0, victim = 0;
+	BOOL retVal = WORK_STEALING_DEQUE_EMPTY, abortedSteal = FALSE;
+	//Asserts
+	assert(NULL != p_scheduler);
+	assert(NULL != p_dispatchState);
+
+	//A single thread has no victims
+	if (1 == p_scheduler->numberOfDeques) return FALSE;
+
+	//Randomly chosen victims (never the thief itself)
+	for (attempt = 0; attempt < RANDOM_STEAL_ATTEMPTS_PER_DEQUE * p_scheduler->numberOfDeques; attempt++) {
+		victim = nextRandom(&(p_dispatchState->randomState)) % (p_scheduler->numberOfDeques - 1);
+		if (victim >= p_dispatchState->workerIndex) victim++;
+		if (TRUE == StealTop(p_scheduler->p_deques + victim, p_position)) return TRUE;
+	}
+
+	//Full sweeps over all the deques - all empty (no steal was aborted) means no positions remain, since the deques aren't refilled
+	do {
+		abortedSteal = FALSE;
+		for (victim = 0; victim < p_scheduler->numberOfDeques; victim++) {
+			if (TRUE == (retVal = StealTop(p_scheduler->p_deques + victim, p_position))) return TRUE;
+			if (WORK_STEALING_STEAL_ABORTED == retVal) abortedSteal = TRUE;
+		}
+	} while (TRUE == abortedSteal);
+
+	return FALSE;
+}
+
+static void countStartedPosition(workStealingScheduler* p_scheduler, DWORDLONG position)
+{
+	LONGLONG startOrder = 0, displacement = 0, maximalDisplacement = 0;
+	//Assert
+	assert(NULL != p_scheduler);
+
+	//The task's start order & its' distance from the task's position in the priority order
+	startOrder = InterlockedIncrement64(&(p_scheduler->numberOfStartedTasks)) - 1;
+	displacement = (startOrder > (LONGLONG)position) ? (startOrder - (LONGLONG)position) : ((LONGLONG)position - startOrder);
+
+	//Raising the maximal displacement (compare-and-swap loop)
+	do {
+		maximalDisplacement = atomicRead64(&(p_scheduler->maximalDisplacement));
+		if (displacement <= maximalDisplacement) return;
+	} while (maximalDisplacement != InterlockedCompareExchange64(&(p_scheduler->maximalDisplacement), displacement, maximalDisplacement));
+}
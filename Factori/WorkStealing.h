@@ -0,0 +1,84 @@
+/* WorkStealing.h
+----------------------------------------------------------
+	Module Description - header module for WorkStealing.c
+----------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __WORK_STEALING_H__
+#define __WORK_STEALING_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+
+
+// Constants ---------------------------------------------------
+	//PopBottom(.) & StealTop(.) outcomes (besides TRUE - a position was taken, & FALSE - failure)
+#define WORK_STEALING_DEQUE_EMPTY 2		// The deque has no positions
+#define WORK_STEALING_STEAL_ABORTED 3	// Another thread took the top position first - the deque may still have positions
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function pushes a position to the bottom end of a work stealing deque. Only the deque's owner may push.
+/// </summary>
+/// <param name="workStealingDeque* p_deque - A pointer to a workStealingDeque struct"></param>
+/// <param name="DWORDLONG position - The position to push"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. the deque is full</returns>
+BOOL PushBottom(workStealingDeque* p_deque, DWORDLONG position);
+/// <summary>
+///	 Description - This function pops the position at the bottom end of a work stealing deque (the last pushed). Only the deque's owner
+///		may pop. If a single position remains, the owner races the thieves for it with a compare-and-swap on the top index.
+/// </summary>
+/// <param name="workStealingDeque* p_deque - A pointer to a workStealingDeque struct"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the popped position"></param>
+/// <returns>TRUE if a position was popped, WORK_STEALING_DEQUE_EMPTY otherwise</returns>
+BOOL PopBottom(workStealingDeque* p_deque, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function steals the position at the top end of a work stealing deque (the first pushed). Any thread may steal.
+/// </summary>
+/// <param name="workStealingDeque* p_deque - A pointer to a workStealingDeque struct"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the stolen position"></param>
+/// <returns>TRUE if a position was stolen, WORK_STEALING_DEQUE_EMPTY, or WORK_STEALING_STEAL_ABORTED if another thread won the race</returns>
+BOOL StealTop(workStealingDeque* p_deque, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function builds a work stealing scheduler with a deque per thread, and seeds the deques round-robin by priority
+///		stripes: position p goes to deque (p % numberOfDeques). Every deque is seeded with its' least urgent position first, so its' owner
+///		pops its' stripe in priority order, while thieves steal the victim's least urgent remaining positions.
+/// </summary>
+/// <param name="DWORD numberOfDeques - The number of deques (threads)"></param>
+/// <param name="DWORDLONG numberOfPositions - The number of positions in the priority order (0 ... numberOfPositions-1)"></param>
+/// <returns>A pointer to a dynamically allocated 'workStealingScheduler' struct if successful, or NULL if failed</returns>
+workStealingScheduler* buildWorkStealingScheduler(DWORD numberOfDeques, DWORDLONG numberOfPositions);
+/// <summary>
+///	 Description - This function hands a starting thread its' own deque (the next unowned one) & seeds its' random victim selection.
+/// </summary>
+/// <param name="workStealingScheduler* p_scheduler - A pointer to a workStealingScheduler struct"></param>
+/// <param name="taskPositionsRange* p_dispatchState - A pointer to the thread's private dispatch state"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) e.g. more threads than deques</returns>
+BOOL registerWorkStealingWorker(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState);
+/// <summary>
+///	 Description - This function takes the next position for a thread: it pops from the thread's own deque, and once it is empty, steals
+///		from randomly chosen victims. Since the deques aren't refilled while solving, no positions remain once a full sweep over all the deques
+///		finds them empty. Every taken position updates the scheduler's counters.
+/// </summary>
+/// <param name="workStealingScheduler* p_scheduler - A pointer to a workStealingScheduler struct"></param>
+/// <param name="taskPositionsRange* p_dispatchState - A pointer to the thread's private dispatch state (registered)"></param>
+/// <param name="PDWORDLONG p_position - A pointer to the variable that will be updated with the position"></param>
+/// <returns>TRUE if a position was taken, or FALSE if no positions remain</returns>
+BOOL takeWorkStealingPosition(workStealingScheduler* p_scheduler, taskPositionsRange* p_dispatchState, PDWORDLONG p_position);
+/// <summary>
+///	 Description - This function frees a work stealing scheduler with its' deques and sets its' pointer to NULL.
+/// </summary>
+/// <param name="workStealingScheduler** p_p_scheduler - A pointer to a pointer to a 'workStealingScheduler' struct"></param>
+void destroyWorkStealingScheduler(workStealingScheduler** p_p_scheduler);
+
+
+#endif //__WORK_STEALING_H__
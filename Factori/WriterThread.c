@@ -0,0 +1,465 @@
+/* WriterThread.c
+------------------------------------------------------------------------------------------
+	Module Description - This module contains functions meant for handling the writer
+		thread: the workers push their solutions to a bounded lock-free ring (multiple
+		producers), & a single writer thread drains it, batching the solutions' lines
+		into large sequential writes to the Tasks file - the workers never wait for the
+		disk, only for a vacant slot while the ring is full (backpressure)
+------------------------------------------------------------------------------------------
+*/
+
+// Library includes ----------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Windows.h>
+#include <assert.h>
+
+
+// Projects includes ---------------------------------------------------------------------
+#include "WriterThread.h"
+
+
+// Constants -----------------------------------------------------------------------------
+static const BOOL  STATUS_CODE_FAILURE = FALSE;
+static const BOOL  STATUS_CODE_SUCCESS = TRUE;
+
+static const DWORD SINGLE_OBJECT = 1;
+static const int   DEFAULT_THREAD_STACK_SIZE = 0;
+
+static const LONG  WRITER_RING_MINIMAL_CAPACITY = 2;		//A filled slot must differ from a vacant one by its' sequence
+static const DWORD WRITER_RING_PRODUCER_SPINS = 64;			//A producer facing a full ring re-checks its' slot this many times before it parks
+static const DWORD WRITER_BATCH_SIZE = 65536;				//# of bytes the writer gathers before a write (unless the ring runs dry first)
+
+static const BOOL  STATUS_FILE_WRITING_FAILED = (BOOL)0;
+
+
+
+
+// Functions declerations ------------------------------------------------------------------
+/// <summary>
+///  Description - This function claims the next position of the ring (compare-and-swap, no lock), waiting while the ring is full, & fills
+///		its' slot. The writer is woken up if it is parked.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <param name="factorizedString* p_solution - A pointer to the solution (NULL - the closing marker)"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the solution is written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) if the ring was abandoned (nothing was pushed)</returns>
+static BOOL pushToRingSlot(writerRing* p_ring, factorizedString* p_solution, DWORDLONG numberOfOccurrences);
+/// <summary>
+///  Description - This function abandons the ring once the solving failed: the writer terminates without draining the ring, & the parked
+///		producers stop waiting for it. Nothing waits for the writer, so a writer stuck in a write holds no other thread.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+static void abandonWriterRing(writerRing* p_ring);
+/// <summary>
+///  Description - This function is the writer thread's routine: it takes the ring's solutions in their push order, gathers their lines in
+///		a batch & writes the batch to the end of the Tasks file once it is full or the ring ran dry (then parks until the next push). The
+///		writer terminates once it takes the closing marker, or once the ring is abandoned. After a failed write it keeps taking (and discarding)
+///		the solutions, so no producer waits.
+/// </summary>
+/// <param name="LPVOID lpParam - A pointer to the writer's ring"></param>
+/// <returns>A DWORD value representing the writer's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static DWORD WINAPI writerThread(LPVOID lpParam);
+/// <summary>
+///  Description - This function gathers a solution's lines (once per occurrence) in the writer's batch, writing the batch first whenever a
+///		line doesn't fit in it. A line longer than a whole batch is written on its' own.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <param name="HANDLE h_tasksFile - The writer's Handle of the Tasks list file"></param>
+/// <param name="LPTSTR p_batch - A pointer to the batch's bytes"></param>
+/// <param name="DWORD* p_batchSize - A pointer to the # of bytes in the batch"></param>
+/// <param name="DWORD* p_batchLines - A pointer to the # of lines in the batch"></param>
+/// <param name="factorizedString* p_solution - A pointer to the solution"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the solution is written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL batchSolution(writerRing* p_ring, HANDLE h_tasksFile, LPTSTR p_batch, DWORD* p_batchSize, DWORD* p_batchLines,
+	factorizedString* p_solution, DWORDLONG numberOfOccurrences);
+/// <summary>
+///  Description - This function writes bytes at the Tasks file's Handle's file pointer (the end of the output - the writer is the file's
+///		only writer) & records the write in the ring's statistics.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <param name="HANDLE h_tasksFile - The writer's Handle of the Tasks list file"></param>
+/// <param name="LPTSTR p_bytes - A pointer to the bytes to write"></param>
+/// <param name="DWORD numberOfBytes - The # of bytes to write (0 - nothing is written)"></param>
+/// <param name="DWORD numberOfLines - The # of solutions' lines in the bytes"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+static BOOL writeToTasksFile(writerRing* p_ring, HANDLE h_tasksFile, LPTSTR p_bytes, DWORD numberOfBytes, DWORD numberOfLines);
+
+
+
+
+// Functions definitions -------------------------------------------------------------------
+
+writerRing* buildWriterRing(char* p_filePath, LONG capacity)
+{
+	writerRing* p_ring = NULL;
+	LONG roundedCapacity = WRITER_RING_MINIMAL_CAPACITY, slotIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_filePath) || (0 >= capacity)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return NULL;
+	}
+
+	//A power of two - the positions keep mapping to the same slots when they wrap around
+	while ((roundedCapacity < capacity) && (0 < (roundedCapacity << 1))) roundedCapacity <<= 1;
+
+	//Memory allocation for the ring & its' slots
+	if ((NULL == (p_ring = (writerRing*)calloc(sizeof(writerRing), SINGLE_OBJECT))) ||
+		(NULL == (p_ring->p_slots = (writerRingSlot*)calloc(sizeof(writerRingSlot), (size_t)roundedCapacity)))) {
+		printf("Error: Failed to allocate memory for the writer's ring of %ld slots.\n", (long)roundedCapacity);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		destroyWriterRing(&p_ring);
+		return NULL;
+	}
+	p_ring->capacity = roundedCapacity;
+	p_ring->p_tasksFilePath = p_filePath;
+
+	//Every slot is vacant for its' first position
+	for (slotIndex = 0; slotIndex < roundedCapacity; slotIndex++) p_ring->p_slots[slotIndex].sequence = slotIndex;
+	return p_ring;
+}
+
+BOOL startWriterThread(writerRing* p_ring)
+{
+	//Input integrity validation
+	if ((NULL == p_ring) || (NULL != p_ring->h_writerThread)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	p_ring->h_writerThread = CreateThread(NULL, DEFAULT_THREAD_STACK_SIZE, writerThread, p_ring, 0, NULL);
+	if (NULL == p_ring->h_writerThread) {
+		printf("Error: Failed to create the writer thread, with code: %d.\n", GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL pushToWriterRing(writerRing* p_ring, factorizedString* p_solution, DWORDLONG numberOfOccurrences)
+{
+	//Input integrity validation
+	if ((NULL == p_ring) || (NULL == p_solution) || (0 == numberOfOccurrences)) {
+		printf("Error: Bad inputs to function: %s\n", __func__);
+		if (NULL != p_solution) freeTheString(p_solution);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The writer failed - the solution would never be written
+	if (FALSE != p_ring->writerFailed) {
+		freeTheString(p_solution);
+		return STATUS_CODE_FAILURE;
+	}
+
+	if (STATUS_CODE_SUCCESS != pushToRingSlot(p_ring, p_solution, numberOfOccurrences)) {
+		freeTheString(p_solution);
+		return STATUS_CODE_FAILURE;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+BOOL closeWriterRing(writerRing* p_ring, DWORD stallWindowMilliseconds)
+{
+	DWORD exitCode = STATUS_CODE_FAILURE, waitCode = WAIT_TIMEOUT;
+	LONG lastPosition = 0;
+	//Input integrity validation
+	if ((NULL == p_ring) || (NULL == p_ring->h_writerThread) || (0 == stallWindowMilliseconds)) {
+		printf("Error: Bad inputs to function: %s\n", __func__); return STATUS_CODE_FAILURE;
+	}
+
+	//The closing marker follows all the pushed solutions - the writer writes them first (pushed once, even if called again)
+	if ((FALSE == InterlockedExchange(&(p_ring->closed), TRUE)) && (STATUS_CODE_SUCCESS != pushToRingSlot(p_ring, NULL, 0))) return STATUS_CODE_FAILURE;
+
+	//Waiting for the writer a stall window at a time - as long as it takes solutions, it isn't stuck (e.g. in a write to a hung disk)
+	lastPosition = p_ring->popPosition;
+	while (WAIT_TIMEOUT == (waitCode = WaitForSingleObject(p_ring->h_writerThread, stallWindowMilliseconds))) {
+		if (lastPosition == p_ring->popPosition) {
+			printf("Error: The writer thread took no solution for %lu ms - it is abandoned.\n", (unsigned long)stallWindowMilliseconds);
+			abandonWriterRing(p_ring);
+			return STATUS_CODE_FAILURE;
+		}
+		lastPosition = p_ring->popPosition;
+	}
+	if (WAIT_OBJECT_0 != waitCode) {
+		printf("Error: Failed to wait for the writer thread, with code: %d.\n", GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		abandonWriterRing(p_ring);
+		return STATUS_CODE_FAILURE;
+	}
+	p_ring->writerJoined = TRUE;
+	if (FALSE == GetExitCodeThread(p_ring->h_writerThread, &exitCode)) {
+		printf("Error when getting the writer thread's exit code, with code: %d\n", GetLastError());
+		return STATUS_CODE_FAILURE;
+	}
+	return (STATUS_CODE_SUCCESS == (BOOL)exitCode) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE;
+}
+
+void printWriterRingStatistics(writerRing* p_ring)
+{
+	//Input integrity validation
+	if (NULL == p_ring) return;
+
+	printf("Writer thread: %ld slots, %ld solutions pushed, %ld pushes found the ring full (%ld producer parks), ring depth %.2f on average & %ld at most\n",
+		(long)p_ring->capacity, (long)p_ring->numberOfPushes, (long)p_ring->numberOfStalls, (long)p_ring->numberOfProducerParks,
+		(0 < p_ring->numberOfPushes) ? (double)p_ring->totalQueueDepth / p_ring->numberOfPushes : 0.0, (long)p_ring->maximalQueueDepth);
+	printf("\t%ld writes, %lld lines (%lld bytes) written, %.0f bytes per write on average & %lu at most, the writer parked %ld times\n\n",
+		(long)p_ring->numberOfWrites, p_ring->numberOfWrittenLines, p_ring->numberOfWrittenBytes,
+		(0 < p_ring->numberOfWrites) ? (double)p_ring->numberOfWrittenBytes / p_ring->numberOfWrites : 0.0, (unsigned long)p_ring->maximalWriteSize,
+		(long)p_ring->numberOfWriterParks);
+}
+
+void destroyWriterRing(writerRing** p_p_ring)
+{
+	LONG slotIndex = 0;
+	//Input integrity validation
+	if ((NULL == p_p_ring) || (NULL == *p_p_ring)) return;
+
+	//The solving failed before the writer was joined - the writer is abandoned (never waited for), & the ring is left allocated, since
+	// the writer & workers that weren't joined may still touch it (the process exits on the failure)
+	if (NULL != (*p_p_ring)->h_writerThread) {
+		CloseHandle((*p_p_ring)->h_writerThread);
+		if (FALSE == (*p_p_ring)->writerJoined) {
+			abandonWriterRing(*p_p_ring);
+			*p_p_ring = NULL;
+			return;
+		}
+	}
+	if (NULL != (*p_p_ring)->p_slots) {
+		for (slotIndex = 0; slotIndex < (*p_p_ring)->capacity; slotIndex++)
+			if (NULL != (*p_p_ring)->p_slots[slotIndex].p_solution) freeTheString((*p_p_ring)->p_slots[slotIndex].p_solution);
+		free((*p_p_ring)->p_slots);
+	}
+	free(*p_p_ring);
+	*p_p_ring = NULL;
+}
+
+
+
+
+//......................................Static functions..........................................
+
+static BOOL pushToRingSlot(writerRing* p_ring, factorizedString* p_solution, DWORDLONG numberOfOccurrences)
+{
+	writerRingSlot* p_slot = NULL;
+	LONG position = 0, sequence = 0, queueDepth = 0, maximalQueueDepth = 0;
+	DWORD spins = 0;
+	BOOL stalled = FALSE;
+	//Assert
+	assert(NULL != p_ring);
+
+	position = p_ring->pushPosition;
+	while (TRUE) {
+		p_slot = &(p_ring->p_slots[(ULONG)position & (ULONG)(p_ring->capacity - 1)]);
+		sequence = p_slot->sequence;
+
+		//The slot is vacant for the position - claiming the position (unless another producer claimed it meanwhile)
+		if (sequence == position) {
+			if (position == InterlockedCompareExchange(&(p_ring->pushPosition), position + 1, position)) break;
+			position = p_ring->pushPosition;
+		}
+		//The slot still holds the solution a whole ring earlier - the ring is full
+		else if (0 > (LONG)((ULONG)sequence - (ULONG)position)) {
+			//The writer won't vacate the slot anymore
+			if (FALSE != p_ring->abandoned) return STATUS_CODE_FAILURE;
+			if (FALSE == stalled) {
+				stalled = TRUE;
+				InterlockedIncrement(&(p_ring->numberOfStalls));
+			}
+			//Spinning briefly (the writer may be about to take the slot), then parking on the slot until the writer vacates it
+			if (WRITER_RING_PRODUCER_SPINS > spins++) YieldProcessor();
+			else {
+				InterlockedIncrement(&(p_ring->numberOfParkedProducers));
+				if ((sequence == p_slot->sequence) && (FALSE == p_ring->abandoned)) {
+					InterlockedIncrement(&(p_ring->numberOfProducerParks));
+					WaitOnAddress(&(p_slot->sequence), &sequence, sizeof(LONG), INFINITE);
+				}
+				InterlockedDecrement(&(p_ring->numberOfParkedProducers));
+				spins = 0;
+			}
+			position = p_ring->pushPosition;
+		}
+		//Another producer claimed the position already
+		else position = p_ring->pushPosition;
+	}
+
+	//Filling the slot - it is the producer's own until it is published
+	p_slot->p_solution = p_solution;
+	p_slot->numberOfOccurrences = numberOfOccurrences;
+	if (NULL != p_solution) {
+		InterlockedIncrement(&(p_ring->numberOfPushes));
+		queueDepth = (LONG)((ULONG)position + 1 - (ULONG)p_ring->popPosition);
+		InterlockedExchangeAdd64(&(p_ring->totalQueueDepth), (LONGLONG)queueDepth);
+		//Raising the deepest depth (retrying if another producer raised it meanwhile)
+		while ((maximalQueueDepth = p_ring->maximalQueueDepth) < queueDepth)
+			if (maximalQueueDepth == InterlockedCompareExchange(&(p_ring->maximalQueueDepth), queueDepth, maximalQueueDepth)) break;
+	}
+
+	//Publishing the slot to the writer (a full barrier - the parked flag is read after it), & waking the writer if it waits
+	InterlockedExchange(&(p_slot->sequence), position + 1);
+	if (FALSE != p_ring->writerParked) {
+		InterlockedIncrement(&(p_ring->writerWakes));
+		WakeByAddressSingle((PVOID)&(p_ring->writerWakes));
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static void abandonWriterRing(writerRing* p_ring)
+{
+	LONG slotIndex = 0;
+	//Assert
+	assert(NULL != p_ring);
+
+	//Abandoned once - the flags are raised before the wakes, & a parked thread re-checks them before it parks again
+	if (FALSE != InterlockedExchange(&(p_ring->abandoned), TRUE)) return;
+	InterlockedExchange(&(p_ring->writerFailed), TRUE);
+	InterlockedIncrement(&(p_ring->writerWakes));
+	WakeByAddressSingle((PVOID)&(p_ring->writerWakes));
+	for (slotIndex = 0; slotIndex < p_ring->capacity; slotIndex++) WakeByAddressAll((PVOID)&(p_ring->p_slots[slotIndex].sequence));
+}
+
+static DWORD WINAPI writerThread(LPVOID lpParam)
+{
+	writerRing* p_ring = (writerRing*)lpParam;
+	writerRingSlot* p_slot = NULL;
+	factorizedString* p_solution = NULL;
+	DWORDLONG numberOfOccurrences = 0;
+	HANDLE h_tasksFile = INVALID_HANDLE_VALUE;
+	LARGE_INTEGER distanceToEnd;
+	LPTSTR p_batch = NULL;
+	DWORD batchSize = 0, batchLines = 0;
+	LONG position = 0, vacantSequence = 0, observedWakes = 0;
+	BOOL retVal = STATUS_CODE_SUCCESS;
+	//Assert
+	assert(NULL != p_ring);
+
+	//The writer's own Handle - it is the file's only writer, so the output continues at the file pointer
+	h_tasksFile = CreateFile(
+		p_ring->p_tasksFilePath,			// Const null - terminated string describing the file's path
+		GENERIC_WRITE,						// Appending the solutions
+		FILE_SHARE_READ | FILE_SHARE_WRITE,	// Share Mode: the workers read their tasks meanwhile
+		NULL,								// No Security Attributes
+		OPEN_EXISTING,						// The Tasks file must exist
+		FILE_ATTRIBUTE_NORMAL,				// No special attributes
+		NULL								// No Template
+	);
+	distanceToEnd.QuadPart = 0;
+	if ((INVALID_HANDLE_VALUE == h_tasksFile) || (FALSE == SetFilePointerEx(h_tasksFile, distanceToEnd, NULL, FILE_END))) {
+		printf("Error: Failed to open the Tasks file '%s' for the writer thread, with code: %d.\n", p_ring->p_tasksFilePath, GetLastError());
+		retVal = STATUS_CODE_FAILURE;
+	}
+	else if (NULL == (p_batch = (LPTSTR)malloc(WRITER_BATCH_SIZE))) {
+		printf("Error: Failed to allocate memory for the writer's batch of %lu bytes.\n", (unsigned long)WRITER_BATCH_SIZE);
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		retVal = STATUS_CODE_FAILURE;
+	}
+	if (STATUS_CODE_SUCCESS != retVal) InterlockedExchange(&(p_ring->writerFailed), TRUE);
+
+	while (TRUE) {
+		//The solving failed - the rest of the ring is left as is
+		if (FALSE != p_ring->abandoned) {
+			retVal = STATUS_CODE_FAILURE;
+			break;
+		}
+		position = p_ring->popPosition;
+		p_slot = &(p_ring->p_slots[(ULONG)position & (ULONG)(p_ring->capacity - 1)]);
+
+		//The ring ran dry - writing the batch, then parking until the slot is published
+		if (position + 1 != p_slot->sequence) {
+			if ((STATUS_CODE_SUCCESS == retVal) && (STATUS_CODE_SUCCESS != writeToTasksFile(p_ring, h_tasksFile, p_batch, batchSize, batchLines))) {
+				retVal = STATUS_CODE_FAILURE;
+				InterlockedExchange(&(p_ring->writerFailed), TRUE);
+			}
+			batchSize = 0;
+			batchLines = 0;
+			//The wakes' word is read & the parked flag raised before the slot is re-checked (a full barrier), so a publish (or the ring's
+			// abandonment) in between raises the word, & the park returns right away
+			vacantSequence = position;
+			observedWakes = p_ring->writerWakes;
+			InterlockedExchange(&(p_ring->writerParked), TRUE);
+			if ((vacantSequence == p_slot->sequence) && (FALSE == p_ring->abandoned)) {
+				p_ring->numberOfWriterParks++;
+				WaitOnAddress(&(p_ring->writerWakes), &observedWakes, sizeof(LONG), INFINITE);
+			}
+			InterlockedExchange(&(p_ring->writerParked), FALSE);
+			continue;
+		}
+
+		//Taking the solution & vacating the slot for the position a whole ring later (waking the producers parked on it)
+		p_solution = p_slot->p_solution;
+		numberOfOccurrences = p_slot->numberOfOccurrences;
+		p_slot->p_solution = NULL;
+		InterlockedExchange(&(p_slot->sequence), position + p_ring->capacity);
+		InterlockedExchange(&(p_ring->popPosition), position + 1);
+		if (0 < p_ring->numberOfParkedProducers) WakeByAddressAll((PVOID)&(p_slot->sequence));
+
+		//The closing marker - every solution pushed before it was taken
+		if (NULL == p_solution) break;
+
+		if ((STATUS_CODE_SUCCESS == retVal) &&
+			(STATUS_CODE_SUCCESS != batchSolution(p_ring, h_tasksFile, p_batch, &batchSize, &batchLines, p_solution, numberOfOccurrences))) {
+			retVal = STATUS_CODE_FAILURE;
+			InterlockedExchange(&(p_ring->writerFailed), TRUE);
+		}
+		freeTheString(p_solution);
+	}
+
+	//The rest of the batch (unless the ring was abandoned)
+	if ((STATUS_CODE_SUCCESS == retVal) && (STATUS_CODE_SUCCESS != writeToTasksFile(p_ring, h_tasksFile, p_batch, batchSize, batchLines)))
+		retVal = STATUS_CODE_FAILURE;
+
+	if (INVALID_HANDLE_VALUE != h_tasksFile) CloseHandle(h_tasksFile);
+	free(p_batch);
+	return (DWORD)retVal;
+}
+
+static BOOL batchSolution(writerRing* p_ring, HANDLE h_tasksFile, LPTSTR p_batch, DWORD* p_batchSize, DWORD* p_batchLines,
+	factorizedString* p_solution, DWORDLONG numberOfOccurrences)
+{
+	DWORDLONG occurrence = 0;
+	//Asserts
+	assert(NULL != p_batch);
+	assert((NULL != p_batchSize) && (NULL != p_batchLines));
+	assert(NULL != p_solution);
+
+	for (occurrence = 0; occurrence < numberOfOccurrences; occurrence++) {
+		//The line doesn't fit - writing the batch first
+		if (p_solution->stringSize > WRITER_BATCH_SIZE - *p_batchSize) {
+			if (STATUS_CODE_SUCCESS != writeToTasksFile(p_ring, h_tasksFile, p_batch, *p_batchSize, *p_batchLines)) return STATUS_CODE_FAILURE;
+			*p_batchSize = 0;
+			*p_batchLines = 0;
+		}
+		//A line longer than a whole batch is written on its' own
+		if (p_solution->stringSize > WRITER_BATCH_SIZE) {
+			if (STATUS_CODE_SUCCESS != writeToTasksFile(p_ring, h_tasksFile, p_solution->p_numberPrimeFactorsString, p_solution->stringSize, 1))
+				return STATUS_CODE_FAILURE;
+			continue;
+		}
+		memcpy(p_batch + *p_batchSize, p_solution->p_numberPrimeFactorsString, p_solution->stringSize);
+		*p_batchSize += p_solution->stringSize;
+		(*p_batchLines)++;
+	}
+	return STATUS_CODE_SUCCESS;
+}
+
+static BOOL writeToTasksFile(writerRing* p_ring, HANDLE h_tasksFile, LPTSTR p_bytes, DWORD numberOfBytes, DWORD numberOfLines)
+{
+	DWORD numberOfBytesWritten = 0;
+	//Asserts
+	assert(NULL != p_ring);
+
+	if (0 == numberOfBytes) return STATUS_CODE_SUCCESS;
+
+	if ((STATUS_FILE_WRITING_FAILED == WriteFile(h_tasksFile, p_bytes, numberOfBytes, &numberOfBytesWritten, NULL)) ||
+		(numberOfBytesWritten != numberOfBytes)) {
+		printf("Error: Failed to write %lu bytes of solutions to the Tasks file, with code: %d.\n", (unsigned long)numberOfBytes, GetLastError());
+		printf("At file: %s\nAt line number: %d\nAt function: %s\n\n\n", __FILE__, __LINE__, __func__);
+		return STATUS_CODE_FAILURE;
+	}
+
+	//The writer's own statistics (read only once it terminated)
+	p_ring->numberOfWrites++;
+	p_ring->numberOfWrittenBytes += numberOfBytes;
+	p_ring->numberOfWrittenLines += numberOfLines;
+	if (p_ring->maximalWriteSize < numberOfBytes) p_ring->maximalWriteSize = numberOfBytes;
+	return STATUS_CODE_SUCCESS;
+}
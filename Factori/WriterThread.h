@@ -0,0 +1,68 @@
+/* WriterThread.h
+--------------------------------------------------------
+	Module Description - header module for WriterThread.c
+--------------------------------------------------------
+*/
+
+
+#pragma once
+#ifndef __WRITER_THREAD_H__
+#define __WRITER_THREAD_H__
+
+
+// Library includes --------------------------------------------
+#include <Windows.h>
+
+
+// Projects includes -------------------------------------------
+#include "HardCodedData.h"
+#include "MemoryHandling.h"
+
+
+//Functions Declarations
+
+/// <summary>
+///	 Description - This function builds the writer's ring: every slot is vacant for its' first position, & the statistics are zeroed.
+/// </summary>
+/// <param name="char* p_filePath - A pointer to the Tasks list file path (the writer appends to it)"></param>
+/// <param name="LONG capacity - The # of slots in the ring (at least 1)"></param>
+/// <returns>A pointer to a dynamically allocated 'writerRing' struct if successful, or NULL if failed</returns>
+writerRing* buildWriterRing(char* p_filePath, LONG capacity);
+/// <summary>
+///	 Description - This function starts the writer thread, which drains the ring into the Tasks file until the ring is closed.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL startWriterThread(writerRing* p_ring);
+/// <summary>
+///	 Description - This function pushes a solved task's solution to the ring (the ring owns the solution from now on, even if failed). The
+///		slot is claimed with a compare-and-swap - no lock. While the ring is full the producer spins briefly, then parks on the slot until
+///		the writer vacates it (backpressure), so a producer waits only for the writer's pace, never for the disk directly.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <param name="factorizedString* p_solution - A pointer to the task's solution"></param>
+/// <param name="DWORDLONG numberOfOccurrences - The # of times the solution is written"></param>
+/// <returns>A BOOL value representing the function's outcome. Success (TRUE) or Failure (FALSE) if the writer failed</returns>
+BOOL pushToWriterRing(writerRing* p_ring, factorizedString* p_solution, DWORDLONG numberOfOccurrences);
+/// <summary>
+///	 Description - This function closes the ring & waits for the writer thread to write the rest of it and terminate. It must be called
+///		once no thread pushes anymore. A writer that takes no solution within a stall window (e.g. stuck in a write) is abandoned, not waited for.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring"></param>
+/// <param name="DWORD stallWindowMilliseconds - The longest time the writer may take no solution in"></param>
+/// <returns>A BOOL value representing the writer's outcome. Success (TRUE) or Failure (FALSE)</returns>
+BOOL closeWriterRing(writerRing* p_ring, DWORD stallWindowMilliseconds);
+/// <summary>
+///	 Description - This function prints the writer's statistics - the stalled pushes, the ring's depth & the writes' sizes.
+/// </summary>
+/// <param name="writerRing* p_ring - A pointer to the writer's ring (NULL - nothing is printed)"></param>
+void printWriterRingStatistics(writerRing* p_ring);
+/// <summary>
+///	 Description - This function frees the ring with any solutions left in it & sets its' pointer to NULL. If the writer wasn't joined (the
+///		solving failed), the writer is abandoned without waiting for it, & the ring is left allocated - the writer & workers may still touch it.
+/// </summary>
+/// <param name="writerRing** p_p_ring - A pointer to a pointer to a 'writerRing' struct"></param>
+void destroyWriterRing(writerRing** p_p_ring);
+
+
+#endif //__WRITER_THREAD_H__
@@ -13,12 +13,14 @@
 
 // Library includes -------------------------------------------------------------------------------------
 #include <stdio.h>
+#include <string.h>
 #include <Windows.h>
 
 // Projects includes ------------------------------------------------------------------------------------
 //include every header
 #include "FetchAndValidateCommandlineArguments.h"
 #include "SolveTasks.h"
+#include "TasksContainer.h"
 
 
 // Constants ----------------------------------------------------------------------------
@@ -30,8 +32,18 @@ static const BOOL STATUS_CODE_SUCCESS = TRUE;
 
 int main(int argc, char* argv[]) {
 	int numberOfTasks = 0, numberOfThreads = 0;
-	//Validating the number of command line arguments
-	if ((argc != 5) || (argv[1] == NULL) || (argv[2] == NULL) || (argv[3] == NULL) || (argv[4] == NULL)) {
+	solverOptions options;
+	//Converter subcommand: "--convert <Tasks list file> <Tasks Priorities list file> <tasks container file>"
+	if ((argc == 5) && (0 == strcmp(argv[1], "--convert"))) {
+		if (STATUS_CODE_FAILURE == convertTextFilesToTasksContainer(argv[2], argv[3], argv[4])) {
+			printf("Error: Failed to convert the text files to a tasks container.\n");
+			return 1;
+		}
+		return 0;
+	}
+
+	//Validating the number of command line arguments (optional flags may follow the mandatory ones)
+	if ((argc < 5) || (argv[1] == NULL) || (argv[2] == NULL) || (argv[3] == NULL) || (argv[4] == NULL)) {
 		printf("Error: Incorrect number of arguments.\n");
 		return 1;
 	}
@@ -39,13 +51,16 @@ int main(int argc, char* argv[]) {
 
 	/* --------------------------------------------------------------------------------------------------------------------------- */
 	/*Validate that both the Tasks list text file & Tasks Priorities list text file paths are not null or '\0'			*/
-	/*Read the number of tasks from string & validate that the number is positive							*/					   */
+	/*Read the number of tasks from string & validate that the number is positive							*/
 	/*Read the number of threads needed to be activated for the message processing & validate that the number is positive		*/
 	/* --------------------------------------------------------------------------------------------------------------------------- */
 	if (STATUS_CODE_FAILURE == fetchAndValidateCommandLineArguments(argv[1], argv[2],
 									argv[3], &numberOfTasks,
 									argv[4], &numberOfThreads)) return 1;
 
+	//Read the optional flags following the mandatory arguments
+	if (STATUS_CODE_FAILURE == fetchOptionalCommandLineFlags(argc - 5, argv + 5, &options)) return 1;
+
 
 	
 
@@ -59,7 +74,7 @@ int main(int argc, char* argv[]) {
 	/* Tasks file (documentation). Lastly, after threads termination, all the wait & exit codes of the threads will be validated   */
 	/* and the operation final status code will be outputted																	   */		
 	/* --------------------------------------------------------------------------------------------------------------------------- */
-	if (STATUS_CODE_FAILURE == solveTasks(argv[1], argv[2], numberOfTasks, numberOfThreads)) {
+	if (STATUS_CODE_FAILURE == solveTasks(argv[1], argv[2], numberOfTasks, numberOfThreads, &options)) {
 		printf("Error: Failed to solve all tasks.\n");
 		return 1;
 	}